@@ -0,0 +1,162 @@
+#include "pch.h"
+#include "Benchmark.h"
+
+using namespace std::chrono;
+
+std::mt19937 Benchmark::sRandom{ Benchmark::SEED };
+
+void Benchmark::Add(const BenchmarkDesc& desc)
+{
+	ASSERT(desc.name != nullptr);
+	ASSERT(desc.function != nullptr);
+
+	mBenchmarks.push_back(desc);
+}
+
+void Benchmark::Run(const char* filter)
+{
+	mResults.clear();
+
+	for (const BenchmarkDesc& desc : mBenchmarks)
+	{
+		if (filter != nullptr and strstr(desc.name, filter) == nullptr)
+		{
+			continue;
+		}
+
+		// ̽  Է     õ带 ǵ.
+		sRandom.seed(SEED);
+
+		if (desc.setup != nullptr)
+		{
+			desc.setup();
+		}
+
+		//   ǥ MIN_SAMPLE_SECONDS   ݺ Ƚ ø.
+		uint64_t iterationCount = 1;
+		double seconds = measure(desc, iterationCount);
+
+		while (seconds < MIN_SAMPLE_SECONDS)
+		{
+			const double scale = seconds > 0.0 ? MIN_SAMPLE_SECONDS / seconds * 1.2 : 10.0;
+			iterationCount = max(iterationCount * 2, uint64_t(double(iterationCount) * min(scale, 10.0)));
+			seconds = measure(desc, iterationCount);
+		}
+
+		// ߾Ӱ Ἥ   Ƣ ǥ Ѵ.
+		std::array<double, SAMPLE_COUNT> samples{};
+
+		for (double& sample : samples)
+		{
+			sample = measure(desc, iterationCount);
+		}
+
+		std::sort(samples.begin(), samples.end());
+
+		const double nanosecondsPerOperation = samples[SAMPLE_COUNT / 2] * 1e9 / double(iterationCount);
+
+		mResults.push_back
+		(
+			{
+				.name = desc.name,
+				.iterationCount = iterationCount,
+				.nanosecondsPerOperation = nanosecondsPerOperation,
+				.operationsPerSecond = 1e9 / nanosecondsPerOperation
+			}
+		);
+
+		LOG("%-48s %12.2f ns/op %16.0f ops/s", desc.name, nanosecondsPerOperation, 1e9 / nanosecondsPerOperation);
+	}
+}
+
+void Benchmark::WriteJson(const std::filesystem::path& path) const
+{
+	std::ofstream file(path);
+
+	if (not file.is_open())
+	{
+		LOG("Failed to open %s", path.string().c_str());
+		return;
+	}
+
+	file << "{\n";
+	file << "\t\"seed\": " << SEED << ",\n";
+#if defined(_DEBUG)
+	file << "\t\"configuration\": \"Debug\",\n";
+#else
+	file << "\t\"configuration\": \"Release\",\n";
+#endif
+	file << "\t\"benchmarks\":\n\t[\n";
+
+	for (size_t i = 0; i < mResults.size(); ++i)
+	{
+		const BenchmarkResult& result = mResults[i];
+
+		file << "\t\t{ \"name\": \"" << result.name
+			<< "\", \"iterations\": " << result.iterationCount
+			<< ", \"ns_per_op\": " << result.nanosecondsPerOperation
+			<< ", \"ops_per_sec\": " << result.operationsPerSecond
+			<< (i + 1 < mResults.size() ? " },\n" : " }\n");
+	}
+
+	file << "\t]\n}\n";
+}
+
+const std::vector<BenchmarkResult>& Benchmark::GetResults() const
+{
+	return mResults;
+}
+
+float Benchmark::GetRandomFloat(const float min, const float max)
+{
+	std::uniform_real_distribution<float> distribution(min, max);
+	return distribution(sRandom);
+}
+
+D2D1_POINT_2F Benchmark::GetRandomPoint(const float halfExtent)
+{
+	const D2D1_POINT_2F point =
+	{
+		.x = GetRandomFloat(-halfExtent, halfExtent),
+		.y = GetRandomFloat(-halfExtent, halfExtent)
+	};
+
+	return point;
+}
+
+D2D1_RECT_F Benchmark::GetRandomRect(const float halfExtent, const float maxHalfSize)
+{
+	const D2D1_POINT_2F center = GetRandomPoint(halfExtent);
+	const float halfWidth = GetRandomFloat(1.0f, maxHalfSize);
+	const float halfHeight = GetRandomFloat(1.0f, maxHalfSize);
+
+	const D2D1_RECT_F rect =
+	{
+		.left = center.x - halfWidth,
+		.top = center.y + halfHeight,
+		.right = center.x + halfWidth,
+		.bottom = center.y - halfHeight
+	};
+
+	return rect;
+}
+
+double Benchmark::measure(const BenchmarkDesc& desc, const uint64_t iterationCount)
+{
+	double seconds = 0.0;
+	uint64_t remainCount = iterationCount;
+
+	while (remainCount > 0)
+	{
+		const uint32_t count = uint32_t(min(remainCount, uint64_t(UINT32_MAX)));
+
+		const auto startTime = steady_clock::now();
+		const float result = desc.function(count);
+		seconds += duration<double>(steady_clock::now() - startTime).count();
+
+		mSink = result;
+		remainCount -= count;
+	}
+
+	return seconds;
+}
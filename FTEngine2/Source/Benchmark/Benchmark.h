@@ -0,0 +1,59 @@
+#pragma once
+
+//  Լ iterationCount ݺϰ, ȭ  ʵ   ȯѴ.
+// Է setup , setup   ⸦  õ ʱȭѴ.
+struct BenchmarkDesc
+{
+	const char* const name;
+	void (* const setup)();
+	float (* const function)(const uint32_t iterationCount);
+};
+
+struct BenchmarkResult
+{
+	std::string name;
+	uint64_t iterationCount;
+	double nanosecondsPerOperation;
+	double operationsPerSecond;
+};
+
+class Benchmark final
+{
+public:
+	Benchmark() = default;
+	Benchmark(const Benchmark&) = delete;
+	Benchmark& operator=(const Benchmark&) = delete;
+
+	void Add(const BenchmarkDesc& desc);
+	void Run(const char* filter);
+	void WriteJson(const std::filesystem::path& path) const;
+
+	[[nodiscard]] const std::vector<BenchmarkResult>& GetResults() const;
+
+public:
+	static constexpr uint32_t SEED = 20240601;
+
+	[[nodiscard]] static float GetRandomFloat(const float min, const float max);
+	[[nodiscard]] static D2D1_POINT_2F GetRandomPoint(const float halfExtent);
+	[[nodiscard]] static D2D1_RECT_F GetRandomRect(const float halfExtent, const float maxHalfSize);
+
+private:
+	[[nodiscard]] double measure(const BenchmarkDesc& desc, const uint64_t iterationCount);
+
+private:
+	static constexpr double MIN_SAMPLE_SECONDS = 0.02;
+	static constexpr uint32_t SAMPLE_COUNT = 5;
+
+	static std::mt19937 sRandom;
+
+	std::vector<BenchmarkDesc> mBenchmarks{};
+	std::vector<BenchmarkResult> mResults{};
+	volatile float mSink = 0.0f;
+};
+
+void RegisterMathBenchmarks(Benchmark* benchmark);
+void RegisterCollisionBenchmarks(Benchmark* benchmark);
+void RegisterSpatialBenchmarks(Benchmark* benchmark);
+void RegisterLabelBenchmarks(Benchmark* benchmark);
+void RegisterEntityBenchmarks(Benchmark* benchmark);
+void RegisterRenderBenchmarks(Benchmark* benchmark);
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "pch.h"
+#include "Benchmark.h"
+
+#include "Core/Collision.h"
+#include "Core/Sprite.h"
+
+namespace
+{
+	constexpr uint32_t INPUT_COUNT = 1024;
+	constexpr uint32_t INPUT_MASK = INPUT_COUNT - 1;
+
+	//   浹ϵ  ũ⿡    Ѹ.
+	constexpr float HALF_EXTENT = 100.0f;
+	constexpr float MAX_HALF_SIZE = 40.0f;
+	constexpr float MAX_DISPLACEMENT = 60.0f;
+
+	// ؽó ҷ Ƿ 簢 ؽó ũ⸦ Ѵ.
+	constexpr float TEXTURE_SIZE = 16.0f;
+
+	D2D1_RECT_F gRects[INPUT_COUNT + 1]{};
+	D2D1_POINT_2F gPoints[INPUT_COUNT]{};
+	D2D1_ELLIPSE gCircles[INPUT_COUNT + 1]{};
+	Line gLines[INPUT_COUNT + 1]{};
+	D2D1_POINT_2F gDisplacements[INPUT_COUNT + 1]{};
+	Sprite gSprites[INPUT_COUNT]{};
+
+	void setupInputs()
+	{
+		for (uint32_t i = 0; i <= INPUT_COUNT; ++i)
+		{
+			gRects[i] = Benchmark::GetRandomRect(HALF_EXTENT, MAX_HALF_SIZE);
+
+			const float radius = Benchmark::GetRandomFloat(1.0f, MAX_HALF_SIZE);
+			gCircles[i] = { .point = Benchmark::GetRandomPoint(HALF_EXTENT), .radiusX = radius, .radiusY = radius };
+
+			gLines[i] = { .Point0 = Benchmark::GetRandomPoint(HALF_EXTENT), .Point1 = Benchmark::GetRandomPoint(HALF_EXTENT) };
+			gDisplacements[i] = Benchmark::GetRandomPoint(MAX_DISPLACEMENT);
+		}
+
+		for (uint32_t i = 0; i < INPUT_COUNT; ++i)
+		{
+			gPoints[i] = Benchmark::GetRandomPoint(HALF_EXTENT);
+
+			gSprites[i].SetPosition(Benchmark::GetRandomPoint(HALF_EXTENT));
+			gSprites[i].SetScale({ .width = Benchmark::GetRandomFloat(0.5f, 4.0f), .height = Benchmark::GetRandomFloat(0.5f, 4.0f) });
+		}
+	}
+
+	// MainScene::getRectangleFromSprite  . ؽó  ũ⸦ ޴´.
+	D2D1_RECT_F getRectangleFromSprite(const Sprite& sprite, const float textureWidth, const float textureHeight)
+	{
+		const D2D1_SIZE_F scale = sprite.GetScale();
+
+		const D2D1_SIZE_F offset =
+		{
+			.width = scale.width * textureWidth * 0.5f,
+			.height = scale.height * textureHeight * 0.5f
+		};
+
+		const D2D1_POINT_2F position = sprite.GetPosition();
+
+		const D2D1_RECT_F rect =
+		{
+			.left = position.x - offset.width,
+			.top = position.y + offset.height,
+			.right = position.x + offset.width,
+			.bottom = position.y - offset.height
+		};
+
+		return rect;
+	}
+
+	float benchmarkSqureWithPoint(const uint32_t iterationCount)
+	{
+		float hitCount = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			hitCount += float(Collision::IsCollidedSqureWithPoint(gRects[index], gPoints[index]));
+		}
+
+		return hitCount;
+	}
+
+	float benchmarkSqureWithSqure(const uint32_t iterationCount)
+	{
+		float hitCount = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			hitCount += float(Collision::IsCollidedSqureWithSqure(gRects[index], gRects[index + 1]));
+		}
+
+		return hitCount;
+	}
+
+	float benchmarkSqureWithLine(const uint32_t iterationCount)
+	{
+		float hitCount = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			hitCount += float(Collision::IsCollidedSqureWithLine(gRects[index], gLines[index]));
+		}
+
+		return hitCount;
+	}
+
+	float benchmarkSqureWithCircle(const uint32_t iterationCount)
+	{
+		float hitCount = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			hitCount += float(Collision::IsCollidedSqureWithCircle(gRects[index], gCircles[index].point, gCircles[index].radiusX));
+		}
+
+		return hitCount;
+	}
+
+	float benchmarkCircleWithPoint(const uint32_t iterationCount)
+	{
+		float hitCount = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			hitCount += float(Collision::IsCollidedCircleWithPoint(gCircles[index].point, gCircles[index].radiusX, gPoints[index]));
+		}
+
+		return hitCount;
+	}
+
+	float benchmarkCircleWithLine(const uint32_t iterationCount)
+	{
+		float hitCount = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			hitCount += float(Collision::IsCollidedCircleWithLine(gCircles[index].point, gCircles[index].radiusX, gLines[index]));
+		}
+
+		return hitCount;
+	}
+
+	float benchmarkCircleWithCircle(const uint32_t iterationCount)
+	{
+		float hitCount = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			hitCount += float(Collision::IsCollidedCircleWithCircle(gCircles[index], gCircles[index + 1]));
+		}
+
+		return hitCount;
+	}
+
+	float benchmarkDoLinesIntersect(const uint32_t iterationCount)
+	{
+		float hitCount = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			hitCount += float(Collision::DoLinesIntersect(gLines[index], gLines[index + 1]));
+		}
+
+		return hitCount;
+	}
+
+	float benchmarkSweepLineWithSqure(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			float time = 0.0f;
+
+			if (Collision::SweepLineWithSqure(gLines[index], gRects[index], &time))
+			{
+				sum += time;
+			}
+		}
+
+		return sum;
+	}
+
+	float benchmarkSweepCircleWithCircle(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			float time = 0.0f;
+
+			if (Collision::SweepCircleWithCircle(gCircles[index], gDisplacements[index], gCircles[index + 1], gDisplacements[index + 1], &time))
+			{
+				sum += time;
+			}
+		}
+
+		return sum;
+	}
+
+	float benchmarkSweepSqureWithSqure(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			float time = 0.0f;
+
+			if (Collision::SweepSqureWithSqure(gRects[index], gDisplacements[index], gRects[index + 1], gDisplacements[index + 1], &time))
+			{
+				sum += time;
+			}
+		}
+
+		return sum;
+	}
+
+	float benchmarkGetRectangleFromSprite(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const D2D1_RECT_F rect = getRectangleFromSprite(gSprites[i & INPUT_MASK], TEXTURE_SIZE, TEXTURE_SIZE);
+			sum += rect.left + rect.top + rect.right + rect.bottom;
+		}
+
+		return sum;
+	}
+}
+
+void RegisterCollisionBenchmarks(Benchmark* benchmark)
+{
+	ASSERT(benchmark != nullptr);
+
+	benchmark->Add({ .name = "Collision::IsCollidedSqureWithPoint", .setup = setupInputs, .function = benchmarkSqureWithPoint });
+	benchmark->Add({ .name = "Collision::IsCollidedSqureWithSqure", .setup = setupInputs, .function = benchmarkSqureWithSqure });
+	benchmark->Add({ .name = "Collision::IsCollidedSqureWithLine", .setup = setupInputs, .function = benchmarkSqureWithLine });
+	benchmark->Add({ .name = "Collision::IsCollidedSqureWithCircle", .setup = setupInputs, .function = benchmarkSqureWithCircle });
+	benchmark->Add({ .name = "Collision::IsCollidedCircleWithPoint", .setup = setupInputs, .function = benchmarkCircleWithPoint });
+	benchmark->Add({ .name = "Collision::IsCollidedCircleWithLine", .setup = setupInputs, .function = benchmarkCircleWithLine });
+	benchmark->Add({ .name = "Collision::IsCollidedCircleWithCircle", .setup = setupInputs, .function = benchmarkCircleWithCircle });
+	benchmark->Add({ .name = "Collision::DoLinesIntersect", .setup = setupInputs, .function = benchmarkDoLinesIntersect });
+	benchmark->Add({ .name = "Collision::SweepLineWithSqure", .setup = setupInputs, .function = benchmarkSweepLineWithSqure });
+	benchmark->Add({ .name = "Collision::SweepCircleWithCircle", .setup = setupInputs, .function = benchmarkSweepCircleWithCircle });
+	benchmark->Add({ .name = "Collision::SweepSqureWithSqure", .setup = setupInputs, .function = benchmarkSweepSqureWithSqure });
+	benchmark->Add({ .name = "MainScene::getRectangleFromSprite", .setup = setupInputs, .function = benchmarkGetRectangleFromSprite });
+}
@@ -0,0 +1,256 @@
+#include "pch.h"
+#include "Benchmark.h"
+
+#include "Core/EntityComponents.h"
+#include "Core/EntityWorld.h"
+
+namespace
+{
+	//    ENTITY_COUNT ƼƼ   ȴ ̴.
+	constexpr uint32_t ENTITY_COUNT = 100000;
+	constexpr float DELTA_TIME = 1.0f / 60.0f;
+	constexpr float HALF_EXTENT = 1000.0f;
+
+	struct VelocityComponent
+	{
+		D2D1_POINT_2F velocity;
+	};
+
+	struct HealthComponent
+	{
+		float hp;
+		float regeneration;
+	};
+
+	struct LifetimeComponent
+	{
+		float remainingSeconds;
+	};
+
+	// ٲٱ ó ƼƼ  ʵ带  ü д.
+	struct EntityObject
+	{
+		TransformComponent transform;
+		VelocityComponent velocity;
+		SpriteComponent sprite;
+		HealthComponent health;
+		LifetimeComponent lifetime;
+		bool bDisabled;
+	};
+
+	std::vector<EntityObject> gObjects{};
+	EntityWorld gWorld3{};
+	EntityWorld gWorld5{};
+	std::pmr::vector<EntityChunkView> gChunks{};
+
+	void setupEntities()
+	{
+		gObjects.clear();
+		gObjects.reserve(ENTITY_COUNT);
+
+		gWorld3.Finalize();
+		gWorld5.Finalize();
+
+		const ComponentMask mask3 = EntityWorld::GetMask<TransformComponent, VelocityComponent, SpriteComponent>();
+		const ComponentMask mask5 = mask3 | EntityWorld::GetMask<HealthComponent, LifetimeComponent>();
+
+		for (uint32_t i = 0; i < ENTITY_COUNT; ++i)
+		{
+			EntityObject object{};
+			object.transform = { .position = Benchmark::GetRandomPoint(HALF_EXTENT), .angle = 0.0f, .scale = { .width = 1.0f, .height = 1.0f } };
+			object.velocity = { .velocity = Benchmark::GetRandomPoint(100.0f) };
+			object.sprite = { .texture = nullptr, .center = {}, .opacity = 1.0f, .layer = 0, .bUI = false };
+			object.health = { .hp = Benchmark::GetRandomFloat(1.0f, 100.0f), .regeneration = 1.0f };
+			object.lifetime = { .remainingSeconds = Benchmark::GetRandomFloat(1.0f, 10.0f) };
+
+			//       .
+			object.bDisabled = i % 2 == 1;
+			gObjects.push_back(object);
+
+			const Entity entity3 = gWorld3.Create(mask3);
+			*gWorld3.GetOrNull<TransformComponent>(entity3) = object.transform;
+			*gWorld3.GetOrNull<VelocityComponent>(entity3) = object.velocity;
+			*gWorld3.GetOrNull<SpriteComponent>(entity3) = object.sprite;
+
+			const Entity entity5 = gWorld5.Create(object.bDisabled ? mask5 | EntityWorld::GetMask<DisabledTag>() : mask5);
+			*gWorld5.GetOrNull<TransformComponent>(entity5) = object.transform;
+			*gWorld5.GetOrNull<VelocityComponent>(entity5) = object.velocity;
+			*gWorld5.GetOrNull<SpriteComponent>(entity5) = object.sprite;
+			*gWorld5.GetOrNull<HealthComponent>(entity5) = object.health;
+			*gWorld5.GetOrNull<LifetimeComponent>(entity5) = object.lifetime;
+		}
+	}
+
+	void moveObject(EntityObject* object)
+	{
+		object->transform.position.x += object->velocity.velocity.x * DELTA_TIME;
+		object->transform.position.y += object->velocity.velocity.y * DELTA_TIME;
+		object->sprite.opacity = max(object->sprite.opacity - DELTA_TIME * 0.01f, 0.0f);
+	}
+
+	float benchmarkIterateObjects3(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			for (EntityObject& object : gObjects)
+			{
+				moveObject(&object);
+			}
+
+			sum += gObjects[iteration % ENTITY_COUNT].transform.position.x;
+		}
+
+		return sum;
+	}
+
+	float benchmarkIterateObjects5(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			for (EntityObject& object : gObjects)
+			{
+				moveObject(&object);
+				object.health.hp = min(object.health.hp + object.health.regeneration * DELTA_TIME, 100.0f);
+				object.lifetime.remainingSeconds -= DELTA_TIME;
+			}
+
+			sum += gObjects[iteration % ENTITY_COUNT].health.hp;
+		}
+
+		return sum;
+	}
+
+	float benchmarkIterateObjectsExclude(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			for (EntityObject& object : gObjects)
+			{
+				if (object.bDisabled)
+				{
+					continue;
+				}
+
+				moveObject(&object);
+			}
+
+			sum += gObjects[iteration % ENTITY_COUNT].transform.position.x;
+		}
+
+		return sum;
+	}
+
+	float moveChunks()
+	{
+		float sum = 0.0f;
+
+		for (const EntityChunkView& chunk : gChunks)
+		{
+			TransformComponent* transforms = chunk.GetComponents<TransformComponent>();
+			const VelocityComponent* velocities = chunk.GetComponents<VelocityComponent>();
+			SpriteComponent* sprites = chunk.GetComponents<SpriteComponent>();
+
+			for (uint32_t i = 0; i < chunk.GetCount(); ++i)
+			{
+				transforms[i].position.x += velocities[i].velocity.x * DELTA_TIME;
+				transforms[i].position.y += velocities[i].velocity.y * DELTA_TIME;
+				sprites[i].opacity = max(sprites[i].opacity - DELTA_TIME * 0.01f, 0.0f);
+			}
+
+			sum += transforms[0].position.x;
+		}
+
+		return sum;
+	}
+
+	float benchmarkIterateEntities3(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			gWorld3.Query({ .include = EntityWorld::GetMask<TransformComponent, VelocityComponent, SpriteComponent>(), .exclude = 0 }, &gChunks);
+			sum += moveChunks();
+		}
+
+		return sum;
+	}
+
+	float benchmarkIterateEntities5(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			gWorld5.Query
+			(
+				{
+					.include = EntityWorld::GetMask<TransformComponent, VelocityComponent, SpriteComponent, HealthComponent, LifetimeComponent>(),
+					.exclude = 0
+				},
+				&gChunks
+			);
+
+			// ټ Ʈ   ȴ´.
+			for (const EntityChunkView& chunk : gChunks)
+			{
+				TransformComponent* transforms = chunk.GetComponents<TransformComponent>();
+				const VelocityComponent* velocities = chunk.GetComponents<VelocityComponent>();
+				SpriteComponent* sprites = chunk.GetComponents<SpriteComponent>();
+				HealthComponent* healths = chunk.GetComponents<HealthComponent>();
+				LifetimeComponent* lifetimes = chunk.GetComponents<LifetimeComponent>();
+
+				for (uint32_t i = 0; i < chunk.GetCount(); ++i)
+				{
+					transforms[i].position.x += velocities[i].velocity.x * DELTA_TIME;
+					transforms[i].position.y += velocities[i].velocity.y * DELTA_TIME;
+					sprites[i].opacity = max(sprites[i].opacity - DELTA_TIME * 0.01f, 0.0f);
+					healths[i].hp = min(healths[i].hp + healths[i].regeneration * DELTA_TIME, 100.0f);
+					lifetimes[i].remainingSeconds -= DELTA_TIME;
+				}
+
+				sum += healths[0].hp;
+			}
+		}
+
+		return sum;
+	}
+
+	float benchmarkIterateEntitiesExclude(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			gWorld5.Query
+			(
+				{
+					.include = EntityWorld::GetMask<TransformComponent, VelocityComponent, SpriteComponent>(),
+					.exclude = EntityWorld::GetMask<DisabledTag>()
+				},
+				&gChunks
+			);
+			sum += moveChunks();
+		}
+
+		return sum;
+	}
+}
+
+void RegisterEntityBenchmarks(Benchmark* benchmark)
+{
+	ASSERT(benchmark != nullptr);
+
+	benchmark->Add({ .name = "EntityWorld::Iterate/3/objects", .setup = setupEntities, .function = benchmarkIterateObjects3 });
+	benchmark->Add({ .name = "EntityWorld::Iterate/3/chunks", .setup = setupEntities, .function = benchmarkIterateEntities3 });
+	benchmark->Add({ .name = "EntityWorld::Iterate/5/objects", .setup = setupEntities, .function = benchmarkIterateObjects5 });
+	benchmark->Add({ .name = "EntityWorld::Iterate/5/chunks", .setup = setupEntities, .function = benchmarkIterateEntities5 });
+	benchmark->Add({ .name = "EntityWorld::Query/exclude/objects", .setup = setupEntities, .function = benchmarkIterateObjectsExclude });
+	benchmark->Add({ .name = "EntityWorld::Query/exclude/chunks", .setup = setupEntities, .function = benchmarkIterateEntitiesExclude });
+}
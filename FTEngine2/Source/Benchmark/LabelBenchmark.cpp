@@ -0,0 +1,105 @@
+#include "pch.h"
+#include "Benchmark.h"
+
+#include "Core/FrameAllocator.h"
+#include "Core/Label.h"
+
+namespace
+{
+	// MainScene UIó  ӿ   ڸ  .
+	constexpr uint32_t LABEL_COUNT = 6;
+	constexpr uint32_t VALUE_COUNT = 256;
+	constexpr size_t FRAME_ALLOCATOR_CAPACITY = 64 * 1024;
+
+	Label gLabels[LABEL_COUNT]{};
+	int32_t gValues[VALUE_COUNT]{};
+
+	void setupLabels()
+	{
+		for (int32_t& value : gValues)
+		{
+			value = int32_t(Benchmark::GetRandomFloat(0.0f, 100000.0f));
+		}
+
+		for (Label& label : gLabels)
+		{
+			label.SetText(L"Label: 00000 / 00000");
+		}
+
+		FrameAllocator::Get().Finalize();
+		FrameAllocator::Get().Initialize({ .capacity = FRAME_ALLOCATOR_CAPACITY });
+	}
+
+	// ٲٱ ó std::wstring ̾ ٿ .
+	float benchmarkFormatHeap(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const int32_t value = gValues[i % VALUE_COUNT];
+			Label& label = gLabels[i % LABEL_COUNT];
+
+			label.SetText(L"Hp: " + std::to_wstring(value) + L" / " + std::to_wstring(VALUE_COUNT));
+			sum += float(label.GetText().size());
+		}
+
+		return sum;
+	}
+
+	//  ũġ ,  LABEL_COUNT     .
+	float benchmarkFormatFrame(const uint32_t iterationCount)
+	{
+		FrameAllocator& frameAllocator = FrameAllocator::Get();
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			if (i % LABEL_COUNT == 0)
+			{
+				frameAllocator.BeginFrame();
+			}
+
+			const int32_t value = gValues[i % VALUE_COUNT];
+			Label& label = gLabels[i % LABEL_COUNT];
+
+			FrameWString text(frameAllocator.GetMemoryResource());
+			text.reserve(32);
+			text += L"Hp: ";
+			text += std::to_wstring(value);
+			text += L" / ";
+			text += std::to_wstring(VALUE_COUNT);
+
+			label.SetText(text);
+			sum += float(label.GetText().size());
+		}
+
+		return sum;
+	}
+
+	//   ۿ ٷ .
+	float benchmarkFormatInline(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const int32_t value = gValues[i % VALUE_COUNT];
+			Label& label = gLabels[i % LABEL_COUNT];
+
+			label.Format(L"Hp: ", value, L" / ", VALUE_COUNT);
+			sum += float(label.GetText().size());
+		}
+
+		return sum;
+	}
+}
+
+void RegisterLabelBenchmarks(Benchmark* benchmark)
+{
+	ASSERT(benchmark != nullptr);
+
+	benchmark->Add({ .name = "Label::Format/heap", .setup = setupLabels, .function = benchmarkFormatHeap });
+	benchmark->Add({ .name = "Label::Format/frame", .setup = setupLabels, .function = benchmarkFormatFrame });
+	benchmark->Add({ .name = "Label::Format/inline", .setup = setupLabels, .function = benchmarkFormatInline });
+}
@@ -0,0 +1,208 @@
+#include "pch.h"
+#include "Benchmark.h"
+
+#include "Core/Transformation.h"
+
+namespace
+{
+	constexpr uint32_t INPUT_COUNT = 1024;
+	constexpr uint32_t INPUT_MASK = INPUT_COUNT - 1;
+	constexpr float HALF_EXTENT = 1000.0f;
+
+	D2D1_POINT_2F gPoints[INPUT_COUNT + 2]{};
+	float gScalars[INPUT_COUNT]{};
+	float gAngles[INPUT_COUNT]{};
+	D2D1_SIZE_F gScales[INPUT_COUNT]{};
+
+	void setupInputs()
+	{
+		for (D2D1_POINT_2F& point : gPoints)
+		{
+			point = Benchmark::GetRandomPoint(HALF_EXTENT);
+		}
+
+		for (uint32_t i = 0; i < INPUT_COUNT; ++i)
+		{
+			gScalars[i] = Benchmark::GetRandomFloat(0.0f, 1.0f);
+			gAngles[i] = Benchmark::GetRandomFloat(-360.0f, 360.0f);
+			gScales[i] = { .width = Benchmark::GetRandomFloat(0.1f, 4.0f), .height = Benchmark::GetRandomFloat(0.1f, 4.0f) };
+		}
+	}
+
+	float benchmarkAddVector(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			const D2D1_POINT_2F result = Math::AddVector(gPoints[index], gPoints[index + 1]);
+			sum += result.x + result.y;
+		}
+
+		return sum;
+	}
+
+	float benchmarkSubtractVector(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			const D2D1_POINT_2F result = Math::SubtractVector(gPoints[index], gPoints[index + 1]);
+			sum += result.x + result.y;
+		}
+
+		return sum;
+	}
+
+	float benchmarkScaleVector(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			const D2D1_POINT_2F result = Math::ScaleVector(gPoints[index], gScalars[index]);
+			sum += result.x + result.y;
+		}
+
+		return sum;
+	}
+
+	float benchmarkGetVectorLength(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			sum += Math::GetVectorLength(gPoints[i & INPUT_MASK]);
+		}
+
+		return sum;
+	}
+
+	float benchmarkLerpVector(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			const D2D1_POINT_2F result = Math::LerpVector(gPoints[index], gPoints[index + 1], gScalars[index]);
+			sum += result.x + result.y;
+		}
+
+		return sum;
+	}
+
+	float benchmarkNormalizeVector(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const D2D1_POINT_2F result = Math::NormalizeVector(gPoints[i & INPUT_MASK]);
+			sum += result.x + result.y;
+		}
+
+		return sum;
+	}
+
+	float benchmarkRotateVector(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			const D2D1_POINT_2F result = Math::RotateVector(gPoints[index], gAngles[index]);
+			sum += result.x + result.y;
+		}
+
+		return sum;
+	}
+
+	float benchmarkCrossProduct2D(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			sum += Math::CrossProduct2D(gPoints[index], gPoints[index + 1], gPoints[index + 2]);
+		}
+
+		return sum;
+	}
+
+	float benchmarkConvertDegreeToRadian(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			sum += Math::ConvertDegreeToRadian(gAngles[i & INPUT_MASK]);
+		}
+
+		return sum;
+	}
+
+	float benchmarkConvertRadianToDegree(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			sum += Math::ConvertRadianToDegree(gScalars[i & INPUT_MASK]);
+		}
+
+		return sum;
+	}
+
+	float benchmarkDotProduct2D(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			sum += Math::DotProduct2D(gPoints[index], gPoints[index + 1]);
+		}
+
+		return sum;
+	}
+
+	float benchmarkGetWorldMatrix(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const uint32_t index = i & INPUT_MASK;
+			const D2D1::Matrix3x2F world = Transformation::getWorldMatrix(gPoints[index], gAngles[index], gScales[index]);
+			sum += world._11 + world._22 + world._31 + world._32;
+		}
+
+		return sum;
+	}
+}
+
+void RegisterMathBenchmarks(Benchmark* benchmark)
+{
+	ASSERT(benchmark != nullptr);
+
+	benchmark->Add({ .name = "Math::AddVector", .setup = setupInputs, .function = benchmarkAddVector });
+	benchmark->Add({ .name = "Math::SubtractVector", .setup = setupInputs, .function = benchmarkSubtractVector });
+	benchmark->Add({ .name = "Math::ScaleVector", .setup = setupInputs, .function = benchmarkScaleVector });
+	benchmark->Add({ .name = "Math::GetVectorLength", .setup = setupInputs, .function = benchmarkGetVectorLength });
+	benchmark->Add({ .name = "Math::LerpVector", .setup = setupInputs, .function = benchmarkLerpVector });
+	benchmark->Add({ .name = "Math::NormalizeVector", .setup = setupInputs, .function = benchmarkNormalizeVector });
+	benchmark->Add({ .name = "Math::RotateVector", .setup = setupInputs, .function = benchmarkRotateVector });
+	benchmark->Add({ .name = "Math::CrossProduct2D", .setup = setupInputs, .function = benchmarkCrossProduct2D });
+	benchmark->Add({ .name = "Math::ConvertDegreeToRadian", .setup = setupInputs, .function = benchmarkConvertDegreeToRadian });
+	benchmark->Add({ .name = "Math::ConvertRadianToDegree", .setup = setupInputs, .function = benchmarkConvertRadianToDegree });
+	benchmark->Add({ .name = "Math::DotProduct2D", .setup = setupInputs, .function = benchmarkDotProduct2D });
+	benchmark->Add({ .name = "Transformation::getWorldMatrix", .setup = setupInputs, .function = benchmarkGetWorldMatrix });
+}
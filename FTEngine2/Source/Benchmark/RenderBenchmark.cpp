@@ -0,0 +1,194 @@
+#include "pch.h"
+#include "Benchmark.h"
+
+#include "Core/RenderQueue.h"
+#include "Core/Sprite.h"
+#include "Core/Texture.h"
+#include "Core/Transformation.h"
+
+using namespace D2D1;
+
+namespace
+{
+	//    SPRITE_COUNT Ʈ   ׸ ̴.
+	constexpr uint32_t SPRITE_COUNT = 10000;
+	constexpr uint32_t TEXTURE_COUNT = 16;
+	constexpr float HALF_EXTENT = 1000.0f;
+
+	// ġũ Ʈ  Ƿ ؽó ũ⸦ Ѵ.
+	constexpr float TEXTURE_SIZE = 32.0f;
+
+	// Coreó  Ŀ   Ѵ. ݺ ٸ 並 Ἥ  ݺ   ʰ Ѵ.
+	constexpr uint32_t VIEW_COUNT = 4;
+
+	//   迭ó Ʈ ٸ  ̿  ֵ ̿   д.
+	struct SpriteSlot
+	{
+		Sprite sprite;
+		uint8_t padding[192];
+	};
+
+	std::vector<std::unique_ptr<SpriteSlot>> gSlots{};
+	std::vector<Sprite*> gSprites{};
+	Texture gTextures[TEXTURE_COUNT]{};
+	RenderQueue gRenderQueue{};
+	Matrix3x2F gViews[VIEW_COUNT]{};
+
+	void setupSprites()
+	{
+		gSlots.clear();
+		gSprites.clear();
+
+		for (uint32_t i = 0; i < SPRITE_COUNT; ++i)
+		{
+			std::unique_ptr<SpriteSlot> slot = std::make_unique<SpriteSlot>();
+
+			Sprite& sprite = slot->sprite;
+			sprite.SetTexture(&gTextures[i % TEXTURE_COUNT]);
+			sprite.SetPosition(Benchmark::GetRandomPoint(HALF_EXTENT));
+			sprite.SetAngle(Benchmark::GetRandomFloat(0.0f, 360.0f));
+			sprite.SetScale({ .width = Benchmark::GetRandomFloat(0.5f, 2.0f), .height = Benchmark::GetRandomFloat(0.5f, 2.0f) });
+			sprite.SetOpacity(Benchmark::GetRandomFloat(0.1f, 1.0f));
+
+			gSprites.push_back(&sprite);
+			gSlots.push_back(std::move(slot));
+		}
+
+		// ̾  Ҵ  谡 .
+		for (uint32_t i = SPRITE_COUNT - 1; i > 0; --i)
+		{
+			const uint32_t j = uint32_t(Benchmark::GetRandomFloat(0.0f, float(i) + 0.999f));
+			std::swap(gSprites[i], gSprites[j]);
+		}
+
+		for (Matrix3x2F& view : gViews)
+		{
+			const D2D1_POINT_2F offset = Benchmark::GetRandomPoint(HALF_EXTENT);
+			view = Matrix3x2F::Translation(offset.x, offset.y);
+		}
+
+		gRenderQueue.ClearTextures();
+		gRenderQueue.Reserve(SPRITE_COUNT);
+	}
+
+	void addSprites()
+	{
+		gRenderQueue.Clear();
+
+		for (const Sprite* sprite : gSprites)
+		{
+			if (not sprite->IsActive())
+			{
+				continue;
+			}
+
+			gRenderQueue.Add
+			(
+				{
+					.texture = sprite->_GetTextureOrNull(),
+					.center = sprite->GetCenter(),
+					.position = sprite->GetWorldPosition(),
+					.angle = sprite->GetAngle(),
+					.scale = sprite->GetScale(),
+					.opacity = sprite->GetOpacity(),
+					.layer = 0,
+					.bUI = sprite->IsUI()
+				}
+			);
+		}
+	}
+
+	float drawRecords(const Matrix3x2F& view)
+	{
+		const RenderRecord* records = gRenderQueue.GetRecords();
+		const uint32_t recordCount = gRenderQueue.GetCount();
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < recordCount; ++i)
+		{
+			const Matrix3x2F worldView = gRenderQueue.GetWorldMatrix(records[i]) * view;
+			sum += worldView._31 + worldView._32 + gRenderQueue.GetOpacity(records[i]);
+		}
+
+		return sum;
+	}
+
+	// ٲٱ ó ׸鼭 Ʈ ͸   д´.
+	float benchmarkDrawSprites(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			const Matrix3x2F& view = gViews[iteration % VIEW_COUNT];
+
+			for (const Sprite* sprite : gSprites)
+			{
+				if (not sprite->IsActive() or sprite->GetTextureOrNull() == nullptr)
+				{
+					continue;
+				}
+
+				D2D1_POINT_2F center = sprite->GetCenter();
+				center.x = -(center.x + 0.5f) * TEXTURE_SIZE;
+				center.y = (center.y - 0.5f) * TEXTURE_SIZE;
+
+				const Matrix3x2F worldView = Matrix3x2F::Translation(center.x, center.y)
+					* Transformation::getWorldMatrix(sprite->GetWorldPosition(), sprite->GetAngle(), sprite->GetScale()) * view;
+				sum += worldView._31 + worldView._32 + sprite->GetOpacity();
+			}
+		}
+
+		return sum;
+	}
+
+	float benchmarkAddRecords(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			addSprites();
+			sum += float(gRenderQueue.GetCount());
+		}
+
+		return sum;
+	}
+
+	float benchmarkDrawRecords(const uint32_t iterationCount)
+	{
+		addSprites();
+
+		float sum = 0.0f;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			sum += drawRecords(gViews[iteration % VIEW_COUNT]);
+		}
+
+		return sum;
+	}
+
+	float benchmarkAddAndDrawRecords(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+		{
+			addSprites();
+			sum += drawRecords(gViews[iteration % VIEW_COUNT]);
+		}
+
+		return sum;
+	}
+}
+
+void RegisterRenderBenchmarks(Benchmark* benchmark)
+{
+	ASSERT(benchmark != nullptr);
+
+	benchmark->Add({ .name = "Render::Draw/sprites", .setup = setupSprites, .function = benchmarkDrawSprites });
+	benchmark->Add({ .name = "Render::Draw/records/add", .setup = setupSprites, .function = benchmarkAddRecords });
+	benchmark->Add({ .name = "Render::Draw/records/draw", .setup = setupSprites, .function = benchmarkDrawRecords });
+	benchmark->Add({ .name = "Render::Draw/records", .setup = setupSprites, .function = benchmarkAddAndDrawRecords });
+}
@@ -0,0 +1,579 @@
+#include "pch.h"
+#include "SceneBenchmark.h"
+
+#include "Benchmark.h"
+
+#include "Core/AllocationTracker.h"
+#include "Core/Constant.h"
+#include "Core/FrameAllocator.h"
+#include "Core/Input.h"
+#include "Core/InputLatency.h"
+
+using namespace std::chrono;
+
+namespace
+{
+	// ũƮ Է. ƽ ȣ  Ű Ѵ.
+	constexpr uint32_t MOVE_TICK_COUNT = 45;
+	constexpr uint32_t DASH_TICK_PERIOD = 120;
+	constexpr uint32_t KILL_ALL_TICK_PERIOD = 300;
+	constexpr uint32_t ORBIT_TICK_PERIOD = 600;
+	constexpr uint32_t SHIELD_TICK_PERIOD = 720;
+	constexpr uint32_t CLICK_TICK_PERIOD = 20;
+	constexpr float MOUSE_RADIUS = 250.0f;
+	constexpr float MOUSE_DEGREE_PER_TICK = 3.0f;
+
+	//    ֱ⸶ ROLLBACK_TICK_COUNT ƽ ǰ ٽ ùķ̼Ѵ.
+	constexpr uint32_t ROLLBACK_TICK_PERIOD = 10;
+
+	// Core  ũ ´. ƼŬ ûũ  ´.
+	constexpr size_t FRAME_ALLOCATOR_CAPACITY = 256 * 1024;
+
+	//  Ŭ̾Ʈ    .  ƽ ð 䳻 .
+	constexpr float NET_LOSS_RATE = 0.05f;
+	constexpr float NET_LATENCY_SECONDS = 0.05f;
+	constexpr float NET_JITTER_SECONDS = 0.02f;
+
+	static_assert(uint32_t(eScene_Phase::Camera) - uint32_t(eScene_Phase::Hero) + 1 == uint32_t(eMainScene_Phase::Count));
+
+	uint64_t getAllocationCount()
+	{
+		const AllocationStatistics statistics = AllocationTracker::Get().GetTotalStatistics();
+		uint64_t count = 0;
+
+		for (const uint64_t zoneCount : statistics.allocationCounts)
+		{
+			count += zoneCount;
+		}
+
+		return count;
+	}
+
+	double getPercentile(const std::vector<double>& sorted, const double percentile)
+	{
+		if (sorted.empty())
+		{
+			return 0.0;
+		}
+
+		const size_t index = min(size_t(double(sorted.size()) * percentile), sorted.size() - 1);
+		return sorted[index];
+	}
+
+	// â ޽  ũƮ Է ̺Ʈ ִ´.
+	void pushKeyEvent(const uint32_t virtualKey, const bool bPressed)
+	{
+		Input::Get()._PushEvent({ .timestamp = steady_clock::now(), .type = eInput_Event::Key, .code = virtualKey, .bPressed = bPressed });
+	}
+
+	void pushMouseButtonEvent(const Input::eMouseButton button, const bool bPressed)
+	{
+		Input::Get()._PushEvent({ .timestamp = steady_clock::now(), .type = eInput_Event::MouseButton, .code = uint32_t(button), .bPressed = bPressed });
+	}
+}
+
+
+void SceneBenchmark::Initialize(const SceneBenchmarkDesc& desc)
+{
+	ASSERT(desc.tickCount > 0);
+	ASSERT(desc.deltaTime > 0.0f);
+
+	mPoolScale = desc.poolScale;
+	mWarmupTickCount = desc.warmupTickCount;
+	mTickCount = desc.tickCount;
+	mDeltaTime = desc.deltaTime;
+
+	// Ӱ  ҽ д´. ؽó ũ⸸ а   ũ⸦ .
+	HR(CoInitialize(nullptr));
+	HR(CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&mWICImagingFactory)));
+	HR(DWriteCreateFactory(DWRITE_FACTORY_TYPE_SHARED, __uuidof(mDWriteFactory), reinterpret_cast<IUnknown**>(&mDWriteFactory)));
+	mHelper._Initialize(mWICImagingFactory, mDWriteFactory, nullptr);
+
+	FrameAllocator::Get().Finalize();
+	FrameAllocator::Get().Initialize({ .capacity = FRAME_ALLOCATOR_CAPACITY });
+
+	mScene = new MainScene
+	(
+		{
+			.bNetServer = false,
+			.poolScale = mPoolScale,
+			.randomSeed = Benchmark::SEED,
+			.bHeadless = true,
+			.bRollback = true
+		}
+	);
+	mScene->_Preinitialize(&mHelper, std::pmr::get_default_resource());
+	mScene->Initialize();
+
+	mTickSeconds.clear();
+	mTickSeconds.reserve(mTickCount);
+	mSnapshotSeconds.clear();
+	mSnapshotSeconds.reserve(mTickCount);
+	mRestoreSeconds.clear();
+	mRestoreSeconds.reserve(mTickCount);
+	mRollbackSeconds.clear();
+	mRollbackSeconds.reserve(mTickCount / ROLLBACK_TICK_PERIOD + 1);
+	memset(mPhaseSeconds, 0, sizeof(mPhaseSeconds));
+	mAllocationCount = 0;
+
+	mResult = {};
+	mResult.poolScale = mPoolScale;
+	mResult.tickCount = mTickCount;
+
+	//   ũ⸦ ̸  д. ƼŬ 鼭 ŰŸ þ ٽ Ҵ ʵ   ´.
+	mScene->SaveSnapshot(&mSnapshot);
+	mSnapshot.Reserve(mSnapshot.GetSize() * 2);
+
+	//  ǻ Ŭ̾Ʈ ϳ ƽ ¸ . Ǵ  ̴ Ŷ  ŭ ̸ ´.
+	const uint32_t netSlotCount = mScene->GetNetSlotCount();
+	const uint32_t netPendingCapacity = NetProtocol::GetChunkCount(netSlotCount) * 8 + 64;
+	const NetConditionDesc netCondition =
+	{
+		.lossRate = NET_LOSS_RATE,
+		.latencySeconds = NET_LATENCY_SECONDS,
+		.jitterSeconds = NET_JITTER_SECONDS,
+		.seed = Benchmark::SEED
+	};
+
+	mNetState.entities.resize(netSlotCount);
+	mbNetOpen = mNetServer.Initialize({ .slotCount = netSlotCount, .socket = { .port = 0, .pendingCapacity = netPendingCapacity, .condition = netCondition } })
+		and mNetClient.Initialize({ .slotCount = netSlotCount, .serverPort = mNetServer.GetPort(), .socket = { .port = 0, .pendingCapacity = netPendingCapacity, .condition = netCondition } });
+
+	mNetEncodeSeconds.clear();
+	mNetEncodeSeconds.reserve(mTickCount);
+	mNetDecodeSeconds.clear();
+	mNetDecodeSeconds.reserve(mTickCount);
+	mNetServerByteCount = 0;
+	mNetClientByteCount = 0;
+}
+
+void SceneBenchmark::Run()
+{
+	for (uint32_t i = 0; i < mWarmupTickCount + mTickCount; ++i)
+	{
+		if (i == mWarmupTickCount)
+		{
+			InputLatency::Get().Reset();
+		}
+
+		tick(i, i >= mWarmupTickCount);
+	}
+
+	//  ࿡  Ű  ʵ Է .
+	for (const uint32_t key : { uint32_t('W'), uint32_t('A'), uint32_t('S'), uint32_t('D'), uint32_t('E'), uint32_t('Q'), uint32_t('F'), uint32_t(VK_SPACE) })
+	{
+		Input::Get()._SetKeyState(key, false);
+	}
+	Input::Get()._SetMouseButtonState(Input::eMouseButton::Left, false);
+	Input::Get()._Clear();
+
+	std::vector<double> sorted = mTickSeconds;
+	std::sort(sorted.begin(), sorted.end());
+
+	double totalSeconds = 0.0;
+	for (const double seconds : sorted)
+	{
+		totalSeconds += seconds;
+	}
+
+	mResult.meanMicroseconds = totalSeconds * 1e6 / double(mTickCount);
+	mResult.p50Microseconds = getPercentile(sorted, 0.5) * 1e6;
+	mResult.p99Microseconds = getPercentile(sorted, 0.99) * 1e6;
+	mResult.maxMicroseconds = sorted.back() * 1e6;
+	mResult.meanAllocationCount = double(mAllocationCount) / double(mTickCount);
+
+	for (uint32_t phase = 0; phase < uint32_t(eScene_Phase::Count); ++phase)
+	{
+		mResult.phaseMeanMicroseconds[phase] = mPhaseSeconds[phase] * 1e6 / double(mTickCount);
+	}
+
+	const InputLatencyStatistics latency = InputLatency::Get().GetStatistics();
+	mResult.inputLatencySampleCount = latency.sampleCount;
+	mResult.inputLatencyP50Microseconds = latency.p50Milliseconds * 1e3;
+	mResult.inputLatencyP99Microseconds = latency.p99Milliseconds * 1e3;
+	mResult.inputLatencyMaxMicroseconds = latency.maxMilliseconds * 1e3;
+
+	std::sort(mSnapshotSeconds.begin(), mSnapshotSeconds.end());
+	std::sort(mRestoreSeconds.begin(), mRestoreSeconds.end());
+
+	mResult.snapshotBytes = mSnapshot.GetSize();
+	mResult.snapshotP50Microseconds = getPercentile(mSnapshotSeconds, 0.5) * 1e6;
+	mResult.snapshotP99Microseconds = getPercentile(mSnapshotSeconds, 0.99) * 1e6;
+	mResult.restoreP50Microseconds = getPercentile(mRestoreSeconds, 0.5) * 1e6;
+	mResult.restoreP99Microseconds = getPercentile(mRestoreSeconds, 0.99) * 1e6;
+
+	std::sort(mRollbackSeconds.begin(), mRollbackSeconds.end());
+
+	mResult.rollbackCount = uint32_t(mRollbackSeconds.size());
+	mResult.rollbackP50Microseconds = getPercentile(mRollbackSeconds, 0.5) * 1e6;
+	mResult.rollbackP99Microseconds = getPercentile(mRollbackSeconds, 0.99) * 1e6;
+
+	std::sort(mNetEncodeSeconds.begin(), mNetEncodeSeconds.end());
+	std::sort(mNetDecodeSeconds.begin(), mNetDecodeSeconds.end());
+
+	const uint64_t netChunkCount = mNetServer.GetDeltaChunkCount() + mNetServer.GetFullChunkCount();
+
+	mResult.netServerBytesPerTick = double(mNetServerByteCount) / double(mTickCount);
+	mResult.netClientBytesPerTick = double(mNetClientByteCount) / double(mTickCount);
+	mResult.netEncodeP50Microseconds = getPercentile(mNetEncodeSeconds, 0.5) * 1e6;
+	mResult.netEncodeP99Microseconds = getPercentile(mNetEncodeSeconds, 0.99) * 1e6;
+	mResult.netDecodeP50Microseconds = getPercentile(mNetDecodeSeconds, 0.5) * 1e6;
+	mResult.netDecodeP99Microseconds = getPercentile(mNetDecodeSeconds, 0.99) * 1e6;
+	mResult.netDeltaChunkRatio = netChunkCount > 0 ? double(mNetServer.GetDeltaChunkCount()) / double(netChunkCount) : 0.0;
+}
+
+void SceneBenchmark::Finalize()
+{
+	mNetClient.Finalize();
+	mNetServer.Finalize();
+	mbNetOpen = false;
+
+	mScene->Finalize();
+	RELEASE(mScene);
+
+	FrameAllocator::Get().Finalize();
+
+	RELEASE_D2D1(mDWriteFactory);
+	RELEASE_D2D1(mWICImagingFactory);
+	CoUninitialize();
+}
+
+const SceneBenchmarkResult& SceneBenchmark::GetResult() const
+{
+	return mResult;
+}
+
+const char* SceneBenchmark::GetPhaseName(const eScene_Phase phase)
+{
+	switch (phase)
+	{
+	case eScene_Phase::Input:
+		return "input";
+	case eScene_Phase::Hero:
+		return "hero";
+	case eScene_Phase::Bullet:
+		return "bullet";
+	case eScene_Phase::Spawn:
+		return "spawn";
+	case eScene_Phase::Monster:
+		return "monster";
+	case eScene_Phase::Separation:
+		return "separation";
+	case eScene_Phase::Effect:
+		return "effect";
+	case eScene_Phase::UI:
+		return "ui";
+	case eScene_Phase::Collision:
+		return "collision";
+	case eScene_Phase::Camera:
+		return "camera";
+	case eScene_Phase::Update:
+		return "update";
+	case eScene_Phase::Transform:
+		return "transform";
+	default:
+		ASSERT(false);
+		return "";
+	}
+}
+
+void SceneBenchmark::WriteJson(const std::filesystem::path& path, const std::vector<SceneBenchmarkResult>& results)
+{
+	std::ofstream file(path);
+
+	if (not file.is_open())
+	{
+		LOG("Failed to open %s", path.string().c_str());
+		return;
+	}
+
+	file << "{\n";
+	file << "\t\"seed\": " << Benchmark::SEED << ",\n";
+#if defined(_DEBUG)
+	file << "\t\"configuration\": \"Debug\",\n";
+#else
+	file << "\t\"configuration\": \"Release\",\n";
+#endif
+	file << "\t\"scenes\":\n\t[\n";
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const SceneBenchmarkResult& result = results[i];
+
+		file << "\t\t{\n";
+		file << "\t\t\t\"pool_scale\": { \"bullet\": " << result.poolScale.bullet
+			<< ", \"casing\": " << result.poolScale.casing
+			<< ", \"big_monster\": " << result.poolScale.bigMonster
+			<< ", \"run_monster\": " << result.poolScale.runMonster
+			<< ", \"slow_monster\": " << result.poolScale.slowMonster
+			<< ", \"particle\": " << result.poolScale.particle << " },\n";
+		file << "\t\t\t\"ticks\": " << result.tickCount << ",\n";
+		file << "\t\t\t\"max_monsters\": " << result.maxMonsterCount << ",\n";
+		file << "\t\t\t\"max_bullets\": " << result.maxBulletCount << ",\n";
+		file << "\t\t\t\"max_particles\": " << result.maxParticleCount << ",\n";
+		file << "\t\t\t\"mean_us\": " << result.meanMicroseconds << ",\n";
+		file << "\t\t\t\"p50_us\": " << result.p50Microseconds << ",\n";
+		file << "\t\t\t\"p99_us\": " << result.p99Microseconds << ",\n";
+		file << "\t\t\t\"max_us\": " << result.maxMicroseconds << ",\n";
+		file << "\t\t\t\"allocations_per_tick\": " << result.meanAllocationCount << ",\n";
+		file << "\t\t\t\"input_latency_samples\": " << result.inputLatencySampleCount << ",\n";
+		file << "\t\t\t\"input_latency_p50_us\": " << result.inputLatencyP50Microseconds << ",\n";
+		file << "\t\t\t\"input_latency_p99_us\": " << result.inputLatencyP99Microseconds << ",\n";
+		file << "\t\t\t\"input_latency_max_us\": " << result.inputLatencyMaxMicroseconds << ",\n";
+		file << "\t\t\t\"snapshot_bytes\": " << result.snapshotBytes << ",\n";
+		file << "\t\t\t\"snapshot_p50_us\": " << result.snapshotP50Microseconds << ",\n";
+		file << "\t\t\t\"snapshot_p99_us\": " << result.snapshotP99Microseconds << ",\n";
+		file << "\t\t\t\"restore_p50_us\": " << result.restoreP50Microseconds << ",\n";
+		file << "\t\t\t\"restore_p99_us\": " << result.restoreP99Microseconds << ",\n";
+		file << "\t\t\t\"rollback_ticks\": " << ROLLBACK_TICK_COUNT << ",\n";
+		file << "\t\t\t\"rollbacks\": " << result.rollbackCount << ",\n";
+		file << "\t\t\t\"rollback_p50_us\": " << result.rollbackP50Microseconds << ",\n";
+		file << "\t\t\t\"rollback_p99_us\": " << result.rollbackP99Microseconds << ",\n";
+		file << "\t\t\t\"rollback_mismatches\": " << result.rollbackMismatchCount << ",\n";
+		file << "\t\t\t\"net_server_bytes_per_tick\": " << result.netServerBytesPerTick << ",\n";
+		file << "\t\t\t\"net_client_bytes_per_tick\": " << result.netClientBytesPerTick << ",\n";
+		file << "\t\t\t\"net_encode_p50_us\": " << result.netEncodeP50Microseconds << ",\n";
+		file << "\t\t\t\"net_encode_p99_us\": " << result.netEncodeP99Microseconds << ",\n";
+		file << "\t\t\t\"net_decode_p50_us\": " << result.netDecodeP50Microseconds << ",\n";
+		file << "\t\t\t\"net_decode_p99_us\": " << result.netDecodeP99Microseconds << ",\n";
+		file << "\t\t\t\"net_delta_ratio\": " << result.netDeltaChunkRatio << ",\n";
+		file << "\t\t\t\"net_mismatches\": " << result.netMismatchCount << ",\n";
+		file << "\t\t\t\"phase_mean_us\": { ";
+
+		for (uint32_t phase = 0; phase < uint32_t(eScene_Phase::Count); ++phase)
+		{
+			file << "\"" << GetPhaseName(eScene_Phase(phase)) << "\": " << result.phaseMeanMicroseconds[phase]
+				<< (phase + 1 < uint32_t(eScene_Phase::Count) ? ", " : " }\n");
+		}
+
+		file << (i + 1 < results.size() ? "\t\t},\n" : "\t\t}\n");
+	}
+
+	file << "\t]\n}\n";
+}
+
+void SceneBenchmark::tick(const uint32_t tickIndex, const bool bMeasure)
+{
+	// ܰ踶 ð ,   ƽ Ѵ.
+	double phaseSeconds[uint32_t(eScene_Phase::Count)]{};
+	const uint64_t allocationCount = getAllocationCount();
+
+	// Core::Updateó ƽ  ũġ ٲ۴.
+	FrameAllocator::Get().BeginFrame();
+
+	const auto inputStartTime = steady_clock::now();
+	updateInput(tickIndex);
+	const auto updateStartTime = steady_clock::now();
+	phaseSeconds[uint32_t(eScene_Phase::Input)] = duration<double>(updateStartTime - inputStartTime).count();
+
+	// simulate ܰ MainScene .  ѹ ۿ  , , Է  ̴.
+	// ٽ  ư   ٲ ʰ ̾ ùķ̼Ѵ.
+	mScene->SetPhaseSeconds(&phaseSeconds[uint32_t(eScene_Phase::Hero)]);
+	mScene->Update(mDeltaTime);
+	mScene->SetPhaseSeconds(nullptr);
+
+	const auto updateEndTime = steady_clock::now();
+	double simulateSeconds = 0.0;
+
+	for (uint32_t phase = uint32_t(eScene_Phase::Hero); phase <= uint32_t(eScene_Phase::Camera); ++phase)
+	{
+		simulateSeconds += phaseSeconds[phase];
+	}
+
+	phaseSeconds[uint32_t(eScene_Phase::Update)] = duration<double>(updateEndTime - updateStartTime).count() - simulateSeconds;
+
+	// Core  Ʈ ڿ ϴ  Ѵ.   ʰ .
+	mScene->GetEntityWorldOrNull()->FlushCommands();
+	mScene->GetAudioEventBusOrNull()->DropPending();
+	mScene->GetSpriteHierarchyOrNull()->Update();
+
+	phaseSeconds[uint32_t(eScene_Phase::Transform)] = duration<double>(steady_clock::now() - updateEndTime).count();
+
+	// ׸ Ƿ ƽ ģ ð   .
+	InputLatency::Get().Present(steady_clock::now());
+	Input::Get()._Clear();
+
+	if (not bMeasure)
+	{
+		updateNet(tickIndex, false);
+		return;
+	}
+
+	mAllocationCount += getAllocationCount() - allocationCount;
+
+	double tickSeconds = 0.0;
+	for (uint32_t phase = 0; phase < uint32_t(eScene_Phase::Count); ++phase)
+	{
+		mPhaseSeconds[phase] += phaseSeconds[phase];
+		tickSeconds += phaseSeconds[phase];
+	}
+	mTickSeconds.push_back(tickSeconds);
+
+	// Ǯ  󸶳 á Բ Ѵ.
+	mScene->GetEntityWorldOrNull()->Query({ .include = EntityWorld::GetMask<ParticleComponent>(), .exclude = EntityWorld::GetMask<DisabledTag>() }, &mParticleChunks);
+
+	uint32_t particleCount = 0;
+	for (const EntityChunkView& chunk : mParticleChunks)
+	{
+		particleCount += chunk.GetCount();
+	}
+
+	mResult.maxMonsterCount = max(mResult.maxMonsterCount, mScene->GetActiveMonsterCount());
+	mResult.maxBulletCount = max(mResult.maxBulletCount, mScene->GetActiveBulletCount());
+	mResult.maxParticleCount = max(mResult.maxParticleCount, particleCount);
+
+	if (tickIndex % ROLLBACK_TICK_PERIOD == 0)
+	{
+		measureRollback();
+	}
+
+	measureSnapshot();
+	updateNet(tickIndex, true);
+}
+
+void SceneBenchmark::measureSnapshot()
+{
+	//   ¸ ǵǷ  ƽ  ٲ ʴ´.
+	const auto startTime = steady_clock::now();
+	mScene->SaveSnapshot(&mSnapshot);
+	const auto savedTime = steady_clock::now();
+	const bool bLoaded = mScene->LoadSnapshot(mSnapshot.GetData(), mSnapshot.GetSize());
+	const auto loadedTime = steady_clock::now();
+
+	ASSERT(bLoaded);
+
+	mSnapshotSeconds.push_back(duration<double>(savedTime - startTime).count());
+	mRestoreSeconds.push_back(duration<double>(loadedTime - savedTime).count());
+}
+
+void SceneBenchmark::measureRollback()
+{
+	//  F6  η ǰ´. ǰ  ¿ ٽ ùķ̼ ° Ʈ  ƾ Ѵ.
+	const auto startTime = steady_clock::now();
+	const bool bSame = mScene->Rollback(ROLLBACK_TICK_COUNT);
+	const auto endTime = steady_clock::now();
+
+	if (not bSame)
+	{
+		++mResult.rollbackMismatchCount;
+	}
+
+	mRollbackSeconds.push_back(duration<double>(endTime - startTime).count());
+}
+
+void SceneBenchmark::updateNet(const uint32_t tickIndex, const bool bMeasure)
+{
+	if (not mbNetOpen)
+	{
+		return;
+	}
+
+	const steady_clock::time_point now(duration_cast<steady_clock::duration>(duration<double>(double(tickIndex) * mDeltaTime)));
+	const uint64_t serverByteCount = mNetServer.GetSocketStatistics().sentByteCount;
+	const uint64_t clientByteCount = mNetClient.GetSocketStatistics().sentByteCount;
+
+	mNetServer.ReceivePackets();
+	mScene->CaptureNetState(&mNetState);
+	mNetState.tick = tickIndex + 1;
+
+	const auto encodeStartTime = steady_clock::now();
+	mNetServer.EncodeSnapshot(mNetState);
+	const auto encodeEndTime = steady_clock::now();
+
+	mNetServer.SendPackets(now);
+	mNetClient.ReceivePackets();
+
+	const auto decodeStartTime = steady_clock::now();
+	mNetClient.DecodeSnapshots();
+	const auto decodeEndTime = steady_clock::now();
+
+	mNetClient.SendPackets(now);
+
+	if (not bMeasure)
+	{
+		return;
+	}
+
+	mNetEncodeSeconds.push_back(duration<double>(encodeEndTime - encodeStartTime).count());
+	mNetDecodeSeconds.push_back(duration<double>(decodeEndTime - decodeStartTime).count());
+	mNetServerByteCount += mNetServer.GetSocketStatistics().sentByteCount - serverByteCount;
+	mNetClientByteCount += mNetClient.GetSocketStatistics().sentByteCount - clientByteCount;
+
+	// Ŭ̾Ʈ ǻ츰 ûũ   ƽ  ¿ ƾ Ѵ.
+	const std::vector<NetEntityState>& clientEntities = mNetClient.GetState().entities;
+	const uint32_t slotCount = uint32_t(clientEntities.size());
+
+	for (uint32_t chunkIndex = 0; chunkIndex < NetProtocol::GetChunkCount(slotCount); ++chunkIndex)
+	{
+		const NetEntityState* serverEntities = mNetServer.GetHistoryOrNull(mNetClient.GetChunkTick(chunkIndex));
+
+		if (serverEntities == nullptr)
+		{
+			continue;
+		}
+
+		const uint32_t slotBegin = chunkIndex * NetProtocol::SLOTS_PER_CHUNK;
+		const uint32_t slotEnd = min(slotBegin + NetProtocol::SLOTS_PER_CHUNK, slotCount);
+
+		if (memcmp(&clientEntities[slotBegin], &serverEntities[slotBegin], sizeof(NetEntityState) * (slotEnd - slotBegin)) != 0)
+		{
+			++mResult.netMismatchCount;
+		}
+	}
+}
+
+void SceneBenchmark::updateInput(const uint32_t tickIndex)
+{
+	Input& input = Input::Get();
+
+	// 簢 ׸ ̵Ѵ.
+	constexpr uint32_t MOVE_KEYS[] = { 'D', 'W', 'A', 'S' };
+	const uint32_t moveKey = MOVE_KEYS[(tickIndex / MOVE_TICK_COUNT) % 4];
+
+	for (const uint32_t key : MOVE_KEYS)
+	{
+		if (input.GetKey(key) != (key == moveKey))
+		{
+			pushKeyEvent(key, key == moveKey);
+		}
+	}
+
+	// ų Ű  ƽ ȸ .
+	const std::pair<uint32_t, uint32_t> skillKeys[] =
+	{
+		{ uint32_t(VK_SPACE), DASH_TICK_PERIOD },
+		{ uint32_t('F'), KILL_ALL_TICK_PERIOD },
+		{ uint32_t('Q'), ORBIT_TICK_PERIOD },
+		{ uint32_t('E'), SHIELD_TICK_PERIOD }
+	};
+
+	for (const std::pair<uint32_t, uint32_t>& skillKey : skillKeys)
+	{
+		const bool bPressed = tickIndex % skillKey.second == skillKey.second / 2;
+
+		if (input.GetKey(skillKey.first) != bPressed)
+		{
+			pushKeyEvent(skillKey.first, bPressed);
+		}
+	}
+
+	//  ư  ä 콺 ȭ ߽ ѷ . Է  絵 ֱ⸶  ƽ  ôٰ ٽ .
+	const bool bClicking = tickIndex % CLICK_TICK_PERIOD != CLICK_TICK_PERIOD - 1;
+
+	if (input.GetMouseButton(Input::eMouseButton::Left) != bClicking)
+	{
+		pushMouseButtonEvent(Input::eMouseButton::Left, bClicking);
+	}
+
+	const D2D1_POINT_2F screenCenter =
+	{
+		.x = (Constant::Get().GetWidth() - 1.0f) * 0.5f,
+		.y = (Constant::Get().GetHeight() - 1.0f) * 0.5f
+	};
+
+	const D2D1_POINT_2F mouseOffset = Math::RotateVector({ .x = MOUSE_RADIUS, .y = 0.0f }, MOUSE_DEGREE_PER_TICK * float(tickIndex));
+	input._PushEvent({ .timestamp = steady_clock::now(), .type = eInput_Event::MouseMove, .mousePosition = Math::AddVector(screenCenter, mouseOffset) });
+
+	// Coreó ƽ    ̺Ʈ   ݿѴ. MainScene::Update ùķ̼  Է ű.
+	input._ProcessEvents(steady_clock::now());
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Core/Helper.h"
+#include "Game/MainScene.h"
+
+// ũƮ Է ְ, MainScene::Update ȿ simulate ܰ    ϰ, Core Update ڿ ϴ  ϴ ̴.
+// Hero Camera eMainScene_Phase  .
+enum class eScene_Phase
+{
+	Input,
+	Hero,
+	Bullet,
+	Spawn,
+	Monster,
+	Separation,
+	Effect,
+	UI,
+	Collision,
+	Camera,
+	Update,
+	Transform,
+	Count
+};
+
+// poolScale MainScene Ǯ ũ   ϴ   Ѵ.
+struct SceneBenchmarkDesc
+{
+	const MainScenePoolScale poolScale;
+	const uint32_t warmupTickCount;
+	const uint32_t tickCount;
+	const float deltaTime;
+};
+
+struct SceneBenchmarkResult
+{
+	MainScenePoolScale poolScale;
+	uint32_t tickCount;
+
+	uint32_t maxMonsterCount;
+	uint32_t maxBulletCount;
+	uint32_t maxParticleCount;
+
+	double meanMicroseconds;
+	double p50Microseconds;
+	double p99Microseconds;
+	double maxMicroseconds;
+	double meanAllocationCount;
+	double phaseMeanMicroseconds[uint32_t(eScene_Phase::Count)];
+
+	// Ŭ ̺Ʈ   ù Ѿ  ƽ ĥ 
+	uint64_t inputLatencySampleCount;
+	double inputLatencyP50Microseconds;
+	double inputLatencyP99Microseconds;
+	double inputLatencyMaxMicroseconds;
+
+	// ϴ ƽ  ¸ ϰ ٷ ǵ.
+	uint64_t snapshotBytes;
+	double snapshotP50Microseconds;
+	double snapshotP99Microseconds;
+	double restoreP50Microseconds;
+	double restoreP99Microseconds;
+
+	//   ֱ⸶ MainScene::Rollback ROLLBACK_TICK_COUNT ƽ ǰ ٽ ùķ̼ ð. ǰ  ° ٸ mismatch .
+	// ð Ϸ յڷ ϴ    .
+	uint32_t rollbackCount;
+	double rollbackP50Microseconds;
+	double rollbackP99Microseconds;
+	uint32_t rollbackMismatchCount;
+
+	// սǰ  䳻   UDP Ŭ̾Ʈ ϳ ƽ ¸ . Ʈ   ƽ ̰, Ŭ̾Ʈ  Ȯ Ŷ̴.
+	// ǻ츰 ûũ   ƽ  ¿ ٸ mismatch .
+	double netServerBytesPerTick;
+	double netClientBytesPerTick;
+	double netEncodeP50Microseconds;
+	double netEncodeP99Microseconds;
+	double netDecodeP50Microseconds;
+	double netDecodeP99Microseconds;
+	double netDeltaChunkRatio;
+	uint32_t netMismatchCount;
+};
+
+//  Ÿ   MainScene 帮  Coreó ƽ UpdateѴ.
+// Է ƽ ȣ    õ带 Ƿ, Ŀ ̿    ִ.
+class SceneBenchmark final
+{
+public:
+	SceneBenchmark() = default;
+	SceneBenchmark(const SceneBenchmark&) = delete;
+	SceneBenchmark& operator=(const SceneBenchmark&) = delete;
+
+	void Initialize(const SceneBenchmarkDesc& desc);
+	void Run();
+	void Finalize();
+
+	[[nodiscard]] const SceneBenchmarkResult& GetResult() const;
+
+	[[nodiscard]] static const char* GetPhaseName(const eScene_Phase phase);
+	static void WriteJson(const std::filesystem::path& path, const std::vector<SceneBenchmarkResult>& results);
+
+public:
+	// MainScene  δ ƽ  ǰ´.
+	static constexpr uint32_t ROLLBACK_TICK_COUNT = MainScene::ROLLBACK_TICK_COUNT;
+
+private:
+	void tick(const uint32_t tickIndex, const bool bMeasure);
+	void measureSnapshot();
+	void measureRollback();
+	void updateNet(const uint32_t tickIndex, const bool bMeasure);
+	void updateInput(const uint32_t tickIndex);
+
+private:
+	MainScenePoolScale mPoolScale{};
+	uint32_t mWarmupTickCount = 0;
+	uint32_t mTickCount = 0;
+	float mDeltaTime = 0.0f;
+
+	// ؽó ũ   ũ⸦  ͸   Ÿ  ʴ´.
+	IWICImagingFactory* mWICImagingFactory = nullptr;
+	IDWriteFactory* mDWriteFactory = nullptr;
+	Helper mHelper{};
+
+	MainScene* mScene = nullptr;
+	std::pmr::vector<EntityChunkView> mParticleChunks{};
+
+	SnapshotWriter mSnapshot{};
+	std::vector<double> mSnapshotSeconds{};
+	std::vector<double> mRestoreSeconds{};
+	std::vector<double> mRollbackSeconds{};
+
+	NetServer mNetServer{};
+	NetClient mNetClient{};
+	bool mbNetOpen = false;
+	NetWorldState mNetState{};
+	std::vector<double> mNetEncodeSeconds{};
+	std::vector<double> mNetDecodeSeconds{};
+	uint64_t mNetServerByteCount = 0;
+	uint64_t mNetClientByteCount = 0;
+
+	std::vector<double> mTickSeconds{};
+	double mPhaseSeconds[uint32_t(eScene_Phase::Count)]{};
+	uint64_t mAllocationCount = 0;
+
+	SceneBenchmarkResult mResult{};
+};
\ No newline at end of file
@@ -0,0 +1,256 @@
+#include "pch.h"
+#include "Benchmark.h"
+
+#include "Core/CollisionWorld.h"
+#include "Core/FlowField.h"
+#include "Core/SpatialGrid.h"
+
+namespace
+{
+	// ׸   е   ׸   .
+	constexpr float AREA_PER_AGENT = 400.0f;
+	constexpr float CELL_SIZE = 40.0f;
+	constexpr float SEPARATION_RADIUS = 30.0f;
+	constexpr float AGENT_RADIUS = 8.0f;
+	constexpr float MAX_DISPLACEMENT = 4.0f;
+
+	constexpr float AREA_RADIUS = 200.0f;
+	constexpr uint32_t QUERY_CENTER_COUNT = 64;
+
+	// MainScene   ̴.
+	constexpr float FLOW_FIELD_INNER_RADIUS = 60.0f;
+	constexpr float FLOW_FIELD_OUTER_RADIUS = 700.0f;
+	constexpr float FLOW_FIELD_CELL_SIZE = 20.0f;
+
+	uint32_t gAgentCount = 0;
+	float gHalfExtent = 0.0f;
+	std::vector<D2D1_POINT_2F> gPositions{};
+	std::vector<D2D1_POINT_2F> gPrevPositions{};
+	std::pmr::vector<uint32_t> gIndices{};
+	D2D1_POINT_2F gQueryCenters[QUERY_CENTER_COUNT]{};
+
+	SpatialGrid gGrid{};
+	CollisionWorld gCollisionWorld{};
+	FlowField gFlowField{};
+
+	void setupAgents(const uint32_t agentCount)
+	{
+		gAgentCount = agentCount;
+		gHalfExtent = std::sqrt(float(agentCount) * AREA_PER_AGENT) * 0.5f;
+
+		gPositions.resize(agentCount);
+		gPrevPositions.resize(agentCount);
+		gIndices.reserve(agentCount);
+
+		for (uint32_t i = 0; i < agentCount; ++i)
+		{
+			gPositions[i] = Benchmark::GetRandomPoint(gHalfExtent);
+			gPrevPositions[i] = Math::SubtractVector(gPositions[i], Benchmark::GetRandomPoint(MAX_DISPLACEMENT));
+		}
+
+		for (D2D1_POINT_2F& center : gQueryCenters)
+		{
+			center = Benchmark::GetRandomPoint(gHalfExtent);
+		}
+
+		gGrid.Initialize
+		(
+			{
+				.center = {},
+				.halfExtent = gHalfExtent,
+				.cellSize = CELL_SIZE
+			}
+		);
+		gGrid.Build(gPositions.data(), agentCount);
+
+		gCollisionWorld.Initialize
+		(
+			{
+				.center = {},
+				.halfExtent = gHalfExtent,
+				.cellSize = CELL_SIZE
+			}
+		);
+	}
+
+	void setup1k()
+	{
+		setupAgents(1000);
+	}
+
+	void setup10k()
+	{
+		setupAgents(10000);
+	}
+
+	void setup50k()
+	{
+		setupAgents(50000);
+	}
+
+	void setupFlowField()
+	{
+		gFlowField.Initialize
+		(
+			{
+				.center = {},
+				.innerRadius = FLOW_FIELD_INNER_RADIUS,
+				.outerRadius = FLOW_FIELD_OUTER_RADIUS,
+				.cellSize = FLOW_FIELD_CELL_SIZE
+			}
+		);
+	}
+
+	// Ÿ ݺ   Űܼ Ź ʵ ü ٽ ϰ Ѵ.      ƽ  ð̴.
+	float benchmarkFlowFieldSetTarget(const uint32_t iterationCount)
+	{
+		constexpr float TARGET_RADIUS = (FLOW_FIELD_INNER_RADIUS + FLOW_FIELD_OUTER_RADIUS) * 0.5f;
+		//  밢   ׻ ٸ  Ѿ.
+		constexpr float DEGREE_PER_ITERATION = 360.0f * 1.5f * FLOW_FIELD_CELL_SIZE / (2.0f * Math::PI * TARGET_RADIUS);
+
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const D2D1_POINT_2F target = Math::RotateVector({ .x = TARGET_RADIUS, .y = 0.0f }, DEGREE_PER_ITERATION * float(i));
+			gFlowField.SetTarget(target);
+			sum += gFlowField.GetDirection({}).x;
+		}
+
+		return sum;
+	}
+
+	float benchmarkGridBuild(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			gGrid.Build(gPositions.data(), gAgentCount);
+			sum += float(gGrid.GetCount());
+		}
+
+		return sum;
+	}
+
+	// и ó ڸ   ׸񸶴 ̿ ã´.
+	float benchmarkSeparation(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			gGrid.Build(gPositions.data(), gAgentCount);
+
+			for (uint32_t agent = 0; agent < gAgentCount; ++agent)
+			{
+				gGrid.QueryCircle(gPositions[agent], SEPARATION_RADIUS, &gIndices);
+				sum += float(gIndices.size());
+			}
+		}
+
+		return sum;
+	}
+
+	float benchmarkQueryCircle(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			gGrid.QueryCircle(gQueryCenters[i % QUERY_CENTER_COUNT], AREA_RADIUS, &gIndices);
+			sum += float(gIndices.size());
+		}
+
+		return sum;
+	}
+
+	//    ׸ ˻ϴ ذ
+	float benchmarkQueryCircleBruteForce(const uint32_t iterationCount)
+	{
+		constexpr float RADIUS_SQUARED = AREA_RADIUS * AREA_RADIUS;
+
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			const D2D1_POINT_2F center = gQueryCenters[i % QUERY_CENTER_COUNT];
+			gIndices.clear();
+
+			for (uint32_t agent = 0; agent < gAgentCount; ++agent)
+			{
+				const D2D1_POINT_2F diff = Math::SubtractVector(gPositions[agent], center);
+
+				if (Math::DotProduct2D(diff, diff) <= RADIUS_SQUARED)
+				{
+					gIndices.push_back(agent);
+				}
+			}
+
+			sum += float(gIndices.size());
+		}
+
+		return sum;
+	}
+
+	//  ,  Ѿó θ ˻ϴ  浹ü ä.
+	float benchmarkCollisionWorld(const uint32_t iterationCount)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < iterationCount; ++i)
+		{
+			gCollisionWorld.Clear();
+
+			for (uint32_t agent = 0; agent < gAgentCount; ++agent)
+			{
+				const uint32_t layer = 1 << (agent & 1);
+
+				gCollisionWorld.AddCollider
+				(
+					{
+						.shape = eCollider_Shape::Circle,
+						.layer = layer,
+						.mask = layer ^ 3,
+						.prevPosition = gPrevPositions[agent],
+						.position = gPositions[agent],
+						.halfSize = { .width = AGENT_RADIUS, .height = AGENT_RADIUS },
+						.userData = &gPositions[agent]
+					}
+				);
+			}
+
+			gCollisionWorld.Update();
+			sum += float(gCollisionWorld.GetContacts().size());
+		}
+
+		return sum;
+	}
+}
+
+void RegisterSpatialBenchmarks(Benchmark* benchmark)
+{
+	ASSERT(benchmark != nullptr);
+
+	benchmark->Add({ .name = "SpatialGrid::Build/1k", .setup = setup1k, .function = benchmarkGridBuild });
+	benchmark->Add({ .name = "SpatialGrid::Build/10k", .setup = setup10k, .function = benchmarkGridBuild });
+	benchmark->Add({ .name = "SpatialGrid::Build/50k", .setup = setup50k, .function = benchmarkGridBuild });
+
+	benchmark->Add({ .name = "SpatialGrid::Separation/1k", .setup = setup1k, .function = benchmarkSeparation });
+	benchmark->Add({ .name = "SpatialGrid::Separation/10k", .setup = setup10k, .function = benchmarkSeparation });
+	benchmark->Add({ .name = "SpatialGrid::Separation/50k", .setup = setup50k, .function = benchmarkSeparation });
+
+	benchmark->Add({ .name = "SpatialGrid::QueryCircle/1k", .setup = setup1k, .function = benchmarkQueryCircle });
+	benchmark->Add({ .name = "SpatialGrid::QueryCircle/10k", .setup = setup10k, .function = benchmarkQueryCircle });
+	benchmark->Add({ .name = "SpatialGrid::QueryCircle/50k", .setup = setup50k, .function = benchmarkQueryCircle });
+
+	benchmark->Add({ .name = "BruteForce::QueryCircle/1k", .setup = setup1k, .function = benchmarkQueryCircleBruteForce });
+	benchmark->Add({ .name = "BruteForce::QueryCircle/10k", .setup = setup10k, .function = benchmarkQueryCircleBruteForce });
+	benchmark->Add({ .name = "BruteForce::QueryCircle/50k", .setup = setup50k, .function = benchmarkQueryCircleBruteForce });
+
+	benchmark->Add({ .name = "CollisionWorld::Update/1k", .setup = setup1k, .function = benchmarkCollisionWorld });
+	benchmark->Add({ .name = "CollisionWorld::Update/10k", .setup = setup10k, .function = benchmarkCollisionWorld });
+	benchmark->Add({ .name = "CollisionWorld::Update/50k", .setup = setup50k, .function = benchmarkCollisionWorld });
+
+	benchmark->Add({ .name = "FlowField::SetTarget", .setup = setupFlowField, .function = benchmarkFlowFieldSetTarget });
+}
@@ -0,0 +1,350 @@
+#include "pch.h"
+#include "AllocationTracker.h"
+
+namespace
+{
+	thread_local eAllocation_Zone gZone = eAllocation_Zone::Unknown;
+
+	//  ϴ   Ҵ ٽ ˻ ʴ´.
+	thread_local bool gbReporting = false;
+
+	// BeginFrame θ .  ε  Ҵ ⸸ ϰ ˻ ʴ´.
+	thread_local bool gbFrameThread = false;
+
+	void* allocate(const size_t size)
+	{
+		AllocationTracker::Get()._RecordAllocation(size);
+		return malloc(size == 0 ? 1 : size);
+	}
+
+	void* allocateAligned(const size_t size, const std::align_val_t alignment)
+	{
+		AllocationTracker::Get()._RecordAllocation(size);
+
+#if defined(_MSC_VER)
+		return _aligned_malloc(size == 0 ? 1 : size, size_t(alignment));
+#else
+		const size_t alignedSize = (max(size, size_t(1)) + size_t(alignment) - 1) & ~(size_t(alignment) - 1);
+		return std::aligned_alloc(size_t(alignment), alignedSize);
+#endif
+	}
+
+	void deallocate(void* memory)
+	{
+		if (memory == nullptr)
+		{
+			return;
+		}
+
+		AllocationTracker::Get()._RecordFree();
+		free(memory);
+	}
+
+	void deallocateAligned(void* memory)
+	{
+		if (memory == nullptr)
+		{
+			return;
+		}
+
+		AllocationTracker::Get()._RecordFree();
+
+#if defined(_MSC_VER)
+		_aligned_free(memory);
+#else
+		free(memory);
+#endif
+	}
+}
+
+AllocationTracker& AllocationTracker::Get()
+{
+	static AllocationTracker allocationTracker;
+	return allocationTracker;
+}
+
+void AllocationTracker::BeginFrame()
+{
+	gbFrameThread = true;
+
+	mFrameBeginStatistics = GetTotalStatistics();
+	mbInFrame.store(true, std::memory_order_relaxed);
+
+	if (mFrameCountSinceReset < STEADY_FRAME_COUNT)
+	{
+		++mFrameCountSinceReset;
+	}
+}
+
+void AllocationTracker::EndFrame()
+{
+	mbInFrame.store(false, std::memory_order_relaxed);
+
+	const AllocationStatistics total = GetTotalStatistics();
+	uint64_t frameAllocationCount = 0;
+
+	for (uint32_t zone = 0; zone < uint32_t(eAllocation_Zone::Count); ++zone)
+	{
+		mFrameStatistics.allocationCounts[zone] = total.allocationCounts[zone] - mFrameBeginStatistics.allocationCounts[zone];
+		mFrameStatistics.allocationBytes[zone] = total.allocationBytes[zone] - mFrameBeginStatistics.allocationBytes[zone];
+		frameAllocationCount += mFrameStatistics.allocationCounts[zone];
+	}
+
+	mFrameStatistics.freeCount = total.freeCount - mFrameBeginStatistics.freeCount;
+
+	if (IsSteadyState())
+	{
+		mSteadyFrameAllocationCount += frameAllocationCount;
+		mPeakSteadyFrameAllocationCount = max(mPeakSteadyFrameAllocationCount, frameAllocationCount);
+	}
+}
+
+void AllocationTracker::ResetSteadyState()
+{
+	mFrameCountSinceReset = 0;
+}
+
+bool AllocationTracker::IsSteadyState() const
+{
+	return mFrameCountSinceReset >= STEADY_FRAME_COUNT;
+}
+
+bool AllocationTracker::IsAssertEnabled() const
+{
+	return mbAssertEnabled.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::SetAssertEnabled(const bool bEnabled)
+{
+	mbAssertEnabled.store(bEnabled, std::memory_order_relaxed);
+}
+
+AllocationStatistics AllocationTracker::GetTotalStatistics() const
+{
+	AllocationStatistics statistics{};
+
+	for (uint32_t zone = 0; zone < uint32_t(eAllocation_Zone::Count); ++zone)
+	{
+		statistics.allocationCounts[zone] = mAllocationCounts[zone].load(std::memory_order_relaxed);
+		statistics.allocationBytes[zone] = mAllocationBytes[zone].load(std::memory_order_relaxed);
+	}
+
+	statistics.freeCount = mFreeCount.load(std::memory_order_relaxed);
+
+	return statistics;
+}
+
+const AllocationStatistics& AllocationTracker::GetFrameStatistics() const
+{
+	return mFrameStatistics;
+}
+
+uint64_t AllocationTracker::GetFrameAllocationCount() const
+{
+	uint64_t count = 0;
+
+	for (const uint64_t zoneCount : mFrameStatistics.allocationCounts)
+	{
+		count += zoneCount;
+	}
+
+	return count;
+}
+
+uint64_t AllocationTracker::GetFrameAllocationBytes() const
+{
+	uint64_t bytes = 0;
+
+	for (const uint64_t zoneBytes : mFrameStatistics.allocationBytes)
+	{
+		bytes += zoneBytes;
+	}
+
+	return bytes;
+}
+
+uint64_t AllocationTracker::GetSteadyFrameAllocationCount() const
+{
+	return mSteadyFrameAllocationCount;
+}
+
+uint64_t AllocationTracker::GetPeakSteadyFrameAllocationCount() const
+{
+	return mPeakSteadyFrameAllocationCount;
+}
+
+uint64_t AllocationTracker::GetViolationCount() const
+{
+	return mViolationCount.load(std::memory_order_relaxed);
+}
+
+const char* AllocationTracker::GetZoneName(const eAllocation_Zone zone)
+{
+	switch (zone)
+	{
+	case eAllocation_Zone::Unknown:
+		return "unknown";
+	case eAllocation_Zone::Scene:
+		return "scene";
+	case eAllocation_Zone::Update:
+		return "update";
+	case eAllocation_Zone::Draw:
+		return "draw";
+	case eAllocation_Zone::Label:
+		return "label";
+	default:
+		ASSERT(false);
+		return "";
+	}
+}
+
+void AllocationTracker::_RecordAllocation(const size_t size)
+{
+	const uint32_t zone = uint32_t(gZone);
+
+	mAllocationCounts[zone].fetch_add(1, std::memory_order_relaxed);
+	mAllocationBytes[zone].fetch_add(size, std::memory_order_relaxed);
+
+	//   ӿ Ҵϸ  ڸ  ȣ    ְ Ѵ.
+	if (gbFrameThread and not gbReporting
+		and mbAssertEnabled.load(std::memory_order_relaxed) and mbInFrame.load(std::memory_order_relaxed) and IsSteadyState())
+	{
+		gbReporting = true;
+
+		mViolationCount.fetch_add(1, std::memory_order_relaxed);
+		LOG("Allocated %zu bytes in a steady-state frame (zone: %s)", size, GetZoneName(gZone));
+		ASSERT(false);
+
+		gbReporting = false;
+	}
+}
+
+void AllocationTracker::_RecordFree()
+{
+	mFreeCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+AllocationZone::AllocationZone(const eAllocation_Zone zone)
+	: mPrevZone(gZone)
+{
+	gZone = zone;
+}
+
+AllocationZone::~AllocationZone()
+{
+	gZone = mPrevZone;
+}
+
+void* operator new(const size_t size)
+{
+	void* memory = allocate(size);
+
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+void* operator new[](const size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept
+{
+	return allocate(size);
+}
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept
+{
+	return allocate(size);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment)
+{
+	void* memory = allocateAligned(size, alignment);
+
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment)
+{
+	return operator new(size, alignment);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return allocateAligned(size, alignment);
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return allocateAligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept
+{
+	deallocate(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	deallocate(memory);
+}
+
+void operator delete(void* memory, const size_t) noexcept
+{
+	deallocate(memory);
+}
+
+void operator delete[](void* memory, const size_t) noexcept
+{
+	deallocate(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+	deallocate(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+	deallocate(memory);
+}
+
+void operator delete(void* memory, const std::align_val_t) noexcept
+{
+	deallocateAligned(memory);
+}
+
+void operator delete[](void* memory, const std::align_val_t) noexcept
+{
+	deallocateAligned(memory);
+}
+
+void operator delete(void* memory, const size_t, const std::align_val_t) noexcept
+{
+	deallocateAligned(memory);
+}
+
+void operator delete[](void* memory, const size_t, const std::align_val_t) noexcept
+{
+	deallocateAligned(memory);
+}
+
+void operator delete(void* memory, const std::align_val_t, const std::nothrow_t&) noexcept
+{
+	deallocateAligned(memory);
+}
+
+void operator delete[](void* memory, const std::align_val_t, const std::nothrow_t&) noexcept
+{
+	deallocateAligned(memory);
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+enum class eAllocation_Zone
+{
+	Unknown,
+	Scene,
+	Update,
+	Draw,
+	Label,
+	Count
+};
+
+struct AllocationStatistics
+{
+	uint64_t allocationCounts[uint32_t(eAllocation_Zone::Count)];
+	uint64_t allocationBytes[uint32_t(eAllocation_Zone::Count)];
+	uint64_t freeCount;
+};
+
+//  operator new/delete ٲ㼭  C++  Ҵ .
+// DirectWrite, WIC, FMODó ü Ҵڸ  ̺귯 Ҵ  ʴ´.
+class AllocationTracker final
+{
+public:
+	[[nodiscard]] static AllocationTracker& Get();
+
+	void BeginFrame();
+	void EndFrame();
+
+	//  ٲ  STEADY_FRAME_COUNT    · .
+	void ResetSteadyState();
+	[[nodiscard]] bool IsSteadyState() const;
+
+	[[nodiscard]] bool IsAssertEnabled() const;
+	void SetAssertEnabled(const bool bEnabled);
+
+	[[nodiscard]] AllocationStatistics GetTotalStatistics() const;
+	[[nodiscard]] const AllocationStatistics& GetFrameStatistics() const;
+	[[nodiscard]] uint64_t GetFrameAllocationCount() const;
+	[[nodiscard]] uint64_t GetFrameAllocationBytes() const;
+	[[nodiscard]] uint64_t GetSteadyFrameAllocationCount() const;
+	[[nodiscard]] uint64_t GetPeakSteadyFrameAllocationCount() const;
+
+	// ˻ 忡    Ҵ Ƚ
+	[[nodiscard]] uint64_t GetViolationCount() const;
+
+	[[nodiscard]] static const char* GetZoneName(const eAllocation_Zone zone);
+
+public:
+	void _RecordAllocation(const size_t size);
+	void _RecordFree();
+
+private:
+	AllocationTracker() = default;
+	AllocationTracker(const AllocationTracker&) = delete;
+	AllocationTracker& operator=(const AllocationTracker&) = delete;
+	~AllocationTracker() = default;
+
+private:
+	static constexpr uint32_t STEADY_FRAME_COUNT = 120;
+
+	std::atomic<uint64_t> mAllocationCounts[uint32_t(eAllocation_Zone::Count)]{};
+	std::atomic<uint64_t> mAllocationBytes[uint32_t(eAllocation_Zone::Count)]{};
+	std::atomic<uint64_t> mFreeCount = 0;
+	std::atomic<uint64_t> mViolationCount = 0;
+
+	//  忡 Ҵϸ鼭 д´. ˻  忡 ϹǷ Ʒ   常 д´.
+	std::atomic<bool> mbInFrame = false;
+	std::atomic<bool> mbAssertEnabled = false;
+
+	uint32_t mFrameCountSinceReset = 0;
+
+	AllocationStatistics mFrameBeginStatistics{};
+	AllocationStatistics mFrameStatistics{};
+	uint64_t mSteadyFrameAllocationCount = 0;
+	uint64_t mPeakSteadyFrameAllocationCount = 0;
+};
+
+//  Ҹ   Ҵ zone зѴ.
+class AllocationZone final
+{
+public:
+	explicit AllocationZone(const eAllocation_Zone zone);
+	AllocationZone(const AllocationZone&) = delete;
+	AllocationZone& operator=(const AllocationZone&) = delete;
+	~AllocationZone();
+
+private:
+	eAllocation_Zone mPrevZone;
+};
\ No newline at end of file
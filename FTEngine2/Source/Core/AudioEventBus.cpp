@@ -0,0 +1,201 @@
+#include "pch.h"
+#include "AudioEventBus.h"
+
+#include "Sound.h"
+
+void AudioEventBus::Initialize(const AudioEventBusDesc& desc)
+{
+	ASSERT(desc.maxPlayCountPerFrame > 0);
+	ASSERT(0.0f <= desc.minDistance and desc.minDistance < desc.maxDistance);
+	ASSERT(desc.panDistance > 0.0f);
+
+	mEvents.reserve(desc.eventCapacity);
+	mPendingIndices.reserve(desc.eventCapacity);
+	mMaxPlayCountPerFrame = desc.maxPlayCountPerFrame;
+
+	mMinDistance = desc.minDistance;
+	mMaxDistance = desc.maxDistance;
+	mPanDistance = desc.panDistance;
+
+	Clear();
+}
+
+uint32_t AudioEventBus::Register(const AudioEventDesc& desc)
+{
+	ASSERT(desc.sound != nullptr);
+	ASSERT(desc.coalesceTime >= 0.0f);
+
+	mEvents.push_back
+	(
+		{
+			.sound = desc.sound,
+			.coalesceTime = desc.coalesceTime,
+			.priority = desc.priority,
+			.readyTime = 0.0f,
+			.pendingCount = 0,
+			.position = {},
+			.distanceSquared = 0.0f,
+			.bAtListener = false,
+			.gain = 0.0f,
+			.pan = 0.0f
+		}
+	);
+
+	return uint32_t(mEvents.size() - 1);
+}
+
+void AudioEventBus::Clear()
+{
+	mEvents.clear();
+	mPendingIndices.clear();
+
+	mListenerPosition = {};
+
+	mTime = 0.0f;
+	mTriggerCount = 0;
+	mPlayCount = 0;
+	mCulledCount = 0;
+}
+
+void AudioEventBus::Trigger(const uint32_t eventIndex)
+{
+	add(eventIndex, mListenerPosition, -1.0f);
+}
+
+void AudioEventBus::Trigger(const uint32_t eventIndex, const D2D1_POINT_2F position)
+{
+	const float dx = position.x - mListenerPosition.x;
+	const float dy = position.y - mListenerPosition.y;
+
+	add(eventIndex, position, dx * dx + dy * dy);
+}
+
+void AudioEventBus::Flush(const float deltaTime, const D2D1_POINT_2F listenerPosition)
+{
+	mTime += deltaTime;
+	mListenerPosition = listenerPosition;
+	mTriggerCount = 0;
+	mPlayCount = 0;
+	mCulledCount = 0;
+
+	const float inverseRolloff = 1.0f / (mMaxDistance - mMinDistance);
+	const float inversePanDistance = 1.0f / mPanDistance;
+
+	//   ִ ͸ 踦 ؼ  .  ġ ð ̰ų 鸮  .
+	uint32_t readyCount = 0;
+
+	for (const uint32_t eventIndex : mPendingIndices)
+	{
+		Event& event = mEvents[eventIndex];
+		mTriggerCount += event.pendingCount;
+		event.pendingCount = 0;
+
+		if (event.readyTime > mTime)
+		{
+			continue;
+		}
+
+		if (event.bAtListener)
+		{
+			event.gain = 1.0f;
+			event.pan = 0.0f;
+		}
+		else
+		{
+			const float dx = event.position.x - listenerPosition.x;
+			const float dy = event.position.y - listenerPosition.y;
+			const float distance = std::sqrt(dx * dx + dy * dy);
+
+			event.gain = std::clamp(1.0f - (distance - mMinDistance) * inverseRolloff, 0.0f, 1.0f);
+			event.pan = std::clamp(dx * inversePanDistance, -1.0f, 1.0f);
+		}
+
+		if (event.gain < AUDIBLE_GAIN)
+		{
+			++mCulledCount;
+			continue;
+		}
+
+		mPendingIndices[readyCount] = eventIndex;
+		++readyCount;
+	}
+
+	//  ӿ   ִ    켱 .
+	if (readyCount > mMaxPlayCountPerFrame)
+	{
+		for (uint32_t i = 1; i < readyCount; ++i)
+		{
+			const uint32_t eventIndex = mPendingIndices[i];
+			const uint32_t priority = mEvents[eventIndex].priority;
+
+			uint32_t j = i;
+			for (; j > 0 and mEvents[mPendingIndices[j - 1]].priority < priority; --j)
+			{
+				mPendingIndices[j] = mPendingIndices[j - 1];
+			}
+
+			mPendingIndices[j] = eventIndex;
+		}
+
+		readyCount = mMaxPlayCountPerFrame;
+	}
+
+	for (uint32_t i = 0; i < readyCount; ++i)
+	{
+		Event& event = mEvents[mPendingIndices[i]];
+
+		event.sound->ReplayAt(event.gain, event.pan);
+		event.readyTime = mTime + event.coalesceTime;
+	}
+
+	mPlayCount = readyCount;
+	mPendingIndices.clear();
+}
+
+void AudioEventBus::DropPending()
+{
+	for (const uint32_t eventIndex : mPendingIndices)
+	{
+		mEvents[eventIndex].pendingCount = 0;
+	}
+
+	mPendingIndices.clear();
+}
+
+uint32_t AudioEventBus::GetTriggerCount() const
+{
+	return mTriggerCount;
+}
+
+uint32_t AudioEventBus::GetPlayCount() const
+{
+	return mPlayCount;
+}
+
+uint32_t AudioEventBus::GetCulledCount() const
+{
+	return mCulledCount;
+}
+
+void AudioEventBus::add(const uint32_t eventIndex, const D2D1_POINT_2F position, const float distanceSquared)
+{
+	ASSERT(eventIndex < mEvents.size());
+
+	Event& event = mEvents[eventIndex];
+
+	if (event.pendingCount == 0)
+	{
+		mPendingIndices.push_back(eventIndex);
+	}
+	else if (event.distanceSquared <= distanceSquared)
+	{
+		++event.pendingCount;
+		return;
+	}
+
+	// ġ  ƮŴ Ÿ  Ѱܼ  ġٵ  Ѵ.
+	++event.pendingCount;
+	event.position = position;
+	event.distanceSquared = distanceSquared;
+	event.bAtListener = distanceSquared < 0.0f;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+class Sound;
+
+struct AudioEventBusDesc
+{
+	const uint32_t eventCapacity;
+	const uint32_t maxPlayCountPerFrame;
+
+	// ġ ִ ƮŴ û(ī޶) Ÿ minDistance ״, maxDistance  ۾    ʴ´.
+	const float minDistance;
+	const float maxDistance;
+
+	// ûڿ η ̸ŭ   Ŀ 鸰.
+	const float panDistance;
+};
+
+struct AudioEventDesc
+{
+	Sound* sound;
+
+	//    ð ȿ ٽ  ƮŴ   ģ. ʴ  Ƚ 1 / coalesceTime ѵȴ.
+	const float coalesceTime;
+
+	//  ӿ   ִ    Ŭ  Ѵ.
+	const uint32_t priority;
+};
+
+//  ƮŸ    ξٰ Flush   Ѵ.
+//   Ӹ ִ   ϹǷ ƼƼ  þ     ʴ´.
+// ġ ִ ƮŴ Flush Ѳ  ¿ ġ ϰ, 鸮    ʴ´.
+class AudioEventBus final
+{
+public:
+	AudioEventBus() = default;
+	AudioEventBus(const AudioEventBus&) = delete;
+	AudioEventBus& operator=(const AudioEventBus&) = delete;
+
+	void Initialize(const AudioEventBusDesc& desc);
+
+	[[nodiscard]] uint32_t Register(const AudioEventDesc& desc);
+	void Clear();
+
+	// ġ  ƮŴ û ġ   .
+	void Trigger(const uint32_t eventIndex);
+	void Trigger(const uint32_t eventIndex, const D2D1_POINT_2F position);
+
+	void Flush(const float deltaTime, const D2D1_POINT_2F listenerPosition);
+
+	// ̹  ƽ ǰ ٽ ùķ̼ , ׵  ƮŸ  ʰ .
+	void DropPending();
+
+	//  Flush    Ʈ ,   , ־  
+	[[nodiscard]] uint32_t GetTriggerCount() const;
+	[[nodiscard]] uint32_t GetPlayCount() const;
+	[[nodiscard]] uint32_t GetCulledCount() const;
+
+private:
+	// ̺ ۰ Ǹ 鸮 ʴ  .
+	static constexpr float AUDIBLE_GAIN = 0.01f;
+
+	struct Event
+	{
+		Sound* sound;
+		float coalesceTime;
+		uint32_t priority;
+
+		//  ð  ٽ Ѵ.
+		float readyTime;
+		uint32_t pendingCount;
+
+		// ̹  Ʈ  ûڿ   ġ. ġ  ƮŰ ־ bAtListener .
+		D2D1_POINT_2F position;
+		float distanceSquared;
+		bool bAtListener;
+		float gain;
+		float pan;
+	};
+
+	void add(const uint32_t eventIndex, const D2D1_POINT_2F position, const float distanceSquared);
+
+private:
+	std::pmr::vector<Event> mEvents{};
+	std::pmr::vector<uint32_t> mPendingIndices{};
+	uint32_t mMaxPlayCountPerFrame = 0;
+
+	float mMinDistance = 0.0f;
+	float mMaxDistance = 0.0f;
+	float mPanDistance = 0.0f;
+
+	// Ʈų Ÿ    Flush û ġ .
+	D2D1_POINT_2F mListenerPosition{};
+
+	float mTime = 0.0f;
+	uint32_t mTriggerCount = 0;
+	uint32_t mPlayCount = 0;
+	uint32_t mCulledCount = 0;
+};
\ No newline at end of file
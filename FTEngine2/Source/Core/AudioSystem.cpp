@@ -0,0 +1,386 @@
+#include "pch.h"
+#include "AudioSystem.h"
+
+AudioSystem& AudioSystem::Get()
+{
+	static AudioSystem instance;
+	return instance;
+}
+
+void AudioSystem::Initialize(const AudioSystemDesc& desc)
+{
+	ASSERT(not mbRunning.load(std::memory_order_relaxed));
+	ASSERT(desc.channelCount > 0);
+
+	mFreeVoiceCount = MAX_VOICE_COUNT;
+	for (uint32_t i = 0; i < MAX_VOICE_COUNT; ++i)
+	{
+		//  ȣ  ֵ Ųٷ ״´.
+		mFreeVoices[i] = MAX_VOICE_COUNT - 1 - i;
+	}
+
+	mbReady.store(false, std::memory_order_relaxed);
+	mbRunning.store(true, std::memory_order_release);
+	mThread = std::thread(&AudioSystem::run, this, desc);
+
+	// FMOD::System  忡 Ƿ غ  ٸ.
+	while (not mbReady.load(std::memory_order_acquire))
+	{
+		std::this_thread::yield();
+	}
+}
+
+void AudioSystem::Finalize()
+{
+	if (not mbRunning.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	WaitIdle();
+
+	mbRunning.store(false, std::memory_order_release);
+	mThread.join();
+
+	mPushedCount = 0;
+	mExecutedCount.store(0, std::memory_order_relaxed);
+}
+
+uint32_t AudioSystem::CreateVoice()
+{
+	MASSERT(mFreeVoiceCount > 0, "带    ϴ.");
+
+	--mFreeVoiceCount;
+	const uint32_t voiceIndex = mFreeVoices[mFreeVoiceCount];
+
+	//  尡  ̽ ̿ ġ  ø   Ƿ 븦 ÷   .
+	++mVoiceGenerations[voiceIndex];
+
+	return voiceIndex;
+}
+
+void AudioSystem::DestroyVoice(const uint32_t voiceIndex)
+{
+	ASSERT(voiceIndex < MAX_VOICE_COUNT);
+	ASSERT(mFreeVoiceCount < MAX_VOICE_COUNT);
+
+	Push({ .type = eAudio_Command::Release, .voiceIndex = voiceIndex });
+
+	mFreeVoices[mFreeVoiceCount] = voiceIndex;
+	++mFreeVoiceCount;
+}
+
+void AudioSystem::Push(const AudioCommand& command)
+{
+	ASSERT(command.voiceIndex < MAX_VOICE_COUNT);
+
+	AudioCommand queuedCommand = command;
+	queuedCommand.generation = mVoiceGenerations[command.voiceIndex];
+
+	if (not mCommands.TryPush(queuedCommand))
+	{
+		++mStallCount;
+
+		do
+		{
+			std::this_thread::yield();
+		} while (not mCommands.TryPush(queuedCommand));
+	}
+
+	++mPushedCount;
+}
+
+void AudioSystem::WaitIdle()
+{
+	while (mExecutedCount.load(std::memory_order_acquire) != mPushedCount)
+	{
+		std::this_thread::yield();
+	}
+}
+
+uint32_t AudioSystem::GetLength(const uint32_t voiceIndex) const
+{
+	ASSERT(voiceIndex < MAX_VOICE_COUNT);
+
+	return readVoiceState(mVoiceStates[voiceIndex].length, voiceIndex);
+}
+
+uint32_t AudioSystem::GetPosition(const uint32_t voiceIndex) const
+{
+	ASSERT(voiceIndex < MAX_VOICE_COUNT);
+
+	return readVoiceState(mVoiceStates[voiceIndex].position, voiceIndex);
+}
+
+uint64_t AudioSystem::GetStallCount() const
+{
+	return mStallCount;
+}
+
+void AudioSystem::run(const AudioSystemDesc desc)
+{
+	//  常 FMOD θǷ FMOD   .
+	FC(FMOD::System_Create(&mSystem));
+
+	if (desc.bNullOutput)
+	{
+		FC(mSystem->setOutput(FMOD_OUTPUTTYPE_NOSOUND));
+	}
+
+	FC(mSystem->setStreamBufferSize(desc.streamBufferSize, FMOD_TIMEUNIT_RAWBYTES));
+	FC(mSystem->init(int(desc.channelCount), FMOD_INIT_THREAD_UNSAFE, nullptr));
+
+	mbReady.store(true, std::memory_order_release);
+
+	while (true)
+	{
+		// ߶ ȣ  о     ߸ ʰ óѴ.
+		const bool bRunning = mbRunning.load(std::memory_order_acquire);
+
+		AudioCommand command;
+		uint64_t executedCount = 0;
+
+		while (mCommands.TryPop(&command))
+		{
+			execute(command);
+			++executedCount;
+		}
+
+		if (executedCount > 0)
+		{
+			mExecutedCount.fetch_add(executedCount, std::memory_order_release);
+		}
+
+		updateOpeningStreams();
+		FC(mSystem->update());
+		publishPositions();
+
+		if (not bRunning)
+		{
+			break;
+		}
+
+		//  з ־  ʰ ٷ ٽ .
+		if (executedCount > 0)
+		{
+			continue;
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(UPDATE_INTERVAL_MILLISECONDS));
+	}
+
+	for (uint32_t i = 0; i < MAX_VOICE_COUNT; ++i)
+	{
+		execute({ .type = eAudio_Command::Release, .voiceIndex = i });
+	}
+
+	FC(mSystem->release());
+	mSystem = nullptr;
+}
+
+void AudioSystem::execute(const AudioCommand& command)
+{
+	const uint32_t voiceIndex = command.voiceIndex;
+	FMOD::Channel*& channel = mChannels[voiceIndex];
+
+	switch (command.type)
+	{
+	case eAudio_Command::Load:
+		load(command);
+		break;
+
+	case eAudio_Command::Play:
+		setPaused(voiceIndex, false);
+		break;
+
+	case eAudio_Command::Replay:
+		replay(voiceIndex, 1.0f, 0.0f);
+		break;
+
+	case eAudio_Command::ReplayAt:
+		replay(voiceIndex, command.volume, command.pan);
+		break;
+
+	case eAudio_Command::Pause:
+		setPaused(voiceIndex, true);
+		break;
+
+	case eAudio_Command::SetVolume:
+		mVolumes[voiceIndex] = command.volume;
+
+		if (channel != nullptr)
+		{
+			channel->setVolume(command.volume);
+		}
+		break;
+
+	case eAudio_Command::Release:
+		if (channel != nullptr)
+		{
+			channel->stop();
+			channel = nullptr;
+		}
+
+		if (mSounds[voiceIndex] != nullptr)
+		{
+			FC(mSounds[voiceIndex]->release());
+			mSounds[voiceIndex] = nullptr;
+		}
+
+		mbOpenings[voiceIndex] = false;
+		break;
+
+	default:
+		ASSERT(false);
+		break;
+	}
+}
+
+void AudioSystem::load(const AudioCommand& command)
+{
+	const uint32_t voiceIndex = command.voiceIndex;
+	FMOD::Sound*& sound = mSounds[voiceIndex];
+
+	ASSERT(sound == nullptr);
+	ASSERT(command.filename != nullptr);
+
+	mVolumes[voiceIndex] = command.volume;
+	mLoadedGenerations[voiceIndex] = command.generation;
+	mbPauseds[voiceIndex] = true;
+
+	const FMOD_MODE mode = not command.bLoop ? FMOD_DEFAULT : FMOD_LOOP_NORMAL;
+
+	if (command.bStream)
+	{
+		// ⸦ ٸ ʴ´. updateOpeningStreams   Ȯϰ ä .
+		FC(mSystem->createStream(command.filename, mode | FMOD_NONBLOCKING, nullptr, &sound));
+		MASSERT(sound != nullptr, "  ã  ϴ.");
+
+		mbOpenings[voiceIndex] = true;
+		return;
+	}
+
+	FC(mSystem->createSound(command.filename, mode, nullptr, &sound));
+	MASSERT(sound != nullptr, "  ã  ϴ.");
+
+	start(voiceIndex);
+}
+
+void AudioSystem::start(const uint32_t voiceIndex)
+{
+	FMOD::Sound* sound = mSounds[voiceIndex];
+	FMOD::Channel*& channel = mChannels[voiceIndex];
+
+	FC(mSystem->playSound(sound, nullptr, true, &channel));
+	channel->setVolume(mVolumes[voiceIndex]);
+
+	uint32_t length = 0;
+	FC(sound->getLength(&length, FMOD_TIMEUNIT_MS));
+	writeVoiceState(&mVoiceStates[voiceIndex].length, voiceIndex, length);
+
+	if (not mbPauseds[voiceIndex])
+	{
+		channel->setPaused(false);
+	}
+}
+
+void AudioSystem::replay(const uint32_t voiceIndex, const float gain, const float pan)
+{
+	FMOD::Sound* sound = mSounds[voiceIndex];
+	FMOD::Channel*& channel = mChannels[voiceIndex];
+
+	mbPauseds[voiceIndex] = false;
+
+	//   ̸   ó ȴ.
+	if (sound == nullptr or mbOpenings[voiceIndex])
+	{
+		return;
+	}
+
+	//   ϴ Ҹ  FMOD ä ŵ Ƿ, ׶ ä  ´.
+	bool bPlaying = false;
+	if (channel != nullptr and channel->isPlaying(&bPlaying) == FMOD_OK)
+	{
+		channel->setPosition(0, FMOD_TIMEUNIT_MS);
+	}
+	else
+	{
+		FC(mSystem->playSound(sound, nullptr, true, &channel));
+	}
+
+	channel->setVolume(mVolumes[voiceIndex] * gain);
+	channel->setPan(pan);
+	channel->setPaused(false);
+}
+
+void AudioSystem::setPaused(const uint32_t voiceIndex, const bool bPaused)
+{
+	mbPauseds[voiceIndex] = bPaused;
+
+	if (mChannels[voiceIndex] != nullptr)
+	{
+		mChannels[voiceIndex]->setPaused(bPaused);
+	}
+}
+
+void AudioSystem::updateOpeningStreams()
+{
+	for (uint32_t i = 0; i < MAX_VOICE_COUNT; ++i)
+	{
+		if (not mbOpenings[i])
+		{
+			continue;
+		}
+
+		FMOD_OPENSTATE openState = FMOD_OPENSTATE_LOADING;
+		FC(mSounds[i]->getOpenState(&openState, nullptr, nullptr, nullptr));
+
+		if (openState == FMOD_OPENSTATE_READY)
+		{
+			mbOpenings[i] = false;
+			start(i);
+		}
+		else if (openState == FMOD_OPENSTATE_ERROR)
+		{
+			LOG("Failed to open audio stream (voice %u)", i);
+			ASSERT(false);
+
+			mbOpenings[i] = false;
+		}
+	}
+}
+
+void AudioSystem::publishPositions()
+{
+	for (uint32_t i = 0; i < MAX_VOICE_COUNT; ++i)
+	{
+		if (mChannels[i] == nullptr)
+		{
+			continue;
+		}
+
+		uint32_t position = 0;
+		if (mChannels[i]->getPosition(&position, FMOD_TIMEUNIT_MS) == FMOD_OK)
+		{
+			writeVoiceState(&mVoiceStates[i].position, i, position);
+		}
+	}
+}
+
+uint32_t AudioSystem::readVoiceState(const std::atomic<uint64_t>& state, const uint32_t voiceIndex) const
+{
+	//  ̽   ø ʾ 0̴.
+	const uint64_t value = state.load(std::memory_order_relaxed);
+
+	if (uint32_t(value >> 32) != mVoiceGenerations[voiceIndex])
+	{
+		return 0;
+	}
+
+	return uint32_t(value);
+}
+
+void AudioSystem::writeVoiceState(std::atomic<uint64_t>* state, const uint32_t voiceIndex, const uint32_t milliseconds)
+{
+	state->store((uint64_t(mLoadedGenerations[voiceIndex]) << 32) | milliseconds, std::memory_order_relaxed);
+}
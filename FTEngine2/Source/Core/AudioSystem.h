@@ -0,0 +1,133 @@
+#pragma once
+
+#include "SpscQueue.h"
+
+struct AudioSystemDesc
+{
+	const uint32_t channelCount;
+
+	// Ʈ Ͽ ̸ о δ ũ(Ʈ)
+	const uint32_t streamBufferSize;
+
+	//  ġ  . Ҹ  ʴ ȯ濡 ġũ ׽Ʈ .
+	const bool bNullOutput;
+};
+
+enum class eAudio_Command
+{
+	Load,
+	Play,
+	Replay,
+
+	//  ¿ ġ ؼ ó ٽ Ѵ.
+	ReplayAt,
+	Pause,
+	SetVolume,
+	Release
+};
+
+struct AudioCommand
+{
+	eAudio_Command type;
+	uint32_t voiceIndex;
+	float volume;
+
+	// ReplayAt . volume    谪̰, pan -1() 1().
+	float pan;
+
+	// Load . ڿ Release ó   ־ Ѵ.
+	const char* filename;
+	bool bLoop;
+
+	//  ü ڵ  ʰ ϸ鼭 д´.  ͵  带  ʴ´.
+	bool bStream;
+
+	// Push ä.  尡 ø  ٿ, ȣ ٽ  ̽  ̽   ʰ Ѵ.
+	uint32_t generation;
+};
+
+//  尡 FMOD::System  ȥ θ.
+//    ť ֱ⸸ ϰ, ̿  ġ  尡 ÷   д´.
+class AudioSystem final
+{
+public:
+	static constexpr uint32_t MAX_VOICE_COUNT = 64;
+	static constexpr uint32_t INVALID_VOICE = UINT32_MAX;
+
+public:
+	[[nodiscard]] static AudioSystem& Get();
+
+	void Initialize(const AudioSystemDesc& desc);
+	void Finalize();
+
+	// Ʒ  忡 θ.
+	[[nodiscard]] uint32_t CreateVoice();
+	void DestroyVoice(const uint32_t voiceIndex);
+
+	// ť     尡   ٸ.
+	void Push(const AudioCommand& command);
+
+	//    尡  ó  ٸ.
+	void WaitIdle();
+
+	[[nodiscard]] uint32_t GetLength(const uint32_t voiceIndex) const;
+	[[nodiscard]] uint32_t GetPosition(const uint32_t voiceIndex) const;
+
+	// ť   ٸ Ƚ
+	[[nodiscard]] uint64_t GetStallCount() const;
+
+private:
+	AudioSystem() = default;
+	AudioSystem(const AudioSystem&) = delete;
+	AudioSystem& operator=(const AudioSystem&) = delete;
+	~AudioSystem() = default;
+
+	void run(const AudioSystemDesc desc);
+	void execute(const AudioCommand& command);
+	void load(const AudioCommand& command);
+	void start(const uint32_t voiceIndex);
+	void replay(const uint32_t voiceIndex, const float gain, const float pan);
+	void setPaused(const uint32_t voiceIndex, const bool bPaused);
+	void updateOpeningStreams();
+	void publishPositions();
+
+	[[nodiscard]] uint32_t readVoiceState(const std::atomic<uint64_t>& state, const uint32_t voiceIndex) const;
+	void writeVoiceState(std::atomic<uint64_t>* state, const uint32_t voiceIndex, const uint32_t milliseconds);
+
+private:
+	static constexpr uint32_t COMMAND_QUEUE_SIZE = 256;
+	static constexpr uint32_t UPDATE_INTERVAL_MILLISECONDS = 5;
+
+	//  32Ʈ  ø ̽ ̰, Ʒ 32Ʈ иʴ.
+	struct VoiceState
+	{
+		std::atomic<uint64_t> length;
+		std::atomic<uint64_t> position;
+	};
+
+	std::thread mThread{};
+	std::atomic<bool> mbRunning = false;
+	std::atomic<bool> mbReady = false;
+
+	SpscQueue<AudioCommand, COMMAND_QUEUE_SIZE> mCommands{};
+	std::atomic<uint64_t> mExecutedCount = 0;
+	VoiceState mVoiceStates[MAX_VOICE_COUNT]{};
+
+	//  常 .
+	uint64_t mPushedCount = 0;
+	uint64_t mStallCount = 0;
+	uint32_t mFreeVoices[MAX_VOICE_COUNT]{};
+	uint32_t mFreeVoiceCount = 0;
+	uint32_t mVoiceGenerations[MAX_VOICE_COUNT]{};
+
+	//  常 .
+	FMOD::System* mSystem = nullptr;
+	FMOD::Sound* mSounds[MAX_VOICE_COUNT]{};
+	FMOD::Channel* mChannels[MAX_VOICE_COUNT]{};
+	float mVolumes[MAX_VOICE_COUNT]{};
+	uint32_t mLoadedGenerations[MAX_VOICE_COUNT]{};
+
+	// Ʈ    /Ͻ  ⿡  ξٰ  Ѵ.
+	bool mbOpenings[MAX_VOICE_COUNT]{};
+	bool mbPauseds[MAX_VOICE_COUNT]{};
+};
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "pch.h"
+#include "BitStream.h"
+
+BitWriter::BitWriter(uint8_t* data, const uint32_t capacity)
+	: mData(data)
+	, mCapacity(capacity)
+{
+	ASSERT(data != nullptr);
+}
+
+void BitWriter::WriteBits(const uint32_t value, const uint32_t bitCount)
+{
+	ASSERT(bitCount <= 32);
+	ASSERT(bitCount == 32 or (value >> bitCount) == 0);
+
+	if (mbOverflowed)
+	{
+		return;
+	}
+
+	//  Ʈ ä, Ʈ   .
+	mScratch |= uint64_t(value) << mScratchBitCount;
+	mScratchBitCount += bitCount;
+
+	while (mScratchBitCount >= 8)
+	{
+		if (mByteCount == mCapacity)
+		{
+			mbOverflowed = true;
+			return;
+		}
+
+		mData[mByteCount] = uint8_t(mScratch);
+		++mByteCount;
+
+		mScratch >>= 8;
+		mScratchBitCount -= 8;
+	}
+}
+
+void BitWriter::WriteBool(const bool value)
+{
+	WriteBits(value ? 1 : 0, 1);
+}
+
+void BitWriter::WriteSigned(const int32_t value, const uint32_t bitCount)
+{
+	ASSERT(bitCount > 0 and bitCount <= 32);
+	ASSERT(bitCount == 32 or (value >= -(int64_t(1) << (bitCount - 1)) and value < (int64_t(1) << (bitCount - 1))));
+
+	const uint32_t mask = bitCount == 32 ? UINT32_MAX : (1u << bitCount) - 1;
+	WriteBits(uint32_t(value) & mask, bitCount);
+}
+
+uint32_t BitWriter::Flush()
+{
+	if (mScratchBitCount > 0 and not mbOverflowed)
+	{
+		if (mByteCount == mCapacity)
+		{
+			mbOverflowed = true;
+		}
+		else
+		{
+			mData[mByteCount] = uint8_t(mScratch);
+			++mByteCount;
+		}
+
+		mScratch = 0;
+		mScratchBitCount = 0;
+	}
+
+	return mByteCount;
+}
+
+uint32_t BitWriter::GetBitCount() const
+{
+	return mByteCount * 8 + mScratchBitCount;
+}
+
+bool BitWriter::IsOverflowed() const
+{
+	return mbOverflowed;
+}
+
+BitReader::BitReader(const uint8_t* data, const uint32_t size)
+	: mData(data)
+	, mSize(size)
+{
+	ASSERT(data != nullptr or size == 0);
+}
+
+uint32_t BitReader::ReadBits(const uint32_t bitCount)
+{
+	ASSERT(bitCount <= 32);
+
+	while (mScratchBitCount < bitCount)
+	{
+		if (mByteOffset == mSize)
+		{
+			mbOverflowed = true;
+			return 0;
+		}
+
+		mScratch |= uint64_t(mData[mByteOffset]) << mScratchBitCount;
+		++mByteOffset;
+		mScratchBitCount += 8;
+	}
+
+	const uint32_t value = uint32_t(mScratch & ((uint64_t(1) << bitCount) - 1));
+
+	mScratch >>= bitCount;
+	mScratchBitCount -= bitCount;
+
+	return value;
+}
+
+bool BitReader::ReadBool()
+{
+	return ReadBits(1) != 0;
+}
+
+int32_t BitReader::ReadSigned(const uint32_t bitCount)
+{
+	ASSERT(bitCount > 0 and bitCount <= 32);
+
+	const uint32_t value = ReadBits(bitCount);
+
+	// ȣ Ʈ  ä.
+	const uint32_t shift = 32 - bitCount;
+	return int32_t(value << shift) >> shift;
+}
+
+bool BitReader::IsOverflowed() const
+{
+	return mbOverflowed;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+//  ʿ Ʈ ŭ տ ̾ δ. ۴ ȣϴ   ־ Ҵ ʴ´.
+// 뷮    ʰ IsOverflowed .
+class BitWriter final
+{
+public:
+	BitWriter(uint8_t* data, const uint32_t capacity);
+	BitWriter(const BitWriter&) = delete;
+	BitWriter& operator=(const BitWriter&) = delete;
+
+	// bitCount 32 ̰ value  Ʈ 0̾ Ѵ.
+	void WriteBits(const uint32_t value, const uint32_t bitCount);
+	void WriteBool(const bool value);
+
+	// 2  bitCount Ʈ ´.  Ѵ  ȣϴ  ɷ Ѵ.
+	void WriteSigned(const int32_t value, const uint32_t bitCount);
+
+	//  Ʈ  Ʈ   Ʈ  ȯѴ.
+	[[nodiscard]] uint32_t Flush();
+
+	[[nodiscard]] uint32_t GetBitCount() const;
+	[[nodiscard]] bool IsOverflowed() const;
+
+private:
+	uint8_t* mData;
+	uint32_t mCapacity;
+	uint32_t mByteCount = 0;
+
+	//  Ʈ   Ʈ
+	uint64_t mScratch = 0;
+	uint32_t mScratchBitCount = 0;
+
+	bool mbOverflowed = false;
+};
+
+// BitWriter   д´.  Ѿ  0 ְ IsOverflowed .
+class BitReader final
+{
+public:
+	BitReader(const uint8_t* data, const uint32_t size);
+	BitReader(const BitReader&) = delete;
+	BitReader& operator=(const BitReader&) = delete;
+
+	[[nodiscard]] uint32_t ReadBits(const uint32_t bitCount);
+	[[nodiscard]] bool ReadBool();
+	[[nodiscard]] int32_t ReadSigned(const uint32_t bitCount);
+
+	[[nodiscard]] bool IsOverflowed() const;
+
+private:
+	const uint8_t* mData;
+	uint32_t mSize;
+	uint32_t mByteOffset = 0;
+
+	uint64_t mScratch = 0;
+	uint32_t mScratchBitCount = 0;
+
+	bool mbOverflowed = false;
+};
\ No newline at end of file
@@ -3,9 +3,10 @@
 class Camera final
 {
 public:
+	//  Ʈ    ֵ 縦  ʴ´.
 	Camera() = default;
-	Camera(const Camera&) = delete;
-	Camera& operator=(const Camera&) = delete;
+	Camera(const Camera&) = default;
+	Camera& operator=(const Camera&) = default;
 
 	[[nodiscard]] D2D1_POINT_2F GetPosition() const;
 	void SetPosition(const D2D1_POINT_2F position);
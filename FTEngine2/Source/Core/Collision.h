@@ -11,6 +11,11 @@ namespace Collision
 	inline bool IsCollidedCircleWithCircle(const D2D1_ELLIPSE lhs, const D2D1_ELLIPSE rhs);
 	inline bool DoLinesIntersect(Line line0, Line line1);
 
+	// ̵   ó  (0 ~ 1) outTime ȯѴ.
+	inline bool SweepLineWithSqure(const Line line, const D2D1_RECT_F rect, float* outTime);
+	inline bool SweepCircleWithCircle(const D2D1_ELLIPSE lhs, const D2D1_POINT_2F lhsDisplacement, const D2D1_ELLIPSE rhs, const D2D1_POINT_2F rhsDisplacement, float* outTime);
+	inline bool SweepSqureWithSqure(const D2D1_RECT_F lhs, const D2D1_POINT_2F lhsDisplacement, const D2D1_RECT_F rhs, const D2D1_POINT_2F rhsDisplacement, float* outTime);
+
 	bool IsCollidedSqureWithPoint(const D2D1_RECT_F rect, const D2D1_POINT_2F point)
 	{
 		const bool result = rect.left <= point.x and point.x <= rect.right
@@ -170,4 +175,124 @@ namespace Collision
 
 		return bIntersecting;
 	}
+
+	bool SweepLineWithSqure(const Line line, const D2D1_RECT_F rect, float* outTime)
+	{
+		ASSERT(outTime != nullptr);
+
+		const D2D1_POINT_2F direction = Math::SubtractVector(line.Point1, line.Point0);
+
+		const float origins[2] = { line.Point0.x, line.Point0.y };
+		const float directions[2] = { direction.x, direction.y };
+		const float mins[2] = { rect.left, rect.bottom };
+		const float maxs[2] = { rect.right, rect.top };
+
+		float enterTime = 0.0f;
+		float exitTime = 1.0f;
+
+		// ึ   ȿ ִ  ϰ,    ã´.
+		for (uint32_t axis = 0; axis < 2; ++axis)
+		{
+			if (std::abs(directions[axis]) < FLT_EPSILON)
+			{
+				if (origins[axis] < mins[axis] or origins[axis] > maxs[axis])
+				{
+					return false;
+				}
+
+				continue;
+			}
+
+			const float inverseDirection = 1.0f / directions[axis];
+			float nearTime = (mins[axis] - origins[axis]) * inverseDirection;
+			float farTime = (maxs[axis] - origins[axis]) * inverseDirection;
+
+			if (nearTime > farTime)
+			{
+				std::swap(nearTime, farTime);
+			}
+
+			enterTime = max(enterTime, nearTime);
+			exitTime = min(exitTime, farTime);
+
+			if (enterTime > exitTime)
+			{
+				return false;
+			}
+		}
+
+		*outTime = enterTime;
+
+		return true;
+	}
+
+	bool SweepCircleWithCircle(const D2D1_ELLIPSE lhs, const D2D1_POINT_2F lhsDisplacement, const D2D1_ELLIPSE rhs, const D2D1_POINT_2F rhsDisplacement, float* outTime)
+	{
+		ASSERT(outTime != nullptr);
+
+		// rhs  ִ   |s + vt| = r    ظ Ѵ.
+		const D2D1_POINT_2F s = Math::SubtractVector(lhs.point, rhs.point);
+		const D2D1_POINT_2F v = Math::SubtractVector(lhsDisplacement, rhsDisplacement);
+		const float radius = lhs.radiusX + rhs.radiusX;
+
+		const float c = Math::DotProduct2D(s, s) - radius * radius;
+		if (c <= 0.0f)
+		{
+			*outTime = 0.0f;
+			return true;
+		}
+
+		const float a = Math::DotProduct2D(v, v);
+		const float b = Math::DotProduct2D(s, v);
+
+		//  ְų ־ ̴.
+		if (a < FLT_EPSILON or b >= 0.0f)
+		{
+			return false;
+		}
+
+		const float discriminant = b * b - a * c;
+		if (discriminant < 0.0f)
+		{
+			return false;
+		}
+
+		const float time = (-b - std::sqrt(discriminant)) / a;
+		if (time > 1.0f)
+		{
+			return false;
+		}
+
+		*outTime = time;
+
+		return true;
+	}
+
+	bool SweepSqureWithSqure(const D2D1_RECT_F lhs, const D2D1_POINT_2F lhsDisplacement, const D2D1_RECT_F rhs, const D2D1_POINT_2F rhsDisplacement, float* outTime)
+	{
+		// rhs lhs ũ⸸ŭ ø, lhs ߽ ̴  ˻Ѵ.
+		const D2D1_SIZE_F halfSize =
+		{
+			.width = (lhs.right - lhs.left) * 0.5f,
+			.height = (lhs.top - lhs.bottom) * 0.5f
+		};
+
+		const D2D1_RECT_F expanded =
+		{
+			.left = rhs.left - halfSize.width,
+			.top = rhs.top + halfSize.height,
+			.right = rhs.right + halfSize.width,
+			.bottom = rhs.bottom - halfSize.height
+		};
+
+		const D2D1_POINT_2F center = { .x = lhs.left + halfSize.width, .y = lhs.bottom + halfSize.height };
+
+		const Line line =
+		{
+			.Point0 = center,
+			.Point1 = Math::AddVector(center, Math::SubtractVector(lhsDisplacement, rhsDisplacement))
+		};
+
+		return SweepLineWithSqure(line, expanded, outTime);
+	}
 }
\ No newline at end of file
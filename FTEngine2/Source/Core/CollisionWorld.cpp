@@ -0,0 +1,433 @@
+#include "pch.h"
+#include "CollisionWorld.h"
+
+#include "Collision.h"
+
+namespace
+{
+	D2D1_RECT_F getRect(const D2D1_POINT_2F position, const D2D1_SIZE_F halfSize)
+	{
+		const D2D1_RECT_F result =
+		{
+			.left = position.x - halfSize.width,
+			.top = position.y + halfSize.height,
+			.right = position.x + halfSize.width,
+			.bottom = position.y - halfSize.height
+		};
+
+		return result;
+	}
+
+	D2D1_ELLIPSE getCircle(const D2D1_POINT_2F position, const float radius)
+	{
+		const D2D1_ELLIPSE result =
+		{
+			.point = position,
+			.radiusX = radius,
+			.radiusY = radius
+		};
+
+		return result;
+	}
+
+	bool isOutside(const ColliderDesc& boundary, const D2D1_POINT_2F point)
+	{
+		const D2D1_POINT_2F toPoint = Math::SubtractVector(point, boundary.position);
+		const float radius = boundary.halfSize.width;
+
+		return Math::DotProduct2D(toPoint, toPoint) > radius * radius;
+	}
+
+	bool collideCircleWithCircle(const ColliderDesc& lhs, const ColliderDesc& rhs, float* outTime)
+	{
+		return Collision::SweepCircleWithCircle
+		(
+			getCircle(lhs.prevPosition, lhs.halfSize.width), Math::SubtractVector(lhs.position, lhs.prevPosition),
+			getCircle(rhs.prevPosition, rhs.halfSize.width), Math::SubtractVector(rhs.position, rhs.prevPosition),
+			outTime
+		);
+	}
+
+	bool collideCircleWithRect(const ColliderDesc& circle, const ColliderDesc& rect, float* outTime)
+	{
+		//    簢  Ѵ.
+		const float inscribedRadius = min(rect.halfSize.width, rect.halfSize.height);
+
+		if (Collision::SweepCircleWithCircle
+		(
+			getCircle(circle.prevPosition, circle.halfSize.width), Math::SubtractVector(circle.position, circle.prevPosition),
+			getCircle(rect.prevPosition, inscribedRadius), Math::SubtractVector(rect.position, rect.prevPosition),
+			outTime
+		))
+		{
+			return true;
+		}
+
+		// ̹ ƽ   簢    ˻Ѵ.
+		const D2D1_RECT_F bound = getRect(rect.position, rect.halfSize);
+		const D2D1_POINT_2F closest =
+		{
+			.x = std::clamp(circle.position.x, bound.left, bound.right),
+			.y = std::clamp(circle.position.y, bound.bottom, bound.top)
+		};
+
+		const D2D1_POINT_2F diff = Math::SubtractVector(circle.position, closest);
+		const float radius = circle.halfSize.width;
+
+		if (Math::DotProduct2D(diff, diff) > radius * radius)
+		{
+			return false;
+		}
+
+		*outTime = 1.0f;
+
+		return true;
+	}
+
+	bool collideCircleWithLine(const ColliderDesc& circle, const ColliderDesc& line, float* outTime)
+	{
+		//   ִ     0  ̵ ˻Ѵ.
+		const D2D1_POINT_2F circleDisplacement = Math::SubtractVector(circle.position, circle.prevPosition);
+		const D2D1_POINT_2F lineDisplacement = Math::SubtractVector(line.position, line.prevPosition);
+
+		return Collision::SweepCircleWithCircle
+		(
+			getCircle(line.prevPosition, 0.0f), Math::SubtractVector(lineDisplacement, circleDisplacement),
+			getCircle(circle.prevPosition, circle.halfSize.width), {},
+			outTime
+		);
+	}
+
+	bool collideCircleWithBoundary(const ColliderDesc& circle, const ColliderDesc& boundary, float* outTime)
+	{
+		const float distance = Math::GetVectorLength(Math::SubtractVector(circle.position, boundary.position));
+		if (distance + circle.halfSize.width <= boundary.halfSize.width)
+		{
+			return false;
+		}
+
+		*outTime = 1.0f;
+
+		return true;
+	}
+
+	bool collideRectWithRect(const ColliderDesc& lhs, const ColliderDesc& rhs, float* outTime)
+	{
+		return Collision::SweepSqureWithSqure
+		(
+			getRect(lhs.prevPosition, lhs.halfSize), Math::SubtractVector(lhs.position, lhs.prevPosition),
+			getRect(rhs.prevPosition, rhs.halfSize), Math::SubtractVector(rhs.position, rhs.prevPosition),
+			outTime
+		);
+	}
+
+	bool collideRectWithLine(const ColliderDesc& rect, const ColliderDesc& line, float* outTime)
+	{
+		// 簢  ִ     ̵ ˻Ѵ.
+		const D2D1_POINT_2F rectDisplacement = Math::SubtractVector(rect.position, rect.prevPosition);
+
+		const Line relativeLine =
+		{
+			.Point0 = line.prevPosition,
+			.Point1 = Math::SubtractVector(line.position, rectDisplacement)
+		};
+
+		return Collision::SweepLineWithSqure(relativeLine, getRect(rect.prevPosition, rect.halfSize), outTime);
+	}
+
+	bool collideRectWithBoundary(const ColliderDesc& rect, const ColliderDesc& boundary, float* outTime)
+	{
+		const D2D1_RECT_F bound = getRect(rect.position, rect.halfSize);
+
+		const bool bOutside = isOutside(boundary, { .x = bound.left, .y = bound.top })
+			or isOutside(boundary, { .x = bound.right, .y = bound.top })
+			or isOutside(boundary, { .x = bound.left, .y = bound.bottom })
+			or isOutside(boundary, { .x = bound.right, .y = bound.bottom });
+
+		if (not bOutside)
+		{
+			return false;
+		}
+
+		*outTime = 1.0f;
+
+		return true;
+	}
+
+	bool collideLineWithBoundary(const ColliderDesc& line, const ColliderDesc& boundary, float* outTime)
+	{
+		if (isOutside(boundary, line.prevPosition))
+		{
+			*outTime = 0.0f;
+			return true;
+		}
+
+		if (not isOutside(boundary, line.position))
+		{
+			return false;
+		}
+
+		// ȿ Ƿ    ū ̴.
+		const D2D1_POINT_2F s = Math::SubtractVector(line.prevPosition, boundary.position);
+		const D2D1_POINT_2F v = Math::SubtractVector(line.position, line.prevPosition);
+		const float radius = boundary.halfSize.width;
+
+		const float a = Math::DotProduct2D(v, v);
+		const float b = Math::DotProduct2D(s, v);
+		const float c = Math::DotProduct2D(s, s) - radius * radius;
+
+		*outTime = std::clamp((-b + std::sqrt(max(b * b - a * c, 0.0f))) / a, 0.0f, 1.0f);
+
+		return true;
+	}
+
+	bool collide(const ColliderDesc* lhs, const ColliderDesc* rhs, float* outTime)
+	{
+		//   Ͽ   δ.
+		if (lhs->shape > rhs->shape)
+		{
+			std::swap(lhs, rhs);
+		}
+
+		switch (lhs->shape)
+		{
+		case eCollider_Shape::Circle:
+			switch (rhs->shape)
+			{
+			case eCollider_Shape::Circle:
+				return collideCircleWithCircle(*lhs, *rhs, outTime);
+			case eCollider_Shape::Rect:
+				return collideCircleWithRect(*lhs, *rhs, outTime);
+			case eCollider_Shape::Line:
+				return collideCircleWithLine(*lhs, *rhs, outTime);
+			case eCollider_Shape::Boundary:
+				return collideCircleWithBoundary(*lhs, *rhs, outTime);
+			}
+			break;
+
+		case eCollider_Shape::Rect:
+			switch (rhs->shape)
+			{
+			case eCollider_Shape::Rect:
+				return collideRectWithRect(*lhs, *rhs, outTime);
+			case eCollider_Shape::Line:
+				return collideRectWithLine(*lhs, *rhs, outTime);
+			case eCollider_Shape::Boundary:
+				return collideRectWithBoundary(*lhs, *rhs, outTime);
+			default:
+				break;
+			}
+			break;
+
+		case eCollider_Shape::Line:
+			if (rhs->shape == eCollider_Shape::Boundary)
+			{
+				return collideLineWithBoundary(*lhs, *rhs, outTime);
+			}
+			break;
+
+		default:
+			break;
+		}
+
+		return false;
+	}
+
+	bool canCollide(const ColliderDesc& lhs, const ColliderDesc& rhs)
+	{
+		return (lhs.layer & rhs.mask) != 0 and (rhs.layer & lhs.mask) != 0;
+	}
+
+	bool isEarlierContact(const CollisionContact& lhs, const CollisionContact& rhs)
+	{
+		return lhs.time < rhs.time;
+	}
+}
+
+void CollisionWorld::Initialize(const CollisionWorldDesc& desc)
+{
+	mCellSize = desc.cellSize;
+
+	mGrid.Initialize
+	(
+		{
+			.center = desc.center,
+			.halfExtent = desc.halfExtent,
+			.cellSize = desc.cellSize
+		}
+	);
+
+	Clear();
+}
+
+void CollisionWorld::Clear()
+{
+	mColliders.clear();
+	mContacts.clear();
+}
+
+void CollisionWorld::AddCollider(const ColliderDesc& desc)
+{
+	ASSERT(desc.layer != 0);
+
+	mColliders.push_back(desc);
+}
+
+void CollisionWorld::Update()
+{
+	mContacts.clear();
+
+	const uint32_t count = uint32_t(mColliders.size());
+
+	mBounds.resize(count);
+	mCenters.resize(count);
+	mExtents.resize(count);
+
+	mSmallIndices.clear();
+	mSmallCenters.clear();
+	mLargeIndices.clear();
+	mBoundaryIndices.clear();
+
+	// ̹ ƽ   δ  зѴ.
+	//  ū ݶ̴ ڿ  ʰ  ˻Ѵ.
+	float maxSmallExtent = 0.0f;
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		const ColliderDesc& collider = mColliders[i];
+
+		if (collider.shape == eCollider_Shape::Boundary)
+		{
+			mBoundaryIndices.push_back(i);
+			continue;
+		}
+
+		const D2D1_SIZE_F halfSize = (collider.shape == eCollider_Shape::Line) ? D2D1_SIZE_F{}
+			: (collider.shape == eCollider_Shape::Circle) ? D2D1_SIZE_F{ .width = collider.halfSize.width, .height = collider.halfSize.width }
+			: collider.halfSize;
+
+		const D2D1_RECT_F bound =
+		{
+			.left = min(collider.prevPosition.x, collider.position.x) - halfSize.width,
+			.top = max(collider.prevPosition.y, collider.position.y) + halfSize.height,
+			.right = max(collider.prevPosition.x, collider.position.x) + halfSize.width,
+			.bottom = min(collider.prevPosition.y, collider.position.y) - halfSize.height
+		};
+
+		mBounds[i] = bound;
+		mCenters[i] = { .x = (bound.left + bound.right) * 0.5f, .y = (bound.top + bound.bottom) * 0.5f };
+		mExtents[i] = 0.5f * Math::GetVectorLength({ .x = bound.right - bound.left, .y = bound.top - bound.bottom });
+
+		if (mExtents[i] > mCellSize)
+		{
+			mLargeIndices.push_back(i);
+			continue;
+		}
+
+		mSmallIndices.push_back(i);
+		mSmallCenters.push_back(mCenters[i]);
+		maxSmallExtent = max(maxSmallExtent, mExtents[i]);
+	}
+
+	mGrid.Build(mSmallCenters.data(), uint32_t(mSmallCenters.size()));
+
+	//  ݶ̴ ˻Ѵ.     ˻Ѵ.
+	for (uint32_t i = 0; i < uint32_t(mSmallIndices.size()); ++i)
+	{
+		const uint32_t lhsIndex = mSmallIndices[i];
+		mGrid.QueryCircle(mCenters[lhsIndex], mExtents[lhsIndex] + maxSmallExtent, &mCandidates);
+
+		for (const uint32_t candidate : mCandidates)
+		{
+			if (candidate > i)
+			{
+				addContact(lhsIndex, mSmallIndices[candidate]);
+			}
+		}
+	}
+
+	// ū ݶ̴   ݶ̴ ٸ ū ݶ̴ ˻Ѵ.
+	for (uint32_t i = 0; i < uint32_t(mLargeIndices.size()); ++i)
+	{
+		const uint32_t lhsIndex = mLargeIndices[i];
+		mGrid.QueryCircle(mCenters[lhsIndex], mExtents[lhsIndex] + maxSmallExtent, &mCandidates);
+
+		for (const uint32_t candidate : mCandidates)
+		{
+			addContact(lhsIndex, mSmallIndices[candidate]);
+		}
+
+		for (uint32_t j = i + 1; j < uint32_t(mLargeIndices.size()); ++j)
+		{
+			addContact(lhsIndex, mLargeIndices[j]);
+		}
+	}
+
+	//   ݶ̴ ˻Ѵ.
+	for (const uint32_t boundaryIndex : mBoundaryIndices)
+	{
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (mColliders[i].shape != eCollider_Shape::Boundary)
+			{
+				addContact(boundaryIndex, i);
+			}
+		}
+	}
+
+	//   浹 óϵ Ѵ.
+	std::stable_sort(mContacts.begin(), mContacts.end(), isEarlierContact);
+}
+
+uint32_t CollisionWorld::GetColliderCount() const
+{
+	return uint32_t(mColliders.size());
+}
+
+const std::vector<CollisionContact>& CollisionWorld::GetContacts() const
+{
+	return mContacts;
+}
+
+void CollisionWorld::addContact(const uint32_t lhsIndex, const uint32_t rhsIndex)
+{
+	const ColliderDesc& lhs = mColliders[lhsIndex];
+	const ColliderDesc& rhs = mColliders[rhsIndex];
+
+	if (not canCollide(lhs, rhs))
+	{
+		return;
+	}
+
+	// 谡 ƴϸ   ġ  ȮѴ.
+	if (lhs.shape != eCollider_Shape::Boundary and rhs.shape != eCollider_Shape::Boundary)
+	{
+		const D2D1_RECT_F lhsBound = mBounds[lhsIndex];
+		const D2D1_RECT_F rhsBound = mBounds[rhsIndex];
+
+		if (lhsBound.right < rhsBound.left or rhsBound.right < lhsBound.left
+			or lhsBound.top < rhsBound.bottom or rhsBound.top < lhsBound.bottom)
+		{
+			return;
+		}
+	}
+
+	float time = 0.0f;
+	if (not collide(&lhs, &rhs, &time))
+	{
+		return;
+	}
+
+	const bool bSwap = (lhs.layer > rhs.layer);
+
+	const CollisionContact contact =
+	{
+		.lhs = bSwap ? rhs.userData : lhs.userData,
+		.rhs = bSwap ? lhs.userData : rhs.userData,
+		.lhsLayer = bSwap ? rhs.layer : lhs.layer,
+		.rhsLayer = bSwap ? lhs.layer : rhs.layer,
+		.time = time
+	};
+
+	mContacts.push_back(contact);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "SpatialGrid.h"
+
+enum class eCollider_Shape
+{
+	Circle,
+	Rect,
+	Line,
+	Boundary
+};
+
+// Circle Boundary  halfSize.width Ѵ.
+// Line prevPosition position ̴.
+// Boundary     浹Ѵ.
+struct ColliderDesc
+{
+	const eCollider_Shape shape;
+	const uint32_t layer;
+	const uint32_t mask;
+	const D2D1_POINT_2F prevPosition;
+	const D2D1_POINT_2F position;
+	const D2D1_SIZE_F halfSize;
+	void* userData;
+};
+
+// lhs ̾ Ʈ  ̴.
+struct CollisionContact
+{
+	void* lhs;
+	void* rhs;
+	uint32_t lhsLayer;
+	uint32_t rhsLayer;
+	float time;
+};
+
+struct CollisionWorldDesc
+{
+	const D2D1_POINT_2F center;
+	const float halfExtent;
+	const float cellSize;
+};
+
+class CollisionWorld final
+{
+public:
+	CollisionWorld() = default;
+	CollisionWorld(const CollisionWorld&) = delete;
+	CollisionWorld& operator=(const CollisionWorld&) = delete;
+
+	void Initialize(const CollisionWorldDesc& desc);
+
+	void Clear();
+	void AddCollider(const ColliderDesc& desc);
+	void Update();
+
+	[[nodiscard]] uint32_t GetColliderCount() const;
+	[[nodiscard]] const std::vector<CollisionContact>& GetContacts() const;
+
+private:
+	void addContact(const uint32_t lhsIndex, const uint32_t rhsIndex);
+
+private:
+	float mCellSize = 1.0f;
+	SpatialGrid mGrid{};
+
+	std::vector<ColliderDesc> mColliders{};
+	std::vector<D2D1_RECT_F> mBounds{};
+	std::vector<D2D1_POINT_2F> mCenters{};
+	std::vector<float> mExtents{};
+
+	std::vector<uint32_t> mSmallIndices{};
+	std::vector<D2D1_POINT_2F> mSmallCenters{};
+	std::vector<uint32_t> mLargeIndices{};
+	std::vector<uint32_t> mBoundaryIndices{};
+	std::pmr::vector<uint32_t> mCandidates{};
+
+	std::vector<CollisionContact> mContacts{};
+};
\ No newline at end of file
@@ -1,19 +1,42 @@
 #include "pch.h"
 #include "Core.h"
 
+#include "AllocationTracker.h"
+#include "AudioEventBus.h"
+#include "AudioSystem.h"
 #include "Camera.h"
 #include "Constant.h"
+#include "EntityComponents.h"
+#include "EntityWorld.h"
 #include "Font.h"
+#include "FrameAllocator.h"
+#include "HotReload.h"
+#include "Input.h"
+#include "InputLatency.h"
 #include "Label.h"
+#include "RenderQueue.h"
 #include "Sprite.h"
-#include "Texture.h"
+#include "SpriteHierarchy.h"
+#include "Telemetry.h"
 #include "Transformation.h"
 
 using namespace D2D1;
+using namespace std::chrono;
 
-void Core::Initialize(HWND hWnd, Scene* scene)
+namespace
 {
-	ASSERT(hWnd != nullptr and scene != nullptr);
+	// MainScene  ̳ʰ   ũ
+	constexpr size_t SCENE_ARENA_CAPACITY = 4 * 1024 * 1024;
+	constexpr size_t FRAME_ALLOCATOR_CAPACITY = 256 * 1024;
+	constexpr uint32_t RENDER_RECORD_CAPACITY = 16 * 1024;
+
+	//   Ʈ Ͽ   д ũ.  ̿  ̸ŭ ޸𸮿 д.
+	constexpr uint32_t STREAM_BUFFER_SIZE = 64 * 1024;
+}
+
+void Core::Initialize(HWND hWnd)
+{
+	ASSERT(hWnd != nullptr);
 
 	HR(CoInitialize(nullptr));
 	HR(D2D1CreateFactory(D2D1_FACTORY_TYPE_SINGLE_THREADED, &mFactory));
@@ -23,23 +46,89 @@ void Core::Initialize(HWND hWnd, Scene* scene)
 	D2D1_SIZE_U windowRect = { .width = UINT32(Constant::Get().GetWidth()), .height = UINT32(Constant::Get().GetHeight()) };
 	HR(mFactory->CreateHwndRenderTarget(D2D1::RenderTargetProperties(), D2D1::HwndRenderTargetProperties(hWnd, windowRect), &mRenderTarget));
 
-	FC(FMOD::System_Create(&mSoundSystem));
-	FC(mSoundSystem->init(32, FMOD_INIT_NORMAL, nullptr));
+	AudioSystem::Get().Initialize
+	(
+		{
+			.channelCount = 32,
+			.streamBufferSize = STREAM_BUFFER_SIZE,
+			.bNullOutput = false
+		}
+	);
+
+	mHelper._Initialize(mWICImagingFactory, mDwriteFactory, mRenderTarget);
 
-	mHelper._Initialize(mWICImagingFactory, mDwriteFactory, mRenderTarget, mSoundSystem);
+	// ڷƮ ̴ ȭ   ׸.
+	{
+		mTelemetryFont.Initialize(&mHelper, L"Consolas", 14.0f);
 
-	ChangeScene(scene);
+		mTelemetryLabel.SetFont(&mTelemetryFont);
+		mTelemetryLabel.SetUI(true);
+		mTelemetryLabel.SetCenter({ .x = -0.5f, .y = 0.5f });
+		mTelemetryLabel.SetPosition
+		(
+			{
+				.x = -Constant::Get().GetWidth() * 0.5f + 10.0f,
+				.y = Constant::Get().GetHeight() * 0.5f - 10.0f
+			}
+		);
+		mTelemetryLabel.SetActive(false);
+	}
+
+	mSceneArena.Initialize({ .capacity = SCENE_ARENA_CAPACITY });
+	FrameAllocator::Get().Initialize({ .capacity = FRAME_ALLOCATOR_CAPACITY });
+	mRenderQueue.Reserve(RENDER_RECORD_CAPACITY);
 }
 
 bool Core::Update(const float deltaTime)
 {
-	if (not mScene->Update(deltaTime))
+	// â ޽  Է   ݿѴ.
+	Input::Get()._ProcessEvents(steady_clock::now());
+
+	FrameAllocator::Get().BeginFrame();
+	AllocationTracker::Get().BeginFrame();
+
+	const auto updateStartTime = steady_clock::now();
+
 	{
-		return false;
+		AllocationZone zone(eAllocation_Zone::Update);
+
+		if (HotReload* hotReload = mScene->GetHotReloadOrNull(); hotReload != nullptr)
+		{
+			hotReload->Update(updateStartTime);
+		}
+
+		if (not mScene->Update(deltaTime))
+		{
+			AllocationTracker::Get().EndFrame();
+			return false;
+		}
+
+		if (EntityWorld* entityWorld = mScene->GetEntityWorldOrNull(); entityWorld != nullptr)
+		{
+			entityWorld->FlushCommands();
+		}
+
+		if (AudioEventBus* audioEventBus = mScene->GetAudioEventBusOrNull(); audioEventBus != nullptr)
+		{
+			const Camera* camera = mScene->GetCameraOrNull();
+			audioEventBus->Flush(deltaTime, camera != nullptr ? camera->GetPosition() : D2D1_POINT_2F{});
+		}
+
+		if (SpriteHierarchy* spriteHierarchy = mScene->GetSpriteHierarchyOrNull(); spriteHierarchy != nullptr)
+		{
+			spriteHierarchy->Update();
+		}
+
+		updateTelemetryOverlay(deltaTime);
 	}
 
+	const auto drawStartTime = steady_clock::now();
+	steady_clock::time_point presentStartTime;
+
 	// Draw
 	{
+		AllocationZone zone(eAllocation_Zone::Draw);
+
 		mRenderTarget->BeginDraw();
 		mRenderTarget->Clear(ColorF(ColorF::Black));
 
@@ -75,10 +164,28 @@ bool Core::Update(const float deltaTime)
 
 		mScene->PreDraw(view, viewForUI);
 
+		// ̹ ӿ ׸ ƼƼ ûũ    ΰ ̾ ɷ ׸.
+		mEntityChunks.clear();
+
+		if (const EntityWorld* entityWorld = mScene->GetEntityWorldOrNull(); entityWorld != nullptr)
+		{
+			entityWorld->Query
+			(
+				{
+					.include = EntityWorld::GetMask<TransformComponent, SpriteComponent>(),
+					.exclude = EntityWorld::GetMask<DisabledTag>()
+				},
+				&mEntityChunks
+			);
+		}
+
+		// ̴ Ʈ ƼƼ ׸  ڵ忡  , ڵ常 ʷ о ׸.
+		mRenderQueue.Clear();
+
 		const uint32_t spriteLayerCount = mScene->GetSpriteLayerCount();
 		for (uint32_t i = 0; i < spriteLayerCount; ++i)
 		{
-			const std::vector<Sprite*>* spriteLayer = mScene->GetSpriteLayer(i);
+			const std::pmr::vector<Sprite*>* spriteLayer = mScene->GetSpriteLayer(i);
 
 			for (const Sprite* sprite : *spriteLayer)
 			{
@@ -87,29 +194,35 @@ bool Core::Update(const float deltaTime)
 					continue;
 				}
 
-				Texture* texture = sprite->_GetTextureOrNull();
-				if (texture == nullptr)
-				{
-					continue;
-				}
+				mRenderQueue.Add
+				(
+					{
+						.texture = sprite->_GetTextureOrNull(),
+						.center = sprite->GetCenter(),
+						.position = sprite->GetWorldPosition(),
+						.angle = sprite->GetAngle(),
+						.scale = sprite->GetScale(),
+						.opacity = sprite->GetOpacity(),
+						.layer = i,
+						.bUI = sprite->IsUI()
+					}
+				);
+			}
 
-				ID2D1Bitmap* bitmap = texture->_GetBitmap();
+			addEntities(i);
+		}
 
-				D2D1_POINT_2F center = sprite->GetCenter();
-				center.x = -(center.x + 0.5f) * texture->GetWidth();
-				center.y = (center.y - 0.5f) * texture->GetHeight();
+		const RenderRecord* records = mRenderQueue.GetRecords();
+		const uint32_t recordCount = mRenderQueue.GetCount();
 
-				D2D1_POINT_2F position = sprite->GetPosition();
-				D2D1_SIZE_F scale = sprite->GetScale();
-				float angle = sprite->GetAngle();
-				float opacity = sprite->GetOpacity();
+		for (uint32_t i = 0; i < recordCount; ++i)
+		{
+			const RenderRecord& record = records[i];
 
-				Matrix3x2F worldView = Matrix3x2F::Translation(center.x, center.y) * Transformation::getWorldMatrix(position, angle, scale);
-				worldView = worldView * (sprite->IsUI() == false ? view : viewForUI);
-				mRenderTarget->SetTransform(worldView);
+			const Matrix3x2F worldView = mRenderQueue.GetWorldMatrix(record) * (mRenderQueue.IsUI(record) ? viewForUI : view);
+			mRenderTarget->SetTransform(worldView);
 
-				mRenderTarget->DrawBitmap(bitmap, nullptr, opacity, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR);
-			}
+			mRenderTarget->DrawBitmap(mRenderQueue.GetBitmap(record), nullptr, mRenderQueue.GetOpacity(record), D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR);
 		}
 
 		// Render labels
@@ -119,51 +232,38 @@ bool Core::Update(const float deltaTime)
 				HR(mRenderTarget->CreateSolidColorBrush(ColorF(1.0f, 1.0f, 1.0f), &mBrush));
 			}
 
-			D2D1_RECT_F drawArea = RectF(0.0f, 0.0f, float(Constant::Get().GetWidth()), float(Constant::Get().GetHeight()));
-
-			const std::vector<Label*>* lables = mScene->GetLabelsOrNull();
+			const std::pmr::vector<Label*>* lables = mScene->GetLabelsOrNull();
 			if (lables != nullptr)
 			{
 				for (const Label* label : *lables)
 				{
-					if (not label->IsActive())
-					{
-						continue;
-					}
-
-					Font* font = label->_GetFontOrNull();
-					if (font == nullptr)
-					{
-						continue;
-					}
-
-					IDWriteTextFormat* textFormat = font->_GetTextFormat();
-					const std::wstring& text = label->GetTextByWStr();
-
-					D2D1_POINT_2F center = label->GetCenter();
-					D2D1_SIZE_F textSize = label->GetTextSize();
-					center.x = -(center.x + 0.5f) * (textSize.width - 1.0f);
-					center.y = (center.y - 0.5f) * (textSize.height - 1.0f);
-
-					D2D1_POINT_2F position = label->GetPosition();
-					D2D1_SIZE_F scale = label->GetScale();
-					float angle = label->GetAngle();
-					float opacity = label->GetOpacity();
-
-					Matrix3x2F worldView = Matrix3x2F::Translation(center.x, center.y) * Transformation::getWorldMatrix(position, angle, scale);
-					worldView = worldView * (label->IsUI() == false ? view : viewForUI);
-					mRenderTarget->SetTransform(worldView);
-
-					mRenderTarget->DrawText(text.c_str(), UINT32(text.size()), textFormat, drawArea, mBrush);
+					drawLabel(*label, view, viewForUI);
 				}
 			}
 		}
 
 		mScene->PostDraw(view, viewForUI);
 
+		drawLabel(mTelemetryLabel, view, viewForUI);
+
+		presentStartTime = steady_clock::now();
 		HR(mRenderTarget->EndDraw());
 	}
 
+	const auto presentEndTime = steady_clock::now();
+	InputLatency::Get().Present(presentEndTime);
+
+	Telemetry::Get().RecordFrame
+	(
+		{
+			.updateSeconds = duration<float>(drawStartTime - updateStartTime).count(),
+			.drawSeconds = duration<float>(presentStartTime - drawStartTime).count(),
+			.presentSeconds = duration<float>(presentEndTime - presentStartTime).count()
+		}
+	);
+
+	AllocationTracker::Get().EndFrame();
+
 	return true;
 }
 
@@ -175,30 +275,174 @@ void Core::Finalize()
 	RELEASE_D2D1(mWICImagingFactory);
 
 	RELEASE_D2D1(mBrush);
+	mTelemetryFont.Finalize();
 
-	mScene->Finalize();
-	RELEASE(mScene);
+	finalizeScene();
+	mSceneArena.Finalize();
+	FrameAllocator::Get().Finalize();
+	AudioSystem::Get().Finalize();
 
 	CoUninitialize();
 }
 
-void Core::ChangeScene(Scene* scene)
+void Core::SetSceneType(const Scene::Type type)
 {
-	ASSERT(scene != nullptr);
+	mSceneType = type;
+}
 
-	if (mScene != nullptr)
+void Core::finalizeScene()
+{
+	if (mScene == nullptr)
 	{
-		mScene->Finalize();
-		RELEASE(mScene);
+		return;
 	}
 
+	LOG("Scene arena peak: %zu / %zu bytes (overflow %zu bytes)", mSceneArena.GetPeakBytes(), mSceneArena.GetCapacity(), mSceneArena.GetOverflowBytes());
+
+	//  ؽó ŰǷ  Բ .
+	mRenderQueue.ClearTextures();
+
+	//   ̳ʴ Ʒ Ƿ Ҹڸ θ Ʒ   .
+	mScene->Finalize();
+
+	//  尡  Sound   ̸    Ʒ  ʴ´.
+	AudioSystem::Get().WaitIdle();
+
+	mScene->~Scene();
+	mScene = nullptr;
+
+	mSceneArena.Release();
+}
+
+void Core::initializeScene(Scene* scene)
+{
+	ASSERT(scene != nullptr);
+
 	mScene = scene;
-	mScene->_Preinitialize(&mHelper);
+	mScene->_Preinitialize(&mHelper, &mSceneArena);
 	mScene->SetType(mSceneType);
 	mScene->Initialize();
 }
 
-void Core::SetSceneType(const Scene::Type type)
+void Core::addEntities(const uint32_t layer)
 {
-	mSceneType = type;
+	for (const EntityChunkView& chunk : mEntityChunks)
+	{
+		const TransformComponent* transforms = chunk.GetComponents<TransformComponent>();
+		const SpriteComponent* sprites = chunk.GetComponents<SpriteComponent>();
+
+		for (uint32_t i = 0; i < chunk.GetCount(); ++i)
+		{
+			const SpriteComponent& sprite = sprites[i];
+
+			if (sprite.layer != layer)
+			{
+				continue;
+			}
+
+			const TransformComponent& transform = transforms[i];
+
+			mRenderQueue.Add
+			(
+				{
+					.texture = sprite.texture,
+					.center = sprite.center,
+					.position = transform.position,
+					.angle = transform.angle,
+					.scale = transform.scale,
+					.opacity = sprite.opacity,
+					.layer = layer,
+					.bUI = sprite.bUI
+				}
+			);
+		}
+	}
+}
+
+void Core::drawLabel(const Label& label, const Matrix3x2F& view, const Matrix3x2F& viewForUI)
+{
+	if (not label.IsActive())
+	{
+		return;
+	}
+
+	Font* font = label._GetFontOrNull();
+	if (font == nullptr)
+	{
+		return;
+	}
+
+	D2D1_RECT_F drawArea = RectF(0.0f, 0.0f, float(Constant::Get().GetWidth()), float(Constant::Get().GetHeight()));
+
+	IDWriteTextFormat* textFormat = font->_GetTextFormat();
+	const std::wstring_view text = label.GetText();
+
+	D2D1_POINT_2F center = label.GetCenter();
+	D2D1_SIZE_F textSize = label.GetTextSize();
+	center.x = -(center.x + 0.5f) * (textSize.width - 1.0f);
+	center.y = (center.y - 0.5f) * (textSize.height - 1.0f);
+
+	D2D1_POINT_2F position = label.GetPosition();
+	D2D1_SIZE_F scale = label.GetScale();
+	float angle = label.GetAngle();
+	float opacity = label.GetOpacity();
+
+	Matrix3x2F worldView = Matrix3x2F::Translation(center.x, center.y) * Transformation::getWorldMatrix(position, angle, scale);
+	worldView = worldView * (label.IsUI() == false ? view : viewForUI);
+	mRenderTarget->SetTransform(worldView);
+
+	mRenderTarget->DrawText(text.data(), UINT32(text.size()), textFormat, drawArea, mBrush);
+}
+
+void Core::updateTelemetryOverlay(const float deltaTime)
+{
+	constexpr float REFRESH_TIME = 0.25f;
+
+	if (Input::Get().GetKeyDown(VK_F3))
+	{
+		mTelemetryLabel.SetActive(not mTelemetryLabel.IsActive());
+		mTelemetryRefreshTimer = REFRESH_TIME;
+	}
+
+	if (not mTelemetryLabel.IsActive())
+	{
+		return;
+	}
+
+	//  ũ⸦ ٽ   Ƿ REFRESH_TIME Ѵ.
+	mTelemetryRefreshTimer += deltaTime;
+	if (mTelemetryRefreshTimer < REFRESH_TIME)
+	{
+		return;
+	}
+
+	mTelemetryRefreshTimer = 0.0f;
+
+	const TelemetryStatistics statistics = Telemetry::Get().GetStatistics();
+
+	wchar_t text[512]{};
+	int length = swprintf_s(text, std::size(text), L"%-8s %7s %7s %7s %7s %7s\n", L"ms", L"p50", L"p95", L"p99", L"p99.9", L"max");
+
+	for (uint32_t phase = 0; phase < uint32_t(eTelemetry_Phase::Count); ++phase)
+	{
+		const TelemetryPhaseStatistics& phaseStatistics = statistics.phases[phase];
+
+		length += swprintf_s(text + length, std::size(text) - length, L"%-8S %7.2f %7.2f %7.2f %7.2f %7.2f\n",
+			Telemetry::GetPhaseName(eTelemetry_Phase(phase)),
+			phaseStatistics.p50Milliseconds, phaseStatistics.p95Milliseconds, phaseStatistics.p99Milliseconds,
+			phaseStatistics.p999Milliseconds, phaseStatistics.maxMilliseconds);
+	}
+
+	length += swprintf_s(text + length, std::size(text) - length, L"stutter  %u / %u (> %.1f ms), total %llu\n",
+		statistics.stutterCount, statistics.frameCount, Telemetry::Get().GetFrameBudget() * 1000.0f, statistics.totalStutterCount);
+
+	const AllocationTracker& allocationTracker = AllocationTracker::Get();
+	length += swprintf_s(text + length, std::size(text) - length, L"alloc    %llu (%llu bytes) / frame, steady peak %llu\n",
+		allocationTracker.GetFrameAllocationCount(), allocationTracker.GetFrameAllocationBytes(), allocationTracker.GetPeakSteadyFrameAllocationCount());
+
+	const FrameAllocator& frameAllocator = FrameAllocator::Get();
+	swprintf_s(text + length, std::size(text) - length, L"scratch  %zu / %zu bytes, peak %zu, overflow %llu frames",
+		frameAllocator.GetFrameUsedBytes(), frameAllocator.GetCapacity(), frameAllocator.GetPeakBytes(), frameAllocator.GetOverflowFrameCount());
+
+	mTelemetryLabel.SetText(text);
 }
@@ -1,6 +1,12 @@
 #pragma once
 
+#include "AllocationTracker.h"
+#include "EntityWorld.h"
+#include "Font.h"
 #include "Helper.h"
+#include "Label.h"
+#include "LinearArena.h"
+#include "RenderQueue.h"
 #include "Scene.h"
 
 class Core final
@@ -10,23 +16,62 @@ public:
 	Core(const Core&) = delete;
 	Core& operator=(const Core&) = delete;
 
-	void Initialize(HWND hWnd, Scene* scene);
+	void Initialize(HWND hWnd);
 	bool Update(const float deltaTime);
 	void Finalize();
 
-	void ChangeScene(Scene* scene);
+	//   ϰ  Ʒ  , Ʒ args T .
+	template <typename T, typename... Args>
+	void ChangeScene(const Args&... args);
 	void SetSceneType(const Scene::Type type);
 
+private:
+	void finalizeScene();
+	void initializeScene(Scene* scene);
+
+	void addEntities(const uint32_t layer);
+	void drawLabel(const Label& label, const D2D1::Matrix3x2F& view, const D2D1::Matrix3x2F& viewForUI);
+	void updateTelemetryOverlay(const float deltaTime);
+
 private:
 	ID2D1Factory* mFactory = nullptr;
 	IWICImagingFactory* mWICImagingFactory = nullptr;
 	IDWriteFactory* mDwriteFactory = nullptr;
 	ID2D1HwndRenderTarget* mRenderTarget = nullptr;
-	FMOD::System* mSoundSystem = nullptr;
 	ID2D1SolidColorBrush* mBrush = nullptr;
 
 	Helper mHelper{};
 	Scene* mScene = nullptr;
+	LinearArena mSceneArena{};
 
 	Scene::Type mSceneType{};
-};
\ No newline at end of file
+
+	// ׸ ƼƼ ûũ. Ӹ ٽ ä 뷮 Ѵ.
+	std::pmr::vector<EntityChunkView> mEntityChunks{};
+	RenderQueue mRenderQueue{};
+
+	// F3  ð 踦 ȭ鿡 .
+	Font mTelemetryFont{};
+	Label mTelemetryLabel{};
+	float mTelemetryRefreshTimer = 0.0f;
+};
+
+template <typename T, typename... Args>
+void Core::ChangeScene(const Args&... args)
+{
+	static_assert(std::is_base_of_v<Scene, T>);
+
+	//   ʱȭϴ Ҵ  Ҵ  .
+	AllocationZone zone(eAllocation_Zone::Scene);
+	AllocationTracker::Get().ResetSteadyState();
+
+	finalizeScene();
+
+	//  ʱȭϴ  ⺻ pmr ҽ  Ʒ ٲ㼭  pmr ̳ʵ Ʒ Ҵϰ Ѵ.
+	std::pmr::memory_resource* prevResource = std::pmr::set_default_resource(&mSceneArena);
+
+	void* memory = mSceneArena.allocate(sizeof(T), alignof(T));
+	initializeScene(new (memory) T(args...));
+
+	std::pmr::set_default_resource(prevResource);
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+class Texture;
+
+// Core ׸ ƼƼ Ʈ. TransformComponent SpriteComponent ְ DisabledTag  ƼƼ ׸.
+struct TransformComponent
+{
+	D2D1_POINT_2F position;
+	float angle;
+	D2D1_SIZE_F scale;
+};
+
+struct SpriteComponent
+{
+	Texture* texture;
+	D2D1_POINT_2F center;
+	float opacity;
+
+	//  ȣ Ʈ ̾ ׸ Ŀ ׸.
+	uint32_t layer;
+	bool bUI;
+};
+
+struct DisabledTag
+{
+};
\ No newline at end of file
@@ -0,0 +1,536 @@
+#include "pch.h"
+#include "EntityWorld.h"
+#include "Snapshot.h"
+
+namespace
+{
+	struct ComponentTypeInfo
+	{
+		uint32_t size;
+		uint32_t alignment;
+	};
+
+	ComponentTypeInfo gComponentTypes[EntityWorld::MAX_COMPONENT_TYPE_COUNT]{};
+	uint32_t gComponentTypeCount = 0;
+
+	uint32_t alignOffset(const uint32_t offset, const uint32_t alignment)
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	// ûũ ϳ capacity   Ʈ 迭  ġ ϰ, ûũ  ش.
+	bool layoutChunk(const ComponentMask mask, const uint32_t capacity, uint32_t* outOffsets)
+	{
+		uint32_t offset = uint32_t(sizeof(Entity)) * capacity;
+
+		for (ComponentMask bits = mask; bits != 0; bits &= bits - 1)
+		{
+			const uint32_t componentTypeId = uint32_t(std::countr_zero(bits));
+			const ComponentTypeInfo& info = gComponentTypes[componentTypeId];
+
+			if (info.size == 0)
+			{
+				outOffsets[componentTypeId] = 0;
+				continue;
+			}
+
+			offset = alignOffset(offset, info.alignment);
+			outOffsets[componentTypeId] = offset;
+			offset += info.size * capacity;
+		}
+
+		return offset <= EntityWorld::CHUNK_SIZE;
+	}
+}
+
+EntityChunkView::EntityChunkView(uint8_t* memory, const uint32_t* offsets, const uint32_t count)
+	: mMemory(memory)
+	, mOffsets(offsets)
+	, mCount(count)
+{
+}
+
+uint32_t EntityChunkView::GetCount() const
+{
+	return mCount;
+}
+
+const Entity* EntityChunkView::GetEntities() const
+{
+	return reinterpret_cast<const Entity*>(mMemory);
+}
+
+EntityWorld::~EntityWorld()
+{
+	Finalize();
+}
+
+void EntityWorld::Finalize()
+{
+	std::pmr::memory_resource* memoryResource = mArchetypes.get_allocator().resource();
+
+	for (Archetype& archetype : mArchetypes)
+	{
+		for (uint8_t* chunk : archetype.chunks)
+		{
+			memoryResource->deallocate(chunk, CHUNK_SIZE, alignof(std::max_align_t));
+		}
+	}
+
+	mArchetypes.clear();
+	mRecords.clear();
+	mFreeIndices.clear();
+	mEntityCount = 0;
+
+	mCommands.clear();
+	mCommandData.clear();
+}
+
+Entity EntityWorld::Create(const ComponentMask mask)
+{
+	const Entity entity = allocateEntity();
+	place(entity, mask);
+
+	return entity;
+}
+
+void EntityWorld::Destroy(const Entity entity)
+{
+	ASSERT(IsAlive(entity));
+
+	EntityRecord& record = mRecords[entity.index];
+
+	if (record.archetypeIndex != PENDING_ARCHETYPE)
+	{
+		removeRow(record.archetypeIndex, record.row);
+	}
+
+	// 븦 ÷  ִ ڵ ̷   ̻  ȣ Ű ʰ Ѵ.
+	record.archetypeIndex = INVALID_ARCHETYPE;
+	++record.generation;
+	mFreeIndices.push_back(entity.index);
+	--mEntityCount;
+}
+
+bool EntityWorld::IsAlive(const Entity entity) const
+{
+	if (entity.index >= mRecords.size())
+	{
+		return false;
+	}
+
+	const EntityRecord& record = mRecords[entity.index];
+	return record.generation == entity.generation and record.archetypeIndex != INVALID_ARCHETYPE;
+}
+
+Entity EntityWorld::DeferCreate(const ComponentMask mask)
+{
+	const Entity entity = allocateEntity();
+	mRecords[entity.index].archetypeIndex = PENDING_ARCHETYPE;
+
+	mCommands.push_back({ .type = eEntity_Command::Create, .entity = entity, .mask = mask });
+
+	return entity;
+}
+
+void EntityWorld::DeferDestroy(const Entity entity)
+{
+	mCommands.push_back({ .type = eEntity_Command::Destroy, .entity = entity });
+}
+
+void EntityWorld::FlushCommands()
+{
+	for (const Command& command : mCommands)
+	{
+		// ռ ɿ  ƼƼ ǳʶڴ.
+		if (not IsAlive(command.entity))
+		{
+			continue;
+		}
+
+		switch (command.type)
+		{
+		case eEntity_Command::Create:
+			if (mRecords[command.entity.index].archetypeIndex == PENDING_ARCHETYPE)
+			{
+				place(command.entity, command.mask);
+			}
+			break;
+
+		case eEntity_Command::Destroy:
+			Destroy(command.entity);
+			break;
+
+		case eEntity_Command::Add:
+		{
+			void* memory = add(command.entity, command.componentTypeId);
+			const uint32_t size = gComponentTypes[command.componentTypeId].size;
+
+			if (size != 0)
+			{
+				memcpy(memory, mCommandData.data() + command.dataOffset, size);
+			}
+			break;
+		}
+
+		case eEntity_Command::Remove:
+			remove(command.entity, command.componentTypeId);
+			break;
+
+		default:
+			ASSERT(false);
+			break;
+		}
+	}
+
+	mCommands.clear();
+	mCommandData.clear();
+}
+
+void EntityWorld::Query(const EntityQueryDesc& desc, std::pmr::vector<EntityChunkView>* outChunks) const
+{
+	ASSERT(outChunks != nullptr);
+	ASSERT((desc.include & desc.exclude) == 0);
+
+	outChunks->clear();
+
+	for (const Archetype& archetype : mArchetypes)
+	{
+		if ((archetype.mask & desc.include) != desc.include or (archetype.mask & desc.exclude) != 0)
+		{
+			continue;
+		}
+
+		//  տ ƴ äǷ  ûũ  .
+		for (uint32_t row = 0; row < archetype.entityCount; row += archetype.chunkCapacity)
+		{
+			const uint32_t count = min(archetype.chunkCapacity, archetype.entityCount - row);
+			outChunks->emplace_back(archetype.chunks[row / archetype.chunkCapacity], archetype.offsets, count);
+		}
+	}
+}
+
+uint32_t EntityWorld::GetEntityCount() const
+{
+	return mEntityCount;
+}
+
+uint32_t EntityWorld::GetArchetypeCount() const
+{
+	return uint32_t(mArchetypes.size());
+}
+
+void EntityWorld::Save(SnapshotWriter* writer) const
+{
+	ASSERT(mCommands.empty());
+
+	writer->Write(uint32_t(mArchetypes.size()));
+
+	for (const Archetype& archetype : mArchetypes)
+	{
+		writer->Write(archetype.mask);
+		writer->Write(archetype.entityCount);
+
+		// ûũ ȿ Ʈ 迭 뷮ŭ  Ƿ  ûũ ° ´.
+		const uint32_t chunkCount = (archetype.entityCount + archetype.chunkCapacity - 1) / archetype.chunkCapacity;
+
+		for (uint32_t i = 0; i < chunkCount; ++i)
+		{
+			writer->WriteBytes(archetype.chunks[i], CHUNK_SIZE);
+		}
+	}
+
+	writer->Write(uint32_t(mRecords.size()));
+	writer->WriteArray(mRecords.data(), uint32_t(mRecords.size()));
+
+	writer->Write(uint32_t(mFreeIndices.size()));
+	writer->WriteArray(mFreeIndices.data(), uint32_t(mFreeIndices.size()));
+
+	writer->Write(mEntityCount);
+}
+
+void EntityWorld::Load(SnapshotReader* reader)
+{
+	ASSERT(mCommands.empty());
+
+	uint32_t archetypeCount = 0;
+	reader->Read(&archetypeCount);
+
+	for (uint32_t i = 0; i < archetypeCount; ++i)
+	{
+		ComponentMask mask = 0;
+		reader->Read(&mask);
+
+		// ŰŸ  Ƿ  ŰŸ   տ ִ.
+		const uint32_t archetypeIndex = findOrCreateArchetype(mask);
+		MASSERT(archetypeIndex == i, "ŰŸ   ٸϴ.");
+
+		Archetype& archetype = mArchetypes[archetypeIndex];
+		reader->Read(&archetype.entityCount);
+
+		const uint32_t chunkCount = (archetype.entityCount + archetype.chunkCapacity - 1) / archetype.chunkCapacity;
+
+		while (archetype.chunks.size() < chunkCount)
+		{
+			void* chunk = mArchetypes.get_allocator().resource()->allocate(CHUNK_SIZE, alignof(std::max_align_t));
+			archetype.chunks.push_back(static_cast<uint8_t*>(chunk));
+		}
+
+		for (uint32_t j = 0; j < chunkCount; ++j)
+		{
+			reader->ReadBytes(archetype.chunks[j], CHUNK_SIZE);
+		}
+	}
+
+	for (uint32_t i = archetypeCount; i < mArchetypes.size(); ++i)
+	{
+		mArchetypes[i].entityCount = 0;
+	}
+
+	uint32_t recordCount = 0;
+	reader->Read(&recordCount);
+	mRecords.resize(recordCount);
+	reader->ReadArray(mRecords.data(), recordCount);
+
+	uint32_t freeIndexCount = 0;
+	reader->Read(&freeIndexCount);
+	mFreeIndices.resize(freeIndexCount);
+	reader->ReadArray(mFreeIndices.data(), freeIndexCount);
+
+	reader->Read(&mEntityCount);
+}
+
+uint32_t EntityWorld::_RegisterComponentType(const uint32_t size, const uint32_t alignment)
+{
+	ASSERT(gComponentTypeCount < MAX_COMPONENT_TYPE_COUNT);
+	ASSERT(alignment <= alignof(std::max_align_t));
+
+	gComponentTypes[gComponentTypeCount] = { .size = size, .alignment = alignment };
+
+	return gComponentTypeCount++;
+}
+
+void* EntityWorld::add(const Entity entity, const uint32_t componentTypeId)
+{
+	ASSERT(IsAlive(entity));
+	ASSERT(mRecords[entity.index].archetypeIndex != PENDING_ARCHETYPE);
+
+	const ComponentMask bit = ComponentMask(1) << componentTypeId;
+	const ComponentMask mask = mArchetypes[mRecords[entity.index].archetypeIndex].mask;
+
+	if ((mask & bit) == 0)
+	{
+		move(entity, mask | bit);
+	}
+
+	const EntityRecord& record = mRecords[entity.index];
+	return getComponent(mArchetypes[record.archetypeIndex], record.row, componentTypeId);
+}
+
+void EntityWorld::remove(const Entity entity, const uint32_t componentTypeId)
+{
+	ASSERT(IsAlive(entity));
+	ASSERT(mRecords[entity.index].archetypeIndex != PENDING_ARCHETYPE);
+
+	const ComponentMask bit = ComponentMask(1) << componentTypeId;
+	const ComponentMask mask = mArchetypes[mRecords[entity.index].archetypeIndex].mask;
+
+	if ((mask & bit) != 0)
+	{
+		move(entity, mask & ~bit);
+	}
+}
+
+void* EntityWorld::getOrNull(const Entity entity, const uint32_t componentTypeId) const
+{
+	ASSERT(IsAlive(entity));
+
+	const EntityRecord& record = mRecords[entity.index];
+
+	if (record.archetypeIndex >= mArchetypes.size())
+	{
+		return nullptr;
+	}
+
+	const Archetype& archetype = mArchetypes[record.archetypeIndex];
+
+	if ((archetype.mask & (ComponentMask(1) << componentTypeId)) == 0)
+	{
+		return nullptr;
+	}
+
+	return getComponent(archetype, record.row, componentTypeId);
+}
+
+void EntityWorld::deferComponent(const eEntity_Command type, const Entity entity, const uint32_t componentTypeId, const void* data)
+{
+	const uint32_t dataOffset = uint32_t(mCommandData.size());
+
+	if (data != nullptr)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		mCommandData.insert(mCommandData.end(), bytes, bytes + gComponentTypes[componentTypeId].size);
+	}
+
+	mCommands.push_back({ .type = type, .entity = entity, .componentTypeId = componentTypeId, .dataOffset = dataOffset });
+}
+
+Entity EntityWorld::allocateEntity()
+{
+	++mEntityCount;
+
+	if (not mFreeIndices.empty())
+	{
+		const uint32_t index = mFreeIndices.back();
+		mFreeIndices.pop_back();
+
+		return { .index = index, .generation = mRecords[index].generation };
+	}
+
+	const uint32_t index = uint32_t(mRecords.size());
+	mRecords.push_back({ .archetypeIndex = INVALID_ARCHETYPE, .row = 0, .generation = 0 });
+
+	return { .index = index, .generation = 0 };
+}
+
+void EntityWorld::place(const Entity entity, const ComponentMask mask)
+{
+	const uint32_t archetypeIndex = findOrCreateArchetype(mask);
+	const uint32_t row = allocateRow(archetypeIndex, entity);
+	const Archetype& archetype = mArchetypes[archetypeIndex];
+
+	for (ComponentMask bits = mask; bits != 0; bits &= bits - 1)
+	{
+		const uint32_t componentTypeId = uint32_t(std::countr_zero(bits));
+		memset(getComponent(archetype, row, componentTypeId), 0, gComponentTypes[componentTypeId].size);
+	}
+
+	mRecords[entity.index].archetypeIndex = archetypeIndex;
+	mRecords[entity.index].row = row;
+}
+
+void EntityWorld::move(const Entity entity, const ComponentMask mask)
+{
+	// ŰŸ   迭 ٽ Ҵ  Ƿ   ڿ ´.
+	const uint32_t archetypeIndex = findOrCreateArchetype(mask);
+	const uint32_t row = allocateRow(archetypeIndex, entity);
+
+	EntityRecord& record = mRecords[entity.index];
+	const Archetype& source = mArchetypes[record.archetypeIndex];
+	const Archetype& destination = mArchetypes[archetypeIndex];
+
+	for (ComponentMask bits = mask; bits != 0; bits &= bits - 1)
+	{
+		const uint32_t componentTypeId = uint32_t(std::countr_zero(bits));
+		const uint32_t size = gComponentTypes[componentTypeId].size;
+		uint8_t* component = getComponent(destination, row, componentTypeId);
+
+		if ((source.mask & (ComponentMask(1) << componentTypeId)) != 0)
+		{
+			memcpy(component, getComponent(source, record.row, componentTypeId), size);
+		}
+		else
+		{
+			memset(component, 0, size);
+		}
+	}
+
+	removeRow(record.archetypeIndex, record.row);
+
+	record.archetypeIndex = archetypeIndex;
+	record.row = row;
+}
+
+uint32_t EntityWorld::findOrCreateArchetype(const ComponentMask mask)
+{
+	// ӿ      Ƿ ʷ ã´.
+	for (uint32_t i = 0; i < mArchetypes.size(); ++i)
+	{
+		if (mArchetypes[i].mask == mask)
+		{
+			return i;
+		}
+	}
+
+	// ûũ ϵ   ޸ ҽ ҴѴ.
+	Archetype archetype{ .mask = mask, .chunkCapacity = 0, .entityCount = 0, .offsets = {}, .chunks = std::pmr::vector<uint8_t*>(mArchetypes.get_allocator().resource()) };
+	std::fill(std::begin(archetype.offsets), std::end(archetype.offsets), INVALID_OFFSET);
+
+	uint32_t rowSize = uint32_t(sizeof(Entity));
+
+	for (ComponentMask bits = mask; bits != 0; bits &= bits - 1)
+	{
+		rowSize += gComponentTypes[std::countr_zero(bits)].size;
+	}
+
+	//    ƴ ְ ûũ   δ.
+	uint32_t capacity = CHUNK_SIZE / rowSize;
+
+	while (not layoutChunk(mask, capacity, archetype.offsets))
+	{
+		--capacity;
+	}
+
+	ASSERT(capacity > 0);
+	archetype.chunkCapacity = capacity;
+
+	mArchetypes.push_back(std::move(archetype));
+
+	return uint32_t(mArchetypes.size() - 1);
+}
+
+uint32_t EntityWorld::allocateRow(const uint32_t archetypeIndex, const Entity entity)
+{
+	Archetype& archetype = mArchetypes[archetypeIndex];
+	const uint32_t row = archetype.entityCount;
+	const uint32_t chunkIndex = row / archetype.chunkCapacity;
+
+	//  ûũ Finalize  ξٰ ٽ .
+	if (chunkIndex == archetype.chunks.size())
+	{
+		void* chunk = mArchetypes.get_allocator().resource()->allocate(CHUNK_SIZE, alignof(std::max_align_t));
+		archetype.chunks.push_back(static_cast<uint8_t*>(chunk));
+	}
+
+	Entity* entities = reinterpret_cast<Entity*>(archetype.chunks[chunkIndex]);
+	entities[row % archetype.chunkCapacity] = entity;
+	++archetype.entityCount;
+
+	return row;
+}
+
+void EntityWorld::removeRow(const uint32_t archetypeIndex, const uint32_t row)
+{
+	Archetype& archetype = mArchetypes[archetypeIndex];
+	ASSERT(row < archetype.entityCount);
+
+	const uint32_t lastRow = archetype.entityCount - 1;
+
+	//   ڸ Ű ûũ ȿ ƴ  ʰ Ѵ.
+	if (row != lastRow)
+	{
+		Entity* lastEntities = reinterpret_cast<Entity*>(archetype.chunks[lastRow / archetype.chunkCapacity]);
+		Entity* entities = reinterpret_cast<Entity*>(archetype.chunks[row / archetype.chunkCapacity]);
+		const Entity movedEntity = lastEntities[lastRow % archetype.chunkCapacity];
+
+		entities[row % archetype.chunkCapacity] = movedEntity;
+
+		for (ComponentMask bits = archetype.mask; bits != 0; bits &= bits - 1)
+		{
+			const uint32_t componentTypeId = uint32_t(std::countr_zero(bits));
+			memcpy(getComponent(archetype, row, componentTypeId), getComponent(archetype, lastRow, componentTypeId), gComponentTypes[componentTypeId].size);
+		}
+
+		mRecords[movedEntity.index].row = row;
+	}
+
+	--archetype.entityCount;
+}
+
+uint8_t* EntityWorld::getComponent(const Archetype& archetype, const uint32_t row, const uint32_t componentTypeId) const
+{
+	const uint32_t offset = archetype.offsets[componentTypeId];
+	ASSERT(offset != INVALID_OFFSET);
+
+	return archetype.chunks[row / archetype.chunkCapacity] + offset + gComponentTypes[componentTypeId].size * (row % archetype.chunkCapacity);
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+class SnapshotReader;
+class SnapshotWriter;
+
+//  ƼƼ ȣ ٽ  밡 ޶  ڵ   ִ.
+struct Entity
+{
+	uint32_t index;
+	uint32_t generation;
+};
+
+// Ʈ Ÿ ȣ  Ʈ .
+using ComponentMask = uint64_t;
+
+struct EntityQueryDesc
+{
+	const ComponentMask include;
+	const ComponentMask exclude;
+};
+
+//   ûũ ϳ. Ʈ GetCount()  ؼ  ִ.
+//  ٲ  ̻ ȿ ʴ.
+class EntityChunkView final
+{
+public:
+	EntityChunkView(uint8_t* memory, const uint32_t* offsets, const uint32_t count);
+
+	[[nodiscard]] uint32_t GetCount() const;
+	[[nodiscard]] const Entity* GetEntities() const;
+
+	template <typename T>
+	[[nodiscard]] T* GetComponents() const;
+
+private:
+	uint8_t* mMemory;
+	const uint32_t* mOffsets;
+	uint32_t mCount;
+};
+
+//  Ʈ (ŰŸ) ƼƼ CHUNK_SIZE ũ ûũ Ʈ 迭  Ѵ.
+// Ʈ memcpy űǷ trivially copyable̾ ϰ,  ü ũ  ±׷ ٷ.
+//    ȿ  ٷ ٲ  Defer Լ ̷  FlushCommands Ѵ.
+class EntityWorld final
+{
+public:
+	static constexpr uint32_t MAX_COMPONENT_TYPE_COUNT = 64;
+	static constexpr uint32_t CHUNK_SIZE = 16 * 1024;
+	static constexpr uint32_t INVALID_OFFSET = UINT32_MAX;
+
+public:
+	EntityWorld() = default;
+	EntityWorld(const EntityWorld&) = delete;
+	EntityWorld& operator=(const EntityWorld&) = delete;
+	~EntityWorld();
+
+	void Finalize();
+
+	template <typename T>
+	[[nodiscard]] static uint32_t GetComponentTypeId();
+
+	template <typename... Ts>
+	[[nodiscard]] static ComponentMask GetMask();
+
+	// Ʈ 0 ʱȭȴ.
+	[[nodiscard]] Entity Create(const ComponentMask mask);
+	void Destroy(const Entity entity);
+	[[nodiscard]] bool IsAlive(const Entity entity) const;
+
+	template <typename T>
+	void Add(const Entity entity, const T& component);
+
+	template <typename T>
+	void Remove(const Entity entity);
+
+	template <typename T>
+	[[nodiscard]] bool Has(const Entity entity) const;
+
+	template <typename T>
+	[[nodiscard]] T* GetOrNull(const Entity entity);
+
+	// ڵ ٷ  ƼƼ FlushCommands .
+	[[nodiscard]] Entity DeferCreate(const ComponentMask mask);
+	void DeferDestroy(const Entity entity);
+
+	template <typename T>
+	void DeferAdd(const Entity entity, const T& component);
+
+	template <typename T>
+	void DeferRemove(const Entity entity);
+
+	void FlushCommands();
+
+	void Query(const EntityQueryDesc& desc, std::pmr::vector<EntityChunkView>* outChunks) const;
+
+	[[nodiscard]] uint32_t GetEntityCount() const;
+	[[nodiscard]] uint32_t GetArchetypeCount() const;
+
+	// ƼƼ ȣ ûũ  ״ ´. ̷    θ.
+	//  ڿ  ŰŸ  ä , ûũ ڶ   ҴѴ.
+	void Save(SnapshotWriter* writer) const;
+	void Load(SnapshotReader* reader);
+
+public:
+	[[nodiscard]] static uint32_t _RegisterComponentType(const uint32_t size, const uint32_t alignment);
+
+private:
+	enum class eEntity_Command
+	{
+		Create,
+		Destroy,
+		Add,
+		Remove
+	};
+
+	struct Command
+	{
+		eEntity_Command type;
+		Entity entity;
+		ComponentMask mask;
+		uint32_t componentTypeId;
+		uint32_t dataOffset;
+	};
+
+	struct EntityRecord
+	{
+		uint32_t archetypeIndex;
+		uint32_t row;
+		uint32_t generation;
+	};
+
+	struct Archetype
+	{
+		ComponentMask mask;
+		uint32_t chunkCapacity;
+		uint32_t entityCount;
+		uint32_t offsets[MAX_COMPONENT_TYPE_COUNT];
+		std::pmr::vector<uint8_t*> chunks;
+	};
+
+	[[nodiscard]] void* add(const Entity entity, const uint32_t componentTypeId);
+	void remove(const Entity entity, const uint32_t componentTypeId);
+	[[nodiscard]] void* getOrNull(const Entity entity, const uint32_t componentTypeId) const;
+	void deferComponent(const eEntity_Command type, const Entity entity, const uint32_t componentTypeId, const void* data);
+
+	[[nodiscard]] Entity allocateEntity();
+	void place(const Entity entity, const ComponentMask mask);
+	void move(const Entity entity, const ComponentMask mask);
+
+	[[nodiscard]] uint32_t findOrCreateArchetype(const ComponentMask mask);
+	[[nodiscard]] uint32_t allocateRow(const uint32_t archetypeIndex, const Entity entity);
+	void removeRow(const uint32_t archetypeIndex, const uint32_t row);
+	[[nodiscard]] uint8_t* getComponent(const Archetype& archetype, const uint32_t row, const uint32_t componentTypeId) const;
+
+private:
+	static constexpr uint32_t INVALID_ARCHETYPE = UINT32_MAX;
+	static constexpr uint32_t PENDING_ARCHETYPE = UINT32_MAX - 1;
+
+	std::pmr::vector<Archetype> mArchetypes{};
+	std::pmr::vector<EntityRecord> mRecords{};
+	std::pmr::vector<uint32_t> mFreeIndices{};
+	uint32_t mEntityCount = 0;
+
+	std::pmr::vector<Command> mCommands{};
+	std::pmr::vector<uint8_t> mCommandData{};
+};
+
+template <typename T>
+T* EntityChunkView::GetComponents() const
+{
+	const uint32_t offset = mOffsets[EntityWorld::GetComponentTypeId<T>()];
+	ASSERT(offset != EntityWorld::INVALID_OFFSET);
+
+	return reinterpret_cast<T*>(mMemory + offset);
+}
+
+template <typename T>
+uint32_t EntityWorld::GetComponentTypeId()
+{
+	static_assert(std::is_trivially_copyable_v<T>);
+
+	static const uint32_t componentTypeId = _RegisterComponentType(std::is_empty_v<T> ? 0 : uint32_t(sizeof(T)), uint32_t(alignof(T)));
+	return componentTypeId;
+}
+
+template <typename... Ts>
+ComponentMask EntityWorld::GetMask()
+{
+	return ((ComponentMask(1) << GetComponentTypeId<Ts>()) | ... | ComponentMask(0));
+}
+
+template <typename T>
+void EntityWorld::Add(const Entity entity, const T& component)
+{
+	void* memory = add(entity, GetComponentTypeId<T>());
+
+	if constexpr (not std::is_empty_v<T>)
+	{
+		memcpy(memory, &component, sizeof(T));
+	}
+}
+
+template <typename T>
+void EntityWorld::Remove(const Entity entity)
+{
+	remove(entity, GetComponentTypeId<T>());
+}
+
+template <typename T>
+bool EntityWorld::Has(const Entity entity) const
+{
+	ASSERT(IsAlive(entity));
+
+	const EntityRecord& record = mRecords[entity.index];
+	return record.archetypeIndex < mArchetypes.size() and (mArchetypes[record.archetypeIndex].mask & GetMask<T>()) != 0;
+}
+
+template <typename T>
+T* EntityWorld::GetOrNull(const Entity entity)
+{
+	static_assert(not std::is_empty_v<T>);
+
+	return static_cast<T*>(getOrNull(entity, GetComponentTypeId<T>()));
+}
+
+template <typename T>
+void EntityWorld::DeferAdd(const Entity entity, const T& component)
+{
+	deferComponent(eEntity_Command::Add, entity, GetComponentTypeId<T>(), &component);
+}
+
+template <typename T>
+void EntityWorld::DeferRemove(const Entity entity)
+{
+	deferComponent(eEntity_Command::Remove, entity, GetComponentTypeId<T>(), nullptr);
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "pch.h"
+#include "FileWatcher.h"
+
+using namespace std::chrono;
+
+FileWatcher::~FileWatcher()
+{
+	Finalize();
+}
+
+bool FileWatcher::Initialize(const FileWatcherDesc& desc)
+{
+	ASSERT(mDirectoryHandle == INVALID_HANDLE_VALUE);
+	ASSERT(desc.quietSeconds >= 0.0f);
+
+	mDirectoryHandle = CreateFileW
+	(
+		desc.directory.c_str(),
+		FILE_LIST_DIRECTORY,
+		FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+		nullptr,
+		OPEN_EXISTING,
+		FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+		nullptr
+	);
+
+	if (mDirectoryHandle == INVALID_HANDLE_VALUE)
+	{
+		LOG("Failed to open %ls to watch (%lu)", desc.directory.c_str(), GetLastError());
+		return false;
+	}
+
+	mDirectory = desc.directory;
+	mQuietDuration = duration_cast<steady_clock::duration>(duration<float>(desc.quietSeconds));
+	mOverlapped = {};
+
+	if (not requestChanges())
+	{
+		LOG("Failed to watch %ls (%lu)", desc.directory.c_str(), GetLastError());
+
+		// ɾ  û Ƿ ٸ ʰ ݴ´.
+		CloseHandle(mDirectoryHandle);
+		mDirectoryHandle = INVALID_HANDLE_VALUE;
+		return false;
+	}
+
+	return true;
+}
+
+void FileWatcher::Finalize()
+{
+	if (mDirectoryHandle == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+
+	//  û   ۰  ʵ ٸ.
+	CancelIoEx(mDirectoryHandle, &mOverlapped);
+
+	DWORD byteCount = 0;
+	GetOverlappedResult(mDirectoryHandle, &mOverlapped, &byteCount, TRUE);
+
+	CloseHandle(mDirectoryHandle);
+	mDirectoryHandle = INVALID_HANDLE_VALUE;
+
+	mPendingChanges.clear();
+}
+
+void FileWatcher::Poll(const steady_clock::time_point now, std::vector<std::filesystem::path>* outPaths)
+{
+	ASSERT(outPaths != nullptr);
+
+	if (mDirectoryHandle == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+
+	DWORD byteCount = 0;
+
+	if (GetOverlappedResult(mDirectoryHandle, &mOverlapped, &byteCount, FALSE))
+	{
+		readChanges(uint32_t(byteCount), now);
+
+		if (not requestChanges())
+		{
+			LOG("Stopped watching %ls (%lu)", mDirectory.c_str(), GetLastError());
+			Finalize();
+			return;
+		}
+	}
+	else if (const DWORD error = GetLastError(); error != ERROR_IO_INCOMPLETE)
+	{
+		LOG("Stopped watching %ls (%lu)", mDirectory.c_str(), error);
+		Finalize();
+		return;
+	}
+
+	//      .
+	uint32_t keepCount = 0;
+
+	for (uint32_t i = 0; i < uint32_t(mPendingChanges.size()); ++i)
+	{
+		PendingChange& change = mPendingChanges[i];
+
+		if (now - change.changedTime >= mQuietDuration)
+		{
+			outPaths->push_back(std::move(change.path));
+			continue;
+		}
+
+		if (keepCount != i)
+		{
+			mPendingChanges[keepCount] = std::move(change);
+		}
+
+		++keepCount;
+	}
+
+	mPendingChanges.resize(keepCount);
+}
+
+bool FileWatcher::IsWatching() const
+{
+	return mDirectoryHandle != INVALID_HANDLE_VALUE;
+}
+
+bool FileWatcher::requestChanges()
+{
+	// ٸ α׷  ٸ ̸   ٲġϴ 쵵 ־ ̸ 浵 ޴´.
+	const BOOL bRequested = ReadDirectoryChangesW
+	(
+		mDirectoryHandle,
+		mBuffer,
+		sizeof(mBuffer),
+		TRUE,
+		FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME,
+		nullptr,
+		&mOverlapped,
+		nullptr
+	);
+
+	return bRequested != FALSE;
+}
+
+void FileWatcher::readChanges(const uint32_t byteCount, const steady_clock::time_point now)
+{
+	// ۰ ġ 0Ʈ   ٲ   .
+	if (byteCount == 0)
+	{
+		LOG("Lost file changes in %ls", mDirectory.c_str());
+		return;
+	}
+
+	const uint8_t* data = reinterpret_cast<const uint8_t*>(mBuffer);
+
+	while (true)
+	{
+		const FILE_NOTIFY_INFORMATION* information = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(data);
+
+		// ų ٸ ̸ Ű  ٽ   .
+		if (information->Action == FILE_ACTION_ADDED
+			or information->Action == FILE_ACTION_MODIFIED
+			or information->Action == FILE_ACTION_RENAMED_NEW_NAME)
+		{
+			const std::wstring_view filename(information->FileName, information->FileNameLength / sizeof(wchar_t));
+			const std::filesystem::path path = mDirectory / filename;
+
+			PendingChange* pendingChange = nullptr;
+
+			for (PendingChange& change : mPendingChanges)
+			{
+				if (change.path == path)
+				{
+					pendingChange = &change;
+					break;
+				}
+			}
+
+			if (pendingChange != nullptr)
+			{
+				pendingChange->changedTime = now;
+			}
+			else
+			{
+				mPendingChanges.push_back({ .path = path, .changedTime = now });
+			}
+		}
+
+		if (information->NextEntryOffset == 0)
+		{
+			break;
+		}
+
+		data += information->NextEntryOffset;
+	}
+}
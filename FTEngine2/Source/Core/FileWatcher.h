@@ -0,0 +1,53 @@
+#pragma once
+
+struct FileWatcherDesc
+{
+	//   .
+	const std::filesystem::path directory;
+
+	//        Ƿ    ̸ŭ ؾ ٲ  ˸.
+	const float quietSeconds;
+};
+
+// ReadDirectoryChangesW ģ I/O ɾ ΰ   ٸ ʰ ȮѴ. 带  ʴ´.
+class FileWatcher final
+{
+public:
+	FileWatcher() = default;
+	FileWatcher(const FileWatcher&) = delete;
+	FileWatcher& operator=(const FileWatcher&) = delete;
+	~FileWatcher();
+
+	//   ϸ false ȯѴ.
+	[[nodiscard]] bool Initialize(const FileWatcherDesc& desc);
+	void Finalize();
+
+	//   θ directory ٿ outPaths Ѵ. ٲ   Ҵ ʴ´.
+	void Poll(const std::chrono::steady_clock::time_point now, std::vector<std::filesystem::path>* outPaths);
+
+	[[nodiscard]] bool IsWatching() const;
+
+private:
+	struct PendingChange
+	{
+		std::filesystem::path path;
+		std::chrono::steady_clock::time_point changedTime;
+	};
+
+	[[nodiscard]] bool requestChanges();
+	void readChanges(const uint32_t byteCount, const std::chrono::steady_clock::time_point now);
+
+private:
+	static constexpr uint32_t BUFFER_SIZE = 16 * 1024;
+
+	std::filesystem::path mDirectory{};
+	std::chrono::steady_clock::duration mQuietDuration{};
+
+	HANDLE mDirectoryHandle = INVALID_HANDLE_VALUE;
+	OVERLAPPED mOverlapped{};
+
+	// FILE_NOTIFY_INFORMATION DWORD 迡 ־ Ѵ.
+	DWORD mBuffer[BUFFER_SIZE / sizeof(DWORD)]{};
+
+	std::vector<PendingChange> mPendingChanges{};
+};
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include "pch.h"
+#include "FlowField.h"
+
+namespace
+{
+	constexpr uint32_t NEIGHBOR_COUNT = 8;
+
+	// 0 ~ 3 , 4 ~ 7 밢 ̴̿.
+	constexpr int32_t NEIGHBOR_X[NEIGHBOR_COUNT] = { 1, -1, 0, 0, 1, -1, 1, -1 };
+	constexpr int32_t NEIGHBOR_Y[NEIGHBOR_COUNT] = { 0, 0, 1, -1, 1, 1, -1, -1 };
+
+	constexpr float DIAGONAL = 0.70710678f;
+	constexpr D2D1_POINT_2F NEIGHBOR_DIRECTION[NEIGHBOR_COUNT] =
+	{
+		{ .x = 1.0f, .y = 0.0f },
+		{ .x = -1.0f, .y = 0.0f },
+		{ .x = 0.0f, .y = 1.0f },
+		{ .x = 0.0f, .y = -1.0f },
+		{ .x = DIAGONAL, .y = DIAGONAL },
+		{ .x = -DIAGONAL, .y = DIAGONAL },
+		{ .x = DIAGONAL, .y = -DIAGONAL },
+		{ .x = -DIAGONAL, .y = -DIAGONAL }
+	};
+}
+
+void FlowField::Initialize(const FlowFieldDesc& desc)
+{
+	ASSERT(desc.cellSize > 0.0f);
+	ASSERT(desc.innerRadius < desc.outerRadius);
+
+	mCenter = desc.center;
+	mCellSize = desc.cellSize;
+	mInverseCellSize = 1.0f / desc.cellSize;
+
+	//   ڿ    پ θ.
+	mColumnCount = uint32_t(std::ceil(desc.outerRadius * 2.0f * mInverseCellSize)) + 2;
+	mRowCount = mColumnCount;
+	mOrigin = { .x = mCenter.x - desc.outerRadius - mCellSize, .y = mCenter.y - desc.outerRadius - mCellSize };
+
+	for (uint32_t i = 0; i < NEIGHBOR_COUNT; ++i)
+	{
+		mNeighborOffsets[i] = NEIGHBOR_Y[i] * int32_t(mColumnCount) + NEIGHBOR_X[i];
+	}
+
+	const uint32_t cellCount = mColumnCount * mRowCount;
+	mBlocked.assign(cellCount, 0);
+	mIntegration.assign(cellCount, UNREACHABLE);
+	mDirections.assign(cellCount, D2D1_POINT_2F{});
+
+	for (std::vector<uint32_t>& bucket : mBuckets)
+	{
+		bucket.reserve(mColumnCount * 4);
+	}
+
+	mOpenCells.clear();
+
+	//  ٱ   ,   о  ̸ Ѵ.
+	for (uint32_t i = 0; i < cellCount; ++i)
+	{
+		const uint32_t column = i % mColumnCount;
+		const uint32_t row = i / mColumnCount;
+		const bool bBorder = (column == 0 or row == 0 or column == mColumnCount - 1 or row == mRowCount - 1);
+
+		const D2D1_POINT_2F toCell = Math::SubtractVector(getCellCenter(i), mCenter);
+		const float distance = Math::GetVectorLength(toCell);
+
+		if (distance < desc.innerRadius)
+		{
+			mBlocked[i] = 1;
+			mDirections[i] = Math::NormalizeVector(toCell);
+		}
+		else if (distance > desc.outerRadius or bBorder)
+		{
+			mBlocked[i] = 1;
+			mDirections[i] = Math::ScaleVector(Math::NormalizeVector(toCell), -1.0f);
+		}
+		else
+		{
+			mOpenCells.push_back(i);
+		}
+	}
+
+	mTargetIndex = INVALID_CELL;
+	SetTarget(mCenter);
+}
+
+D2D1_POINT_2F FlowField::GetTarget() const
+{
+	return mTarget;
+}
+
+void FlowField::SetTarget(const D2D1_POINT_2F target)
+{
+	mTarget = target;
+
+	// Ÿ  ٲ  ٽ Ѵ.
+	const uint32_t targetIndex = getCellIndex(target);
+	if (targetIndex == mTargetIndex)
+	{
+		return;
+	}
+
+	mTargetIndex = targetIndex;
+
+	buildIntegrationField();
+	buildDirectionField();
+}
+
+D2D1_POINT_2F FlowField::GetDirection(const D2D1_POINT_2F position) const
+{
+	const uint32_t index = getCellIndex(position);
+
+	if (index == mTargetIndex)
+	{
+		return Math::NormalizeVector(Math::SubtractVector(mTarget, position));
+	}
+
+	return mDirections[index];
+}
+
+bool FlowField::IsBlocked(const D2D1_POINT_2F position) const
+{
+	return mBlocked[getCellIndex(position)];
+}
+
+uint32_t FlowField::getCellIndex(const D2D1_POINT_2F position) const
+{
+	//   ġ ڸ    .
+	const int32_t column = std::clamp(int32_t((position.x - mOrigin.x) * mInverseCellSize), 1, int32_t(mColumnCount) - 2);
+	const int32_t row = std::clamp(int32_t((position.y - mOrigin.y) * mInverseCellSize), 1, int32_t(mRowCount) - 2);
+
+	return uint32_t(row) * mColumnCount + uint32_t(column);
+}
+
+D2D1_POINT_2F FlowField::getCellCenter(const uint32_t cellIndex) const
+{
+	const uint32_t column = cellIndex % mColumnCount;
+	const uint32_t row = cellIndex / mColumnCount;
+
+	const D2D1_POINT_2F result =
+	{
+		.x = mOrigin.x + (float(column) + 0.5f) * mCellSize,
+		.y = mOrigin.y + (float(row) + 0.5f) * mCellSize
+	};
+
+	return result;
+}
+
+void FlowField::buildIntegrationField()
+{
+	std::fill(mIntegration.begin(), mIntegration.end(), UNREACHABLE);
+
+	for (std::vector<uint32_t>& bucket : mBuckets)
+	{
+		bucket.clear();
+	}
+
+	//    ̹Ƿ Ŷ ť(Dial) ͽƮ Ѵ.
+	mIntegration[mTargetIndex] = 0;
+	mBuckets[0].push_back(mTargetIndex);
+	uint32_t pendingCount = 1;
+
+	for (uint32_t cost = 0; pendingCount > 0; ++cost)
+	{
+		std::vector<uint32_t>& bucket = mBuckets[cost % BUCKET_COUNT];
+
+		for (const uint32_t index : bucket)
+		{
+			--pendingCount;
+
+			if (mIntegration[index] != cost)
+			{
+				continue;
+			}
+
+			for (uint32_t i = 0; i < NEIGHBOR_COUNT; ++i)
+			{
+				const uint32_t neighborIndex = uint32_t(int32_t(index) + mNeighborOffsets[i]);
+				if (mBlocked[neighborIndex])
+				{
+					continue;
+				}
+
+				const bool bDiagonal = (i >= 4);
+
+				//   𼭸  ʴ´.
+				if (bDiagonal
+					and (mBlocked[uint32_t(int32_t(index) + NEIGHBOR_X[i])]
+						or mBlocked[uint32_t(int32_t(index) + NEIGHBOR_Y[i] * int32_t(mColumnCount))]))
+				{
+					continue;
+				}
+
+				const uint32_t neighborCost = cost + (bDiagonal ? DIAGONAL_COST : STRAIGHT_COST);
+				if (neighborCost >= mIntegration[neighborIndex])
+				{
+					continue;
+				}
+
+				mIntegration[neighborIndex] = neighborCost;
+				mBuckets[neighborCost % BUCKET_COUNT].push_back(neighborIndex);
+				++pendingCount;
+			}
+		}
+
+		bucket.clear();
+	}
+}
+
+void FlowField::buildDirectionField()
+{
+	for (const uint32_t index : mOpenCells)
+	{
+		if (index == mTargetIndex)
+		{
+			continue;
+		}
+
+		if (mIntegration[index] == UNREACHABLE)
+		{
+			mDirections[index] = Math::NormalizeVector(Math::SubtractVector(mTarget, getCellCenter(index)));
+			continue;
+		}
+
+		uint32_t bestCost = mIntegration[index];
+		D2D1_POINT_2F bestDirection{};
+
+		for (uint32_t i = 0; i < NEIGHBOR_COUNT; ++i)
+		{
+			const uint32_t neighborIndex = uint32_t(int32_t(index) + mNeighborOffsets[i]);
+			if (i >= 4
+				and (mBlocked[uint32_t(int32_t(index) + NEIGHBOR_X[i])]
+					or mBlocked[uint32_t(int32_t(index) + NEIGHBOR_Y[i] * int32_t(mColumnCount))]))
+			{
+				continue;
+			}
+
+			if (mIntegration[neighborIndex] < bestCost)
+			{
+				bestCost = mIntegration[neighborIndex];
+				bestDirection = NEIGHBOR_DIRECTION[i];
+			}
+		}
+
+		mDirections[index] = bestDirection;
+	}
+}
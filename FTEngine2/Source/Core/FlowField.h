@@ -0,0 +1,63 @@
+#pragma once
+
+struct FlowFieldDesc
+{
+	const D2D1_POINT_2F center;
+	const float innerRadius;
+	const float outerRadius;
+	const float cellSize;
+};
+
+class FlowField final
+{
+public:
+	FlowField() = default;
+	FlowField(const FlowField&) = delete;
+	FlowField& operator=(const FlowField&) = delete;
+
+	void Initialize(const FlowFieldDesc& desc);
+
+	[[nodiscard]] D2D1_POINT_2F GetTarget() const;
+
+	// Ÿ  ٲ ʵ ü ٽ Ѵ.   Ÿ  ĭ      ٲǷ ٲ  ġ ʴ´.
+	void SetTarget(const D2D1_POINT_2F target);
+
+	[[nodiscard]] D2D1_POINT_2F GetDirection(const D2D1_POINT_2F position) const;
+	[[nodiscard]] bool IsBlocked(const D2D1_POINT_2F position) const;
+
+private:
+	[[nodiscard]] uint32_t getCellIndex(const D2D1_POINT_2F position) const;
+	[[nodiscard]] D2D1_POINT_2F getCellCenter(const uint32_t cellIndex) const;
+
+	void buildIntegrationField();
+	void buildDirectionField();
+
+private:
+	static constexpr uint32_t UNREACHABLE = UINT32_MAX;
+	static constexpr uint32_t INVALID_CELL = UINT32_MAX;
+
+	// 밢 ̵    1.4̴.
+	static constexpr uint32_t STRAIGHT_COST = 5;
+	static constexpr uint32_t DIAGONAL_COST = 7;
+	static constexpr uint32_t BUCKET_COUNT = DIAGONAL_COST + 1;
+
+	D2D1_POINT_2F mCenter{};
+	D2D1_POINT_2F mOrigin{};
+	float mCellSize = 1.0f;
+	float mInverseCellSize = 1.0f;
+	uint32_t mColumnCount = 0;
+	uint32_t mRowCount = 0;
+
+	D2D1_POINT_2F mTarget{};
+	uint32_t mTargetIndex = INVALID_CELL;
+
+	// ڸ     θǷ    ̿ ׻  ȿ ִ.
+	std::array<int32_t, 8> mNeighborOffsets{};
+	std::vector<uint32_t> mOpenCells{};
+
+	std::vector<uint8_t> mBlocked{};
+	std::vector<uint32_t> mIntegration{};
+	std::vector<D2D1_POINT_2F> mDirections{};
+
+	std::array<std::vector<uint32_t>, BUCKET_COUNT> mBuckets{};
+};
\ No newline at end of file
@@ -22,11 +22,11 @@ void Font::Finalize()
 	RELEASE_D2D1(mTextFormat);
 }
 
-D2D1_SIZE_F Font::_CalculateTextSize(const std::wstring& text) const
+D2D1_SIZE_F Font::_CalculateTextSize(const std::wstring_view text) const
 {
 	IDWriteFactory* dWriteFactory = mHelper->GetDWriteFactory();
 	IDWriteTextLayout* layout = nullptr;
-	HR(dWriteFactory->CreateTextLayout(text.c_str(), UINT32(text.size()), mTextFormat, float(Constant::Get().GetWidth()), float(Constant::Get().GetHeight()), &layout));
+	HR(dWriteFactory->CreateTextLayout(text.data(), UINT32(text.size()), mTextFormat, float(Constant::Get().GetWidth()), float(Constant::Get().GetHeight()), &layout));
 
 	DWRITE_TEXT_METRICS metrics{};
 	HR(layout->GetMetrics(&metrics));
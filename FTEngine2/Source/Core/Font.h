@@ -13,7 +13,7 @@ public:
 	void Finalize();
 
 public:
-	[[nodiscard]] D2D1_SIZE_F _CalculateTextSize(const std::wstring& text) const;
+	[[nodiscard]] D2D1_SIZE_F _CalculateTextSize(const std::wstring_view text) const;
 	[[nodiscard]] IDWriteTextFormat* _GetTextFormat() const;
 
 private:
@@ -0,0 +1,91 @@
+#include "pch.h"
+#include "FrameAllocator.h"
+
+FrameAllocator& FrameAllocator::Get()
+{
+	static FrameAllocator frameAllocator;
+	return frameAllocator;
+}
+
+void FrameAllocator::Initialize(const FrameAllocatorDesc& desc)
+{
+	ASSERT(desc.capacity > 0);
+
+	for (LinearArena& arena : mArenas)
+	{
+		arena.Initialize({ .capacity = desc.capacity });
+	}
+
+	mCurrentIndex = 0;
+	mPeakBytes = 0;
+	mOverflowFrameCount = 0;
+	mPeakOverflowBytes = 0;
+}
+
+void FrameAllocator::Finalize()
+{
+	for (LinearArena& arena : mArenas)
+	{
+		arena.Finalize();
+	}
+}
+
+void FrameAllocator::BeginFrame()
+{
+	recordFrame(mArenas[mCurrentIndex]);
+
+	//   ʹ  ΰ    ۸ .
+	mCurrentIndex = (mCurrentIndex + 1) % BUFFER_COUNT;
+	mArenas[mCurrentIndex].Release();
+}
+
+std::pmr::memory_resource* FrameAllocator::GetMemoryResource()
+{
+	return &mArenas[mCurrentIndex];
+}
+
+size_t FrameAllocator::GetCapacity() const
+{
+	return mArenas[mCurrentIndex].GetCapacity();
+}
+
+size_t FrameAllocator::GetFrameUsedBytes() const
+{
+	return mArenas[mCurrentIndex].GetUsedBytes();
+}
+
+size_t FrameAllocator::GetPeakBytes() const
+{
+	return max(mPeakBytes, mArenas[mCurrentIndex].GetPeakBytes());
+}
+
+uint64_t FrameAllocator::GetOverflowFrameCount() const
+{
+	return mOverflowFrameCount;
+}
+
+size_t FrameAllocator::GetPeakOverflowBytes() const
+{
+	return mPeakOverflowBytes;
+}
+
+void FrameAllocator::recordFrame(const LinearArena& arena)
+{
+	mPeakBytes = max(mPeakBytes, arena.GetPeakBytes());
+
+	const size_t overflowBytes = arena.GetOverflowBytes();
+
+	if (overflowBytes == 0)
+	{
+		return;
+	}
+
+	++mOverflowFrameCount;
+
+	//    ʵ ģ  ִ븦   ˸.
+	if (overflowBytes > mPeakOverflowBytes)
+	{
+		mPeakOverflowBytes = overflowBytes;
+		LOG("Frame allocator overflow: %zu bytes over %zu bytes capacity", overflowBytes, arena.GetCapacity());
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "LinearArena.h"
+
+//  ũġ Ҵϴ ̳. FrameAllocator::Get().GetMemoryResource() .
+template <typename T>
+using FrameVector = std::pmr::vector<T>;
+using FrameWString = std::pmr::wstring;
+
+struct FrameAllocatorDesc
+{
+	const size_t capacity;
+};
+
+//  ȸ  ӽ ͸     Ҵ.
+// BeginFrame ٸ   Ƿ, Ҵ ޸𸮴     ȿϴ.
+class FrameAllocator final
+{
+public:
+	[[nodiscard]] static FrameAllocator& Get();
+
+	void Initialize(const FrameAllocatorDesc& desc);
+	void Finalize();
+
+	void BeginFrame();
+
+	[[nodiscard]] std::pmr::memory_resource* GetMemoryResource();
+
+	[[nodiscard]] size_t GetCapacity() const;
+	[[nodiscard]] size_t GetFrameUsedBytes() const;
+	[[nodiscard]] size_t GetPeakBytes() const;
+
+	// 뷮 Ѿ   Ҵ      ģ 
+	[[nodiscard]] uint64_t GetOverflowFrameCount() const;
+	[[nodiscard]] size_t GetPeakOverflowBytes() const;
+
+private:
+	FrameAllocator() = default;
+	FrameAllocator(const FrameAllocator&) = delete;
+	FrameAllocator& operator=(const FrameAllocator&) = delete;
+	~FrameAllocator() = default;
+
+	void recordFrame(const LinearArena& arena);
+
+private:
+	static constexpr uint32_t BUFFER_COUNT = 2;
+
+	LinearArena mArenas[BUFFER_COUNT]{};
+	uint32_t mCurrentIndex = 0;
+
+	size_t mPeakBytes = 0;
+	uint64_t mOverflowFrameCount = 0;
+	size_t mPeakOverflowBytes = 0;
+};
\ No newline at end of file
@@ -16,20 +16,12 @@ ID2D1HwndRenderTarget* Helper::GetRenderTarget() const
 	return mRenderTarget;
 }
 
-FMOD::System* Helper::GetSoundSystem() const
-{
-	return mSoundSystem;
-}
-
-void Helper::_Initialize(IWICImagingFactory* wicImagingFactory, IDWriteFactory* dWriteFactory, ID2D1HwndRenderTarget* renderTarget, FMOD::System* soundSystem)
+void Helper::_Initialize(IWICImagingFactory* wicImagingFactory, IDWriteFactory* dWriteFactory, ID2D1HwndRenderTarget* renderTarget)
 {
 	ASSERT(wicImagingFactory != nullptr 
-		and dWriteFactory != nullptr
-		and renderTarget != nullptr
-		and soundSystem != nullptr);
+		and dWriteFactory != nullptr);
 
 	mWICImagingFactory = wicImagingFactory;
 	mDWriteFactory = dWriteFactory;
 	mRenderTarget = renderTarget;
-	mSoundSystem = soundSystem;
 }
@@ -14,14 +14,13 @@ public:
 	[[nodiscard]] IWICImagingFactory* GetWICImagingFactory() const;
 	[[nodiscard]] IDWriteFactory* GetDWriteFactory() const;
 	[[nodiscard]] ID2D1HwndRenderTarget* GetRenderTarget() const;
-	[[nodiscard]] FMOD::System* GetSoundSystem() const;
 
 public:
-	void _Initialize(IWICImagingFactory* wicImagingFactory, IDWriteFactory* dWriteFactory, ID2D1HwndRenderTarget* renderTarget, FMOD::System* soundSystem);
+	// ׸ ʰ ùķ̼Ǹ ϸ renderTarget nullptr̴. ̶ GetRenderTarget nullptr ȯѴ.
+	void _Initialize(IWICImagingFactory* wicImagingFactory, IDWriteFactory* dWriteFactory, ID2D1HwndRenderTarget* renderTarget);
 
 private:
 	IWICImagingFactory* mWICImagingFactory = nullptr;
 	IDWriteFactory* mDWriteFactory = nullptr;
 	ID2D1HwndRenderTarget* mRenderTarget = nullptr;
-	FMOD::System* mSoundSystem = nullptr;
 };
\ No newline at end of file
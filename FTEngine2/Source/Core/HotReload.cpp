@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "HotReload.h"
+
+#include "Texture.h"
+
+namespace
+{
+	std::string_view trim(const std::string_view text)
+	{
+		const size_t begin = text.find_first_not_of(" \t\r");
+		if (begin == std::string_view::npos)
+		{
+			return {};
+		}
+
+		const size_t end = text.find_last_not_of(" \t\r");
+		return text.substr(begin, end - begin + 1);
+	}
+}
+
+bool Tunables::Load(const std::filesystem::path& path)
+{
+	std::ifstream file(path);
+	if (not file)
+	{
+		return false;
+	}
+
+	mValues.clear();
+
+	std::string line;
+	uint32_t lineNumber = 0;
+
+	while (std::getline(file, line))
+	{
+		++lineNumber;
+
+		std::string_view text = line;
+		text = trim(text.substr(0, text.find('#')));
+
+		if (text.empty())
+		{
+			continue;
+		}
+
+		const size_t equal = text.find('=');
+		const std::string_view name = trim(text.substr(0, equal));
+		const std::string_view value = trim(equal != std::string_view::npos ? text.substr(equal + 1) : std::string_view{});
+
+		float number = 0.0f;
+		const std::from_chars_result result = std::from_chars(value.data(), value.data() + value.size(), number);
+
+		if (name.empty() or value.empty() or result.ec != std::errc{} or result.ptr != value.data() + value.size())
+		{
+			LOG("Ignored line %u of tunables: %s", lineNumber, line.c_str());
+			continue;
+		}
+
+		mValues.insert_or_assign(std::string(name), number);
+	}
+
+	++mVersion;
+
+	return true;
+}
+
+float Tunables::GetFloat(const std::string& name, const float defaultValue) const
+{
+	const auto found = mValues.find(name);
+	return found != mValues.end() ? found->second : defaultValue;
+}
+
+uint32_t Tunables::GetVersion() const
+{
+	return mVersion;
+}
+
+void HotReload::Initialize(const HotReloadDesc& desc)
+{
+	ASSERT(desc.helper != nullptr);
+
+	mHelper = desc.helper;
+
+	if (not mFileWatcher.Initialize({ .directory = desc.directory, .quietSeconds = desc.quietSeconds }))
+	{
+		LOG("Hot reload is disabled for %ls", desc.directory.c_str());
+	}
+
+	mTunablesPath = desc.tunablesPath.lexically_normal();
+
+	if (not mTunablesPath.empty())
+	{
+		mTunables.Load(mTunablesPath);
+	}
+}
+
+void HotReload::Finalize()
+{
+	mFileWatcher.Finalize();
+
+	mTextures.clear();
+	mChangedPaths.clear();
+}
+
+void HotReload::AddTexture(Texture* texture)
+{
+	ASSERT(texture != nullptr);
+	MASSERT(not texture->GetFilename().empty(), "ʱȭ  ؽóԴϴ.");
+
+	mTextures.push_back({ .texture = texture, .path = std::filesystem::path(texture->GetFilename()).lexically_normal() });
+}
+
+void HotReload::Update(const std::chrono::steady_clock::time_point now)
+{
+	mChangedPaths.clear();
+	mFileWatcher.Poll(now, &mChangedPaths);
+
+	for (const std::filesystem::path& changedPath : mChangedPaths)
+	{
+		const std::filesystem::path path = changedPath.lexically_normal();
+
+		if (path == mTunablesPath)
+		{
+			if (mTunables.Load(mTunablesPath))
+			{
+				LOG("Reloaded tunables (version %u)", mTunables.GetVersion());
+			}
+
+			continue;
+		}
+
+		//    ؽó о  ִ.
+		for (const WatchedTexture& watchedTexture : mTextures)
+		{
+			if (watchedTexture.path == path and watchedTexture.texture->Reload(mHelper))
+			{
+				LOG("Reloaded %ls", watchedTexture.texture->GetFilename().c_str());
+			}
+		}
+	}
+}
+
+const Tunables& HotReload::GetTunables() const
+{
+	return mTunables;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "FileWatcher.h"
+
+class Helper;
+class Texture;
+
+// "̸ = " ٷ   . '#' ڴ ּ̰   float д´.
+class Tunables final
+{
+public:
+	Tunables() = default;
+	Tunables(const Tunables&) = delete;
+	Tunables& operator=(const Tunables&) = delete;
+
+	//   ϸ   ״ ΰ false ȯѴ.
+	bool Load(const std::filesystem::path& path);
+
+	// Ͽ  ̸̸ defaultValue ȯѴ.
+	[[nodiscard]] float GetFloat(const std::string& name, const float defaultValue) const;
+
+	//   þ.      ٲ  ٽ Ѵ.
+	[[nodiscard]] uint32_t GetVersion() const;
+
+private:
+	std::unordered_map<std::string, float> mValues{};
+	uint32_t mVersion = 0;
+};
+
+struct HotReloadDesc
+{
+	Helper* const helper;
+
+	//   Ʒ  ٲ ٽ д´.
+	const std::filesystem::path directory;
+
+	//      ʴ´.   ߿  д´.
+	const std::filesystem::path tunablesPath;
+
+	const float quietSeconds;
+};
+
+// ٲ ؽó  ڸ ٽ а   ٽ д´.  ٽ ʱȭ ʴ´.
+// Core  Ʈϱ  UpdateϹǷ ٲ   ƽ ùķ̼Ǻ δ.
+class HotReload final
+{
+public:
+	HotReload() = default;
+	HotReload(const HotReload&) = delete;
+	HotReload& operator=(const HotReload&) = delete;
+
+	//        о д.
+	void Initialize(const HotReloadDesc& desc);
+	void Finalize();
+
+	// ؽó Initialize  ѱ  ̸ ã´.
+	void AddTexture(Texture* texture);
+
+	void Update(const std::chrono::steady_clock::time_point now);
+
+	[[nodiscard]] const Tunables& GetTunables() const;
+
+private:
+	struct WatchedTexture
+	{
+		Texture* texture;
+		std::filesystem::path path;
+	};
+
+private:
+	Helper* mHelper = nullptr;
+	FileWatcher mFileWatcher{};
+
+	std::vector<WatchedTexture> mTextures{};
+
+	std::filesystem::path mTunablesPath{};
+	Tunables mTunables{};
+
+	std::vector<std::filesystem::path> mChangedPaths{};
+};
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "Constant.h"
 #include "Input.h"
 
+using namespace std::chrono;
+
 Input& Input::Get()
 {
 	static Input input;
@@ -18,13 +20,13 @@ bool Input::GetKey(const uint32_t virtualKey) const
 bool Input::GetKeyDown(const uint32_t virtualKey) const
 {
 	MASSERT(virtualKey < VIRTUAL_KEY_COUNT, " ʴ ŰԴϴ.");
-	return mbKeysStateChanged[virtualKey] and mbKeysPressed[virtualKey];
+	return mbKeysDown[virtualKey];
 }
 
 bool Input::GetKeyUp(const uint32_t virtualKey) const
 {
 	MASSERT(virtualKey < VIRTUAL_KEY_COUNT, " ʴ ŰԴϴ.");
-	return mbKeysStateChanged[virtualKey] and not mbKeysPressed[virtualKey];
+	return mbKeysUp[virtualKey];
 }
 
 bool Input::GetMouseButton(const eMouseButton button) const
@@ -34,14 +36,30 @@ bool Input::GetMouseButton(const eMouseButton button) const
 
 bool Input::GetMouseButtonDown(const eMouseButton button) const
 {
-	uint32_t index = uint32_t(button);
-	return mbMouseButtonStateChanged[index] and mbMouseButtonPressed[index];
+	return mbMouseButtonDown[uint32_t(button)];
 }
 
 bool Input::GetMouseButtonUp(const eMouseButton button) const
+{
+	return mbMouseButtonUp[uint32_t(button)];
+}
+
+float Input::GetMouseButtonDownElapsedTime(const eMouseButton button) const
 {
 	uint32_t index = uint32_t(button);
-	return mbMouseButtonStateChanged[index] and not mbMouseButtonPressed[index];
+
+	if (not mbMouseButtonDown[index])
+	{
+		return 0.0f;
+	}
+
+	return max(duration<float>(mFrameTime - mMouseButtonDownEvents[index].timestamp).count(), 0.0f);
+}
+
+const InputEvent* Input::GetMouseButtonPressEventOrNull(const eMouseButton button) const
+{
+	uint32_t index = uint32_t(button);
+	return (mbMouseButtonPressed[index] or mbMouseButtonDown[index]) ? &mMouseButtonDownEvents[index] : nullptr;
 }
 
 D2D1_POINT_2F Input::GetMousePosition() const
@@ -107,23 +125,83 @@ void Input::_Initialize(HWND hWnd)
 
 void Input::_Clear()
 {
-	mbKeysStateChanged.reset();
+	mbKeysDown.reset();
+	mbKeysUp.reset();
 
-	memset(mbMouseButtonStateChanged, 0, sizeof(mbMouseButtonStateChanged));
+	memset(mbMouseButtonDown, 0, sizeof(mbMouseButtonDown));
+	memset(mbMouseButtonUp, 0, sizeof(mbMouseButtonUp));
 	mMouseScrollWheel = 0;
 }
 
+void Input::_PushEvent(const InputEvent& event)
+{
+	InputEvent numberedEvent = event;
+	numberedEvent.id = ++mLastEventId;
+
+	// â ޽ óϴ 尡   ̹Ƿ ٸ ʰ .
+	if (not mEvents.TryPush(numberedEvent))
+	{
+		++mDroppedEventCount;
+		LOG("Input event queue is full (%llu dropped)", mDroppedEventCount);
+	}
+}
+
+void Input::_ProcessEvents(const steady_clock::time_point frameTime)
+{
+	mFrameTime = frameTime;
+
+	InputEvent event;
+
+	while (mEvents.TryPop(&event))
+	{
+		switch (event.type)
+		{
+		case eInput_Event::Key:
+			_SetKeyState(event.code, event.bPressed);
+			break;
+
+		case eInput_Event::MouseButton:
+			setMouseButtonState(eMouseButton(event.code), event.bPressed, event);
+			break;
+
+		case eInput_Event::MouseMove:
+			_SetMousePosition(event.mousePosition);
+			break;
+
+		case eInput_Event::MouseWheel:
+			_SetMouseScrollWheel(event.scrollWheel);
+			break;
+
+		default:
+			ASSERT(false);
+			break;
+		}
+	}
+}
+
 void Input::_SetKeyState(const uint32_t virtualKey, const bool bPressed)
 {
-	mbKeysStateChanged[virtualKey] = (mbKeysPressed[virtualKey] != bPressed);
+	// Ű    ° ݺؼ ´.
+	if (mbKeysPressed[virtualKey] == bPressed)
+	{
+		return;
+	}
+
 	mbKeysPressed[virtualKey] = bPressed;
+
+	if (bPressed)
+	{
+		mbKeysDown[virtualKey] = true;
+	}
+	else
+	{
+		mbKeysUp[virtualKey] = true;
+	}
 }
 
 void Input::_SetMouseButtonState(const eMouseButton button, const bool bPressed)
 {
-	uint32_t index = uint32_t(button);
-	mbMouseButtonStateChanged[index] = (mbMouseButtonPressed[index] != bPressed);
-	mbMouseButtonPressed[index] = bPressed;
+	setMouseButtonState(button, bPressed, { .timestamp = mFrameTime, .type = eInput_Event::MouseButton, .id = INVALID_EVENT_ID, .code = uint32_t(button), .bPressed = bPressed });
 }
 
 void Input::_SetMousePosition(const D2D1_POINT_2F mousePosition)
@@ -163,4 +241,29 @@ void Input::_RenewScreenCenterPosition()
 
 	mScreenCenterPosition.x = clientRect.left + Constant::Get().GetWidth() / 2;
 	mScreenCenterPosition.y = clientRect.top + Constant::Get().GetHeight() / 2;
-}
\ No newline at end of file
+}
+
+void Input::setMouseButtonState(const eMouseButton button, const bool bPressed, const InputEvent& event)
+{
+	uint32_t index = uint32_t(button);
+
+	if (mbMouseButtonPressed[index] == bPressed)
+	{
+		return;
+	}
+
+	mbMouseButtonPressed[index] = bPressed;
+
+	if (not bPressed)
+	{
+		mbMouseButtonUp[index] = true;
+		return;
+	}
+
+	//  ӿ   ٸ ó  ̺Ʈ .
+	if (not mbMouseButtonDown[index])
+	{
+		mbMouseButtonDown[index] = true;
+		mMouseButtonDownEvents[index] = event;
+	}
+}
@@ -1,5 +1,35 @@
 #pragma once
 
+#include "SpscQueue.h"
+
+enum class eInput_Event
+{
+	Key,
+	MouseButton,
+	MouseMove,
+	MouseWheel
+};
+
+// â ޽ ũƮ  Է ϳ.  ð Բ Ƽ  ȿ  Ͼ   ִ.
+struct InputEvent
+{
+	std::chrono::steady_clock::time_point timestamp;
+	eInput_Event type;
+
+	// _PushEvent 1 ʷ ű.
+	uint32_t id;
+
+	// Key  Ű, MouseButton eMouseButton ̴.
+	uint32_t code;
+	bool bPressed;
+	int32_t scrollWheel;
+
+	// Ŭ̾Ʈ  ǥ
+	D2D1_POINT_2F mousePosition;
+};
+
+// Է  ̺Ʈ ť ̰,      ¿ ݿȴ.
+//   ȿ   Ű GetKeyDown GetKeyUp   Ǿ  ʴ´.
 class Input final
 {
 public:
@@ -31,6 +61,12 @@ public:
 	[[nodiscard]] bool GetMouseButtonDown(const eMouseButton button) const;
 	[[nodiscard]] bool GetMouseButtonUp(const eMouseButton button) const;
 
+	// ̹ ӿ ư ó       ð().  ʾ 0̴.
+	[[nodiscard]] float GetMouseButtonDownElapsedTime(const eMouseButton button) const;
+
+	// ư  ְų ̹ ӿ ٸ  ư  ̺Ʈ. ƴϸ nullptr̴.
+	[[nodiscard]] const InputEvent* GetMouseButtonPressEventOrNull(const eMouseButton button) const;
+
 	[[nodiscard]] D2D1_POINT_2F GetMousePosition() const;
 	[[nodiscard]] int GetMouseScrollWheel() const;
 
@@ -40,10 +76,20 @@ public:
 	[[nodiscard]] eCursorLockState GetCursorLockState() const;
 	void SetCursorLockState(const eCursorLockState cursorLockState);
 
+public:
+	// ̺Ʈ  ¸ ٷ ٲ  .
+	static constexpr uint32_t INVALID_EVENT_ID = 0;
+
 public:
 	void _Initialize(const HWND hWnd);
 	void _Clear();
 
+	//  常 ִ´. â ޽ óϴ ̰ų ũƮ Է  .
+	void _PushEvent(const InputEvent& event);
+
+	//  ̺Ʈ   ¿ ݿѴ. frameTime GetMouseButtonDownElapsedTime  ð̴.
+	void _ProcessEvents(const std::chrono::steady_clock::time_point frameTime);
+
 	void _SetKeyState(const uint32_t virtualKey, const bool bPressed);
 	void _SetMouseButtonState(const eMouseButton button, const bool bPressed);
 	void _SetMousePosition(const D2D1_POINT_2F mousePosition);
@@ -52,6 +98,9 @@ public:
 	void _ConfineCursor() const;
 	void _RenewScreenCenterPosition();
 
+private:
+	void setMouseButtonState(const eMouseButton button, const bool bPressed, const InputEvent& event);
+
 private:
 	Input() = default;
 	Input(const Input&) = delete;
@@ -62,12 +111,23 @@ private:
 	HWND mHWnd = nullptr;
 	D2D1_POINT_2L mScreenCenterPosition{};
 
+	// ť   ̺Ʈ Ƿ,  ӿ ġ  ŭ д.
+	static constexpr uint32_t EVENT_QUEUE_SIZE = 1024;
+	SpscQueue<InputEvent, EVENT_QUEUE_SIZE> mEvents{};
+	uint64_t mDroppedEventCount = 0;
+	uint32_t mLastEventId = INVALID_EVENT_ID;
+
+	std::chrono::steady_clock::time_point mFrameTime{};
+
 	static constexpr size_t VIRTUAL_KEY_COUNT = 256;
 	std::bitset<VIRTUAL_KEY_COUNT> mbKeysPressed{};
-	std::bitset<VIRTUAL_KEY_COUNT> mbKeysStateChanged{};
+	std::bitset<VIRTUAL_KEY_COUNT> mbKeysDown{};
+	std::bitset<VIRTUAL_KEY_COUNT> mbKeysUp{};
 
 	bool mbMouseButtonPressed[size_t(eMouseButton::Count)]{};
-	bool mbMouseButtonStateChanged[size_t(eMouseButton::Count)]{};
+	bool mbMouseButtonDown[size_t(eMouseButton::Count)]{};
+	bool mbMouseButtonUp[size_t(eMouseButton::Count)]{};
+	InputEvent mMouseButtonDownEvents[size_t(eMouseButton::Count)]{};
 	D2D1_POINT_2F mMousePosition{};
 	int32_t mMouseScrollWheel = 0;
 
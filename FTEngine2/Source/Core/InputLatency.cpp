@@ -0,0 +1,80 @@
+#include "pch.h"
+#include "InputLatency.h"
+
+#include "Input.h"
+
+using namespace std::chrono;
+
+InputLatency& InputLatency::Get()
+{
+	static InputLatency inputLatency;
+	return inputLatency;
+}
+
+void InputLatency::Reflect(const InputEvent& event)
+{
+	// ̺Ʈ ȣ þ⸸ ϹǷ  ǥ ȣ ϴ ̹ ݿ ̴.
+	if (event.id == Input::INVALID_EVENT_ID or event.id <= mLastEventId)
+	{
+		return;
+	}
+
+	mLastEventId = event.id;
+
+	if (mPendingCount == MAX_PENDING_COUNT)
+	{
+		return;
+	}
+
+	mPendingEvents[mPendingCount] = { .eventId = event.id, .timestamp = event.timestamp };
+	++mPendingCount;
+}
+
+void InputLatency::Present(const steady_clock::time_point presentTime)
+{
+	for (uint32_t i = 0; i < mPendingCount; ++i)
+	{
+		const int64_t latency = duration_cast<microseconds>(presentTime - mPendingEvents[i].timestamp).count();
+
+		mMicroseconds[mSampleCount % RING_SIZE] = uint32_t(std::clamp(latency, int64_t(0), int64_t(UINT32_MAX)));
+		++mSampleCount;
+	}
+
+	mPendingCount = 0;
+}
+
+void InputLatency::Reset()
+{
+	mPendingCount = 0;
+	mSampleCount = 0;
+}
+
+InputLatencyStatistics InputLatency::GetStatistics() const
+{
+	InputLatencyStatistics statistics{ .sampleCount = mSampleCount };
+
+	const uint32_t count = uint32_t(min(mSampleCount, uint64_t(RING_SIZE)));
+
+	if (count == 0)
+	{
+		return statistics;
+	}
+
+	uint32_t sorted[RING_SIZE];
+	std::copy(mMicroseconds, mMicroseconds + count, sorted);
+	std::sort(sorted, sorted + count);
+
+	uint64_t total = 0;
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		total += sorted[i];
+	}
+
+	statistics.meanMilliseconds = float(double(total) / double(count) * 0.001);
+	statistics.p50Milliseconds = sorted[uint32_t(float(count - 1) * 0.5f)] * 0.001f;
+	statistics.p95Milliseconds = sorted[uint32_t(float(count - 1) * 0.95f)] * 0.001f;
+	statistics.p99Milliseconds = sorted[uint32_t(float(count - 1) * 0.99f)] * 0.001f;
+	statistics.maxMilliseconds = sorted[count - 1] * 0.001f;
+
+	return statistics;
+}
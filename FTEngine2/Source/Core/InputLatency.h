@@ -0,0 +1,54 @@
+#pragma once
+
+struct InputEvent;
+
+struct InputLatencyStatistics
+{
+	uint64_t sampleCount;
+	float meanMilliseconds;
+	float p50Milliseconds;
+	float p95Milliseconds;
+	float p99Milliseconds;
+	float maxMilliseconds;
+};
+
+// Է ̺Ʈ    Է ݿ    ð .
+//  Է¿ ó  ӿ Reflect ̺Ʈ ǥϸ,     Present  Ѵ.
+// â   ƽ ģ ð Present Ѱܼ   .
+class InputLatency final
+{
+public:
+	[[nodiscard]] static InputLatency& Get();
+
+	//  ̺Ʈ ó   ǥõȴ.
+	void Reflect(const InputEvent& event);
+	void Present(const std::chrono::steady_clock::time_point presentTime);
+
+	void Reset();
+
+	// ֱ RING_SIZE  Ѵ.
+	[[nodiscard]] InputLatencyStatistics GetStatistics() const;
+
+private:
+	InputLatency() = default;
+	InputLatency(const InputLatency&) = delete;
+	InputLatency& operator=(const InputLatency&) = delete;
+	~InputLatency() = default;
+
+	struct PendingEvent
+	{
+		uint32_t eventId;
+		std::chrono::steady_clock::time_point timestamp;
+	};
+
+private:
+	static constexpr uint32_t MAX_PENDING_COUNT = 16;
+	static constexpr uint32_t RING_SIZE = 1024;
+
+	PendingEvent mPendingEvents[MAX_PENDING_COUNT]{};
+	uint32_t mPendingCount = 0;
+	uint32_t mLastEventId = 0;
+
+	uint32_t mMicroseconds[RING_SIZE]{};
+	uint64_t mSampleCount = 0;
+};
\ No newline at end of file
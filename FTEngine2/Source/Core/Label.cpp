@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Label.h"
 
+#include "AllocationTracker.h"
 #include "Font.h"
 
 const Font* Label::GetFontOrNull() const
@@ -12,28 +13,48 @@ void Label::SetFont(Font* font)
 {
 	ASSERT(font != nullptr);
 
+	AllocationZone zone(eAllocation_Zone::Label);
+
 	mFont = font;
-	mTextSize = mFont->_CalculateTextSize(mText);
+	updateTextSize();
 }
 
-const std::wstring& Label::GetText() const
+std::wstring_view Label::GetText() const
 {
-	return mText;
+	if (mTextLength <= INLINE_CAPACITY)
+	{
+		return std::wstring_view(mInlineText, mTextLength);
+	}
+
+	return mLongText;
 }
 
-const std::wstring& Label::GetTextByWStr() const
+std::wstring_view Label::GetTextByWStr() const
 {
-	return mText;
+	return GetText();
 }
 
-void Label::SetText(const std::wstring& text)
+void Label::SetText(const std::wstring_view text)
 {
-	mText = text;
+	if (text == GetText())
+	{
+		return;
+	}
 
-	if (mFont != nullptr)
+	AllocationZone zone(eAllocation_Zone::Label);
+
+	//  ڴ mLongText 뷮 ٽ Ƿ    ҴѴ.
+	if (text.size() <= INLINE_CAPACITY)
+	{
+		std::copy(text.begin(), text.end(), mInlineText);
+	}
+	else
 	{
-		mTextSize = mFont->_CalculateTextSize(mText);
+		mLongText.assign(text);
 	}
+
+	mTextLength = uint32_t(text.size());
+	updateTextSize();
 }
 
 const D2D1_SIZE_F Label::GetTextSize() const
@@ -115,3 +136,58 @@ Font* Label::_GetFontOrNull() const
 {
 	return mFont;
 }
+
+void Label::appendText(FormatBuffer* buffer, const std::wstring_view text)
+{
+	ASSERT(buffer != nullptr);
+	ASSERT(buffer->length + text.size() <= INLINE_CAPACITY);
+
+	const size_t count = min(text.size(), size_t(INLINE_CAPACITY - buffer->length));
+	std::copy(text.begin(), text.begin() + count, buffer->text + buffer->length);
+	buffer->length += uint32_t(count);
+}
+
+void Label::appendInteger(FormatBuffer* buffer, const int64_t value)
+{
+	char chars[24];
+	const std::to_chars_result result = std::to_chars(chars, chars + std::size(chars), value);
+
+	appendChars(buffer, chars, result.ptr);
+}
+
+void Label::appendUnsigned(FormatBuffer* buffer, const uint64_t value)
+{
+	char chars[24];
+	const std::to_chars_result result = std::to_chars(chars, chars + std::size(chars), value);
+
+	appendChars(buffer, chars, result.ptr);
+}
+
+void Label::appendFloat(FormatBuffer* buffer, const float value)
+{
+	char chars[64];
+	const std::to_chars_result result = std::to_chars(chars, chars + std::size(chars), value, std::chars_format::fixed, 2);
+
+	appendChars(buffer, chars, result.ec == std::errc() ? result.ptr : chars);
+}
+
+void Label::appendChars(FormatBuffer* buffer, const char* first, const char* last)
+{
+	ASSERT(buffer != nullptr);
+	ASSERT(buffer->length + size_t(last - first) <= INLINE_CAPACITY);
+
+	// to_chars ASCII Ƿ ״ .
+	for (const char* c = first; c != last and buffer->length < INLINE_CAPACITY; ++c)
+	{
+		buffer->text[buffer->length] = wchar_t(*c);
+		++buffer->length;
+	}
+}
+
+void Label::updateTextSize()
+{
+	if (mFont != nullptr)
+	{
+		mTextSize = mFont->_CalculateTextSize(GetText());
+	}
+}
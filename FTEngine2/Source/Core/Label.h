@@ -2,6 +2,7 @@
 
 class Font;
 
+// INLINE_CAPACITY  ڴ  ȿ ؼ ڸ ٲ㵵  Ҵ ʴ´.
 class Label final
 {
 public:
@@ -12,9 +13,15 @@ public:
 	[[nodiscard]] const Font* GetFontOrNull() const;
 	void SetFont(Font* font);
 
-	[[nodiscard]] const std::wstring& GetText() const;
-	[[nodiscard]] const std::wstring& GetTextByWStr() const;
-	void SetText(const std::wstring& text);
+	[[nodiscard]] std::wstring_view GetText() const;
+	[[nodiscard]] std::wstring_view GetTextByWStr() const;
+
+	// ڰ ݰ   ũ⸦ ٽ  ʴ´.
+	void SetText(const std::wstring_view text);
+
+	//  , , Ǽ ̾ ٿ SetTextѴ. Ǽ Ҽ Ʒ  ڸ .
+	template <typename... Args>
+	void Format(const Args&... args);
 
 	[[nodiscard]] const D2D1_SIZE_F GetTextSize() const;
 
@@ -42,10 +49,32 @@ public:
 public:
 	[[nodiscard]] Font* _GetFontOrNull() const;
 
+private:
+	static constexpr uint32_t INLINE_CAPACITY = 64;
+
+	struct FormatBuffer
+	{
+		wchar_t text[INLINE_CAPACITY];
+		uint32_t length;
+	};
+
+	template <typename T>
+	static void appendArgument(FormatBuffer* buffer, const T& argument);
+
+	static void appendText(FormatBuffer* buffer, const std::wstring_view text);
+	static void appendInteger(FormatBuffer* buffer, const int64_t value);
+	static void appendUnsigned(FormatBuffer* buffer, const uint64_t value);
+	static void appendFloat(FormatBuffer* buffer, const float value);
+	static void appendChars(FormatBuffer* buffer, const char* first, const char* last);
+
+	void updateTextSize();
+
 private:
 	Font* mFont = nullptr;
 
-	std::wstring mText{};
+	wchar_t mInlineText[INLINE_CAPACITY]{};
+	std::wstring mLongText{};
+	uint32_t mTextLength = 0;
 	D2D1_SIZE_F mTextSize{};
 
 	bool mbActive = true;
@@ -55,4 +84,36 @@ private:
 	float mAngle = 0.0f;
 	float mOpacity = 1.0f;
 	bool mbUI = false;
-};
\ No newline at end of file
+};
+
+template <typename... Args>
+void Label::Format(const Args&... args)
+{
+	FormatBuffer buffer;
+	buffer.length = 0;
+
+	(appendArgument(&buffer, args), ...);
+
+	SetText(std::wstring_view(buffer.text, buffer.length));
+}
+
+template <typename T>
+void Label::appendArgument(FormatBuffer* buffer, const T& argument)
+{
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		appendFloat(buffer, float(argument));
+	}
+	else if constexpr (std::is_integral_v<T> and std::is_signed_v<T>)
+	{
+		appendInteger(buffer, int64_t(argument));
+	}
+	else if constexpr (std::is_integral_v<T>)
+	{
+		appendUnsigned(buffer, uint64_t(argument));
+	}
+	else
+	{
+		appendText(buffer, std::wstring_view(argument));
+	}
+}
\ No newline at end of file
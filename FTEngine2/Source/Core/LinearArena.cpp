@@ -0,0 +1,93 @@
+#include "pch.h"
+#include "LinearArena.h"
+
+void LinearArena::Initialize(const LinearArenaDesc& desc)
+{
+	ASSERT(desc.capacity > 0);
+	ASSERT(mBuffer == nullptr);
+
+	mCapacity = desc.capacity;
+	mBuffer = static_cast<uint8_t*>(::operator new(mCapacity, std::align_val_t(alignof(std::max_align_t))));
+
+	Release();
+}
+
+void LinearArena::Finalize()
+{
+	if (mBuffer != nullptr)
+	{
+		::operator delete(mBuffer, std::align_val_t(alignof(std::max_align_t)));
+		mBuffer = nullptr;
+	}
+
+	mCapacity = 0;
+	mOffset = 0;
+}
+
+void LinearArena::Release()
+{
+	mOffset = 0;
+	mPeakBytes = 0;
+	mOverflowBytes = 0;
+}
+
+size_t LinearArena::GetCapacity() const
+{
+	return mCapacity;
+}
+
+size_t LinearArena::GetUsedBytes() const
+{
+	return mOffset;
+}
+
+size_t LinearArena::GetPeakBytes() const
+{
+	return mPeakBytes;
+}
+
+size_t LinearArena::GetOverflowBytes() const
+{
+	return mOverflowBytes;
+}
+
+void* LinearArena::do_allocate(const size_t bytes, const size_t alignment)
+{
+	const uintptr_t address = reinterpret_cast<uintptr_t>(mBuffer) + mOffset;
+	const uintptr_t alignedAddress = (address + alignment - 1) & ~uintptr_t(alignment - 1);
+	const size_t endOffset = size_t(alignedAddress - reinterpret_cast<uintptr_t>(mBuffer)) + bytes;
+
+	// ģ   GetOverflowBytes ˸.
+	if (mBuffer == nullptr or endOffset > mCapacity)
+	{
+		mOverflowBytes += bytes;
+		return ::operator new(bytes, std::align_val_t(alignment));
+	}
+
+	mOffset = endOffset;
+	mPeakBytes = max(mPeakBytes, mOffset);
+
+	return reinterpret_cast<void*>(alignedAddress);
+}
+
+void LinearArena::do_deallocate(void* memory, const size_t bytes, const size_t alignment)
+{
+	// Ʒ  ޸𸮴 Release   .
+	if (isInBuffer(memory))
+	{
+		return;
+	}
+
+	::operator delete(memory, bytes, std::align_val_t(alignment));
+}
+
+bool LinearArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	return this == &other;
+}
+
+bool LinearArena::isInBuffer(const void* memory) const
+{
+	const uint8_t* address = static_cast<const uint8_t*>(memory);
+	return mBuffer <= address and address < mBuffer + mCapacity;
+}
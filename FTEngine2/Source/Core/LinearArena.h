@@ -0,0 +1,41 @@
+#pragma once
+
+struct LinearArenaDesc
+{
+	const size_t capacity;
+};
+
+// տ ߶ ֱ⸸ ϴ Ҵ.    ʰ Release   .
+// 뷮    Ҵϰ ģ  GetOverflowBytes ˸.
+class LinearArena final : public std::pmr::memory_resource
+{
+public:
+	LinearArena() = default;
+	LinearArena(const LinearArena&) = delete;
+	LinearArena& operator=(const LinearArena&) = delete;
+	~LinearArena() override = default;
+
+	void Initialize(const LinearArenaDesc& desc);
+	void Finalize();
+
+	void Release();
+
+	[[nodiscard]] size_t GetCapacity() const;
+	[[nodiscard]] size_t GetUsedBytes() const;
+	[[nodiscard]] size_t GetPeakBytes() const;
+	[[nodiscard]] size_t GetOverflowBytes() const;
+
+private:
+	void* do_allocate(const size_t bytes, const size_t alignment) override;
+	void do_deallocate(void* memory, const size_t bytes, const size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	[[nodiscard]] bool isInBuffer(const void* memory) const;
+
+private:
+	uint8_t* mBuffer = nullptr;
+	size_t mCapacity = 0;
+	size_t mOffset = 0;
+	size_t mPeakBytes = 0;
+	size_t mOverflowBytes = 0;
+};
\ No newline at end of file
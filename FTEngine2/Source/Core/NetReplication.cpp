@@ -0,0 +1,581 @@
+#include "pch.h"
+#include "NetReplication.h"
+
+#include "BitStream.h"
+
+using namespace std::chrono;
+using namespace NetProtocol;
+
+namespace
+{
+	//  ԰  °     Ѵ.
+	constexpr NetEntityState EMPTY_ENTITY_STATE{};
+
+	constexpr int32_t MAX_POSITION_DELTA = (1 << (POSITION_DELTA_BITS - 1)) - 1;
+
+	bool isSameEntityState(const NetEntityState& lhs, const NetEntityState& rhs)
+	{
+		return lhs.bActive == rhs.bActive and lhs.x == rhs.x and lhs.y == rhs.y and lhs.hp == rhs.hp and lhs.state == rhs.state;
+	}
+
+	void writeEntityState(BitWriter* writer, const NetEntityState& baseline, const NetEntityState& state)
+	{
+		if (isSameEntityState(baseline, state))
+		{
+			writer->WriteBool(false);
+			return;
+		}
+
+		writer->WriteBool(true);
+		writer->WriteBool(state.bActive);
+
+		if (not state.bActive)
+		{
+			return;
+		}
+
+		const int32_t deltaX = int32_t(state.x) - int32_t(baseline.x);
+		const int32_t deltaY = int32_t(state.y) - int32_t(baseline.y);
+		const bool bSmallDelta = abs(deltaX) <= MAX_POSITION_DELTA and abs(deltaY) <= MAX_POSITION_DELTA;
+
+		writer->WriteBool(bSmallDelta);
+
+		if (bSmallDelta)
+		{
+			writer->WriteSigned(deltaX, POSITION_DELTA_BITS);
+			writer->WriteSigned(deltaY, POSITION_DELTA_BITS);
+		}
+		else
+		{
+			writer->WriteBits(state.x, POSITION_BITS);
+			writer->WriteBits(state.y, POSITION_BITS);
+		}
+
+		writer->WriteBool(state.hp != baseline.hp);
+		if (state.hp != baseline.hp)
+		{
+			writer->WriteBits(state.hp, HP_BITS);
+		}
+
+		writer->WriteBool(state.state != baseline.state);
+		if (state.state != baseline.state)
+		{
+			writer->WriteBits(state.state, STATE_BITS);
+		}
+	}
+
+	NetEntityState readEntityState(BitReader* reader, const NetEntityState& baseline)
+	{
+		if (not reader->ReadBool())
+		{
+			return baseline;
+		}
+
+		if (not reader->ReadBool())
+		{
+			return EMPTY_ENTITY_STATE;
+		}
+
+		NetEntityState state = baseline;
+		state.bActive = true;
+
+		if (reader->ReadBool())
+		{
+			state.x = uint16_t(int32_t(baseline.x) + reader->ReadSigned(POSITION_DELTA_BITS));
+			state.y = uint16_t(int32_t(baseline.y) + reader->ReadSigned(POSITION_DELTA_BITS));
+		}
+		else
+		{
+			state.x = uint16_t(reader->ReadBits(POSITION_BITS));
+			state.y = uint16_t(reader->ReadBits(POSITION_BITS));
+		}
+
+		if (reader->ReadBool())
+		{
+			state.hp = uint16_t(reader->ReadBits(HP_BITS));
+		}
+
+		if (reader->ReadBool())
+		{
+			state.state = uint8_t(reader->ReadBits(STATE_BITS));
+		}
+
+		return state;
+	}
+}
+
+uint16_t QuantizeNetPosition(const float value)
+{
+	constexpr float MAX_VALUE = float((1u << POSITION_BITS) - 1);
+
+	const float t = (value + WORLD_EXTENT) / (WORLD_EXTENT * 2.0f);
+	return uint16_t(std::clamp(t, 0.0f, 1.0f) * MAX_VALUE + 0.5f);
+}
+
+float DequantizeNetPosition(const uint16_t value)
+{
+	constexpr float MAX_VALUE = float((1u << POSITION_BITS) - 1);
+
+	return float(value) / MAX_VALUE * (WORLD_EXTENT * 2.0f) - WORLD_EXTENT;
+}
+
+NetEntityState MakeNetEntityState(const bool bActive, const D2D1_POINT_2F position, const int32_t hp, const uint8_t state)
+{
+	if (not bActive)
+	{
+		return EMPTY_ENTITY_STATE;
+	}
+
+	const NetEntityState result =
+	{
+		.x = QuantizeNetPosition(position.x),
+		.y = QuantizeNetPosition(position.y),
+		.hp = uint16_t(std::clamp(hp, 0, int32_t(UINT16_MAX))),
+		.state = state,
+		.bActive = true
+	};
+
+	return result;
+}
+
+uint32_t NetProtocol::GetChunkCount(const uint32_t slotCount)
+{
+	return (slotCount + SLOTS_PER_CHUNK - 1) / SLOTS_PER_CHUNK;
+}
+
+bool NetServer::Initialize(const NetServerDesc& desc)
+{
+	ASSERT(desc.slotCount > 0);
+
+	if (not mSocket.Initialize(desc.socket))
+	{
+		return false;
+	}
+
+	mSlotCount = desc.slotCount;
+	mChunkCount = GetChunkCount(desc.slotCount);
+
+	for (Client& client : mClients)
+	{
+		client.port = 0;
+		client.ackedTicks.assign(mChunkCount, 0);
+	}
+	mClientCount = 0;
+
+	mHistory.assign(size_t(HISTORY_COUNT) * mSlotCount, EMPTY_ENTITY_STATE);
+	mHistoryTicks.fill(0);
+
+	mPackets.clear();
+	mPackets.reserve(size_t(mChunkCount) * MAX_CLIENT_COUNT);
+
+	mDeltaChunkCount = 0;
+	mFullChunkCount = 0;
+
+	return true;
+}
+
+void NetServer::Finalize()
+{
+	mSocket.Finalize();
+
+	mClientCount = 0;
+	mHistory.clear();
+	mPackets.clear();
+}
+
+void NetServer::ReceivePackets()
+{
+	NetPacket packet;
+
+	while (mSocket.Receive(packet.data, sizeof(packet.data), &packet.size, &packet.port))
+	{
+		BitReader reader(packet.data, packet.size);
+		const ePacket_Type type = ePacket_Type(reader.ReadBits(TYPE_BITS));
+
+		//    Ŷ .
+		if (reader.IsOverflowed())
+		{
+			continue;
+		}
+
+		switch (type)
+		{
+		case ePacket_Type::Connect:
+			addClient(packet.port);
+			break;
+
+		case ePacket_Type::Ack:
+			for (uint32_t i = 0; i < mClientCount; ++i)
+			{
+				if (mClients[i].port == packet.port)
+				{
+					receiveAck(&mClients[i], packet);
+					break;
+				}
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
+void NetServer::EncodeSnapshot(const NetWorldState& state)
+{
+	ASSERT(state.entities.size() == mSlotCount);
+	ASSERT(state.tick > 0);
+
+	if (mClientCount == 0)
+	{
+		return;
+	}
+
+	const uint32_t historyIndex = state.tick % HISTORY_COUNT;
+	std::copy(state.entities.begin(), state.entities.end(), mHistory.begin() + size_t(historyIndex) * mSlotCount);
+	mHistoryTicks[historyIndex] = state.tick;
+
+	for (uint32_t clientIndex = 0; clientIndex < mClientCount; ++clientIndex)
+	{
+		const Client& client = mClients[clientIndex];
+
+		for (uint32_t chunkIndex = 0; chunkIndex < mChunkCount; ++chunkIndex)
+		{
+			// Ȯι °     ¿ ̸ .
+			const uint32_t ackedTick = client.ackedTicks[chunkIndex];
+			const NetEntityState* baseline = nullptr;
+			uint32_t baselineDistance = 0;
+
+			if (ackedTick != 0 and ackedTick < state.tick and state.tick - ackedTick < HISTORY_COUNT)
+			{
+				baseline = GetHistoryOrNull(ackedTick);
+				baselineDistance = baseline != nullptr ? state.tick - ackedTick : 0;
+			}
+
+			NetPacket& packet = mPackets.emplace_back();
+			packet.port = client.port;
+
+			BitWriter writer(packet.data, sizeof(packet.data));
+			writer.WriteBits(uint32_t(ePacket_Type::Snapshot), TYPE_BITS);
+			writer.WriteBits(state.tick, TICK_BITS);
+			writer.WriteBits(chunkIndex, CHUNK_BITS);
+			writer.WriteBits(baselineDistance, BASELINE_DISTANCE_BITS);
+
+			const uint32_t slotBegin = chunkIndex * SLOTS_PER_CHUNK;
+			const uint32_t slotEnd = min(slotBegin + SLOTS_PER_CHUNK, mSlotCount);
+
+			for (uint32_t slot = slotBegin; slot < slotEnd; ++slot)
+			{
+				writeEntityState(&writer, baseline != nullptr ? baseline[slot] : EMPTY_ENTITY_STATE, state.entities[slot]);
+			}
+
+			packet.size = writer.Flush();
+			MASSERT(not writer.IsOverflowed(), "ûũ Ŷ ϳ  ʽϴ.");
+
+			if (baseline != nullptr)
+			{
+				++mDeltaChunkCount;
+			}
+			else
+			{
+				++mFullChunkCount;
+			}
+		}
+	}
+}
+
+void NetServer::SendPackets(const steady_clock::time_point now)
+{
+	for (const NetPacket& packet : mPackets)
+	{
+		mSocket.Send(packet.port, packet.data, packet.size, now);
+	}
+
+	mPackets.clear();
+	mSocket.Update(now);
+}
+
+uint16_t NetServer::GetPort() const
+{
+	return mSocket.GetPort();
+}
+
+uint32_t NetServer::GetClientCount() const
+{
+	return mClientCount;
+}
+
+const NetSocketStatistics& NetServer::GetSocketStatistics() const
+{
+	return mSocket.GetStatistics();
+}
+
+uint64_t NetServer::GetDeltaChunkCount() const
+{
+	return mDeltaChunkCount;
+}
+
+uint64_t NetServer::GetFullChunkCount() const
+{
+	return mFullChunkCount;
+}
+
+const NetEntityState* NetServer::GetHistoryOrNull(const uint32_t tick) const
+{
+	const uint32_t historyIndex = tick % HISTORY_COUNT;
+
+	if (tick == 0 or mHistoryTicks[historyIndex] != tick)
+	{
+		return nullptr;
+	}
+
+	return &mHistory[size_t(historyIndex) * mSlotCount];
+}
+
+void NetServer::addClient(const uint16_t port)
+{
+	//  û    ٽ Ƿ ̹ ִ Ŭ̾Ʈ Ѵ.
+	for (uint32_t i = 0; i < mClientCount; ++i)
+	{
+		if (mClients[i].port == port)
+		{
+			return;
+		}
+	}
+
+	if (mClientCount == MAX_CLIENT_COUNT)
+	{
+		LOG("Net client %u rejected: server is full", port);
+		return;
+	}
+
+	Client& client = mClients[mClientCount];
+	client.port = port;
+	std::fill(client.ackedTicks.begin(), client.ackedTicks.end(), 0);
+	++mClientCount;
+
+	LOG("Net client %u connected", port);
+}
+
+void NetServer::receiveAck(Client* client, const NetPacket& packet)
+{
+	BitReader reader(packet.data, packet.size);
+	void(reader.ReadBits(TYPE_BITS));
+
+	const uint32_t ackCount = reader.ReadBits(ACK_COUNT_BITS);
+
+	for (uint32_t i = 0; i < ackCount; ++i)
+	{
+		const uint32_t tick = reader.ReadBits(TICK_BITS);
+		const uint32_t chunkIndex = reader.ReadBits(CHUNK_BITS);
+
+		if (reader.IsOverflowed())
+		{
+			return;
+		}
+
+		// Ȯ  ٲ   Ƿ   ƽ .
+		if (chunkIndex < mChunkCount and tick > client->ackedTicks[chunkIndex])
+		{
+			client->ackedTicks[chunkIndex] = tick;
+		}
+	}
+}
+
+bool NetClient::Initialize(const NetClientDesc& desc)
+{
+	ASSERT(desc.slotCount > 0);
+
+	if (not mSocket.Initialize(desc.socket))
+	{
+		return false;
+	}
+
+	mServerPort = desc.serverPort;
+	mSlotCount = desc.slotCount;
+	mChunkCount = GetChunkCount(desc.slotCount);
+
+	mState.tick = 0;
+	mState.entities.assign(mSlotCount, EMPTY_ENTITY_STATE);
+	mChunkTicks.assign(mChunkCount, 0);
+
+	mHistory.assign(size_t(HISTORY_COUNT) * mSlotCount, EMPTY_ENTITY_STATE);
+	mHistoryChunkTicks.assign(size_t(HISTORY_COUNT) * mChunkCount, 0);
+
+	//   ޴ Ŷ ƽ   з  ʴ´. ġ  ޴´.
+	mPackets.clear();
+	mPackets.reserve(size_t(mChunkCount) * 4 + 16);
+	mAcks.clear();
+	mAcks.reserve(mPackets.capacity());
+
+	mbConnected = false;
+	mDiscardedPacketCount = 0;
+
+	return true;
+}
+
+void NetClient::Finalize()
+{
+	mSocket.Finalize();
+
+	mState.entities.clear();
+	mHistory.clear();
+	mPackets.clear();
+	mAcks.clear();
+}
+
+void NetClient::ReceivePackets()
+{
+	while (mPackets.size() < mPackets.capacity())
+	{
+		NetPacket& packet = mPackets.emplace_back();
+
+		if (not mSocket.Receive(packet.data, sizeof(packet.data), &packet.size, &packet.port))
+		{
+			mPackets.pop_back();
+			break;
+		}
+
+		if (packet.port != mServerPort)
+		{
+			mPackets.pop_back();
+		}
+	}
+}
+
+void NetClient::DecodeSnapshots()
+{
+	for (const NetPacket& packet : mPackets)
+	{
+		decodeSnapshot(packet);
+	}
+
+	mPackets.clear();
+}
+
+void NetClient::SendPackets(const steady_clock::time_point now)
+{
+	NetPacket packet;
+
+	if (not mbConnected)
+	{
+		BitWriter writer(packet.data, sizeof(packet.data));
+		writer.WriteBits(uint32_t(ePacket_Type::Connect), TYPE_BITS);
+
+		packet.size = writer.Flush();
+		mSocket.Send(mServerPort, packet.data, packet.size, now);
+	}
+
+	for (uint32_t ackBegin = 0; ackBegin < uint32_t(mAcks.size()); ackBegin += MAX_ACK_COUNT_PER_PACKET)
+	{
+		const uint32_t ackCount = min(uint32_t(mAcks.size()) - ackBegin, MAX_ACK_COUNT_PER_PACKET);
+
+		BitWriter writer(packet.data, sizeof(packet.data));
+		writer.WriteBits(uint32_t(ePacket_Type::Ack), TYPE_BITS);
+		writer.WriteBits(ackCount, ACK_COUNT_BITS);
+
+		for (uint32_t i = ackBegin; i < ackBegin + ackCount; ++i)
+		{
+			writer.WriteBits(mAcks[i].tick, TICK_BITS);
+			writer.WriteBits(mAcks[i].chunkIndex, CHUNK_BITS);
+		}
+
+		packet.size = writer.Flush();
+		ASSERT(not writer.IsOverflowed());
+
+		mSocket.Send(mServerPort, packet.data, packet.size, now);
+	}
+
+	mAcks.clear();
+	mSocket.Update(now);
+}
+
+const NetWorldState& NetClient::GetState() const
+{
+	return mState;
+}
+
+uint32_t NetClient::GetChunkTick(const uint32_t chunkIndex) const
+{
+	return mChunkTicks[chunkIndex];
+}
+
+const NetSocketStatistics& NetClient::GetSocketStatistics() const
+{
+	return mSocket.GetStatistics();
+}
+
+uint64_t NetClient::GetDiscardedPacketCount() const
+{
+	return mDiscardedPacketCount;
+}
+
+void NetClient::decodeSnapshot(const NetPacket& packet)
+{
+	BitReader reader(packet.data, packet.size);
+
+	if (ePacket_Type(reader.ReadBits(TYPE_BITS)) != ePacket_Type::Snapshot)
+	{
+		return;
+	}
+
+	mbConnected = true;
+
+	const uint32_t tick = reader.ReadBits(TICK_BITS);
+	const uint32_t chunkIndex = reader.ReadBits(CHUNK_BITS);
+	const uint32_t baselineDistance = reader.ReadBits(BASELINE_DISTANCE_BITS);
+
+	if (reader.IsOverflowed() or tick == 0 or chunkIndex >= mChunkCount or baselineDistance >= tick)
+	{
+		++mDiscardedPacketCount;
+		return;
+	}
+
+	//  °  Ǯ  Ƿ . Ȯ Ƿ    ̳ ü .
+	const NetEntityState* baseline = nullptr;
+
+	if (baselineDistance != 0)
+	{
+		const uint32_t baselineTick = tick - baselineDistance;
+		const uint32_t baselineIndex = baselineTick % HISTORY_COUNT;
+
+		if (mHistoryChunkTicks[size_t(baselineIndex) * mChunkCount + chunkIndex] != baselineTick)
+		{
+			++mDiscardedPacketCount;
+			return;
+		}
+
+		baseline = &mHistory[size_t(baselineIndex) * mSlotCount];
+	}
+
+	const uint32_t historyIndex = tick % HISTORY_COUNT;
+	NetEntityState* target = &mHistory[size_t(historyIndex) * mSlotCount];
+	uint32_t& historyChunkTick = mHistoryChunkTicks[size_t(historyIndex) * mChunkCount + chunkIndex];
+
+	const uint32_t slotBegin = chunkIndex * SLOTS_PER_CHUNK;
+	const uint32_t slotEnd = min(slotBegin + SLOTS_PER_CHUNK, mSlotCount);
+
+	for (uint32_t slot = slotBegin; slot < slotEnd; ++slot)
+	{
+		target[slot] = readEntityState(&reader, baseline != nullptr ? baseline[slot] : EMPTY_ENTITY_STATE);
+	}
+
+	// ߸ Ŷ̸  ڸ    ʰ Ѵ.
+	if (reader.IsOverflowed())
+	{
+		historyChunkTick = 0;
+		++mDiscardedPacketCount;
+		return;
+	}
+
+	historyChunkTick = tick;
+	mAcks.push_back({ .tick = tick, .chunkIndex = chunkIndex });
+
+	// ʰ  Ŷ θ   ¿ ݿ ʴ´.
+	if (tick > mChunkTicks[chunkIndex])
+	{
+		std::copy(target + slotBegin, target + slotEnd, mState.entities.begin() + slotBegin);
+		mChunkTicks[chunkIndex] = tick;
+		mState.tick = max(mState.tick, tick);
+	}
+}
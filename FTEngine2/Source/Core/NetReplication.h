@@ -0,0 +1,206 @@
+#pragma once
+
+#include "NetSocket.h"
+
+//  ϳ . ġ QuantizeNetPosition ٲ ̰, state  Ѵ.
+struct NetEntityState
+{
+	uint16_t x;
+	uint16_t y;
+	uint16_t hp;
+	uint8_t state;
+	bool bActive;
+};
+
+//     Ŭ̾Ʈ ƾ Ѵ. ƽ 0 ũ þ⸸ ؾ Ѵ.
+struct NetWorldState
+{
+	uint32_t tick;
+	std::vector<NetEntityState> entities;
+};
+
+struct NetServerDesc
+{
+	const uint32_t slotCount;
+	const NetSocketDesc socket;
+};
+
+struct NetClientDesc
+{
+	const uint32_t slotCount;
+	const uint16_t serverPort;
+	const NetSocketDesc socket;
+};
+
+[[nodiscard]] uint16_t QuantizeNetPosition(const float value);
+[[nodiscard]] float DequantizeNetPosition(const uint16_t value);
+
+//  ƼƼ   0 ּ  ִ   ٲ   ʰ Ѵ. hp 0 ~ UINT16_MAX ڸ.
+[[nodiscard]] NetEntityState MakeNetEntityState(const bool bActive, const D2D1_POINT_2F position, const int32_t hp, const uint8_t state);
+
+//  Ŭ̾Ʈ Բ  Ŷ İ  ڵ.
+//  SLOTS_PER_CHUNK ûũ  ûũ  Ŷ , ûũ  Ȯι޴´.
+// Ը ٲ  Ʈ , ٲ   ¿ ġ ̰  ̸, ũ ȭ ġ .
+namespace NetProtocol
+{
+	enum class ePacket_Type
+	{
+		Connect,
+		Snapshot,
+		Ack,
+		Count
+	};
+
+	constexpr uint32_t TYPE_BITS = 2;
+	constexpr uint32_t TICK_BITS = 32;
+	constexpr uint32_t CHUNK_BITS = 16;
+
+	// Ȯι ƽ ̸ŭ    ¿ ̸ . 0  ° ٴ ̴.
+	constexpr uint32_t HISTORY_COUNT = 32;
+	constexpr uint32_t BASELINE_DISTANCE_BITS = 5;
+
+	constexpr uint32_t SLOTS_PER_CHUNK = 128;
+
+	constexpr float WORLD_EXTENT = 2048.0f;
+	constexpr uint32_t POSITION_BITS = 16;
+	constexpr uint32_t POSITION_DELTA_BITS = 9;
+	constexpr uint32_t HP_BITS = 16;
+	constexpr uint32_t STATE_BITS = 8;
+
+	constexpr uint32_t ACK_COUNT_BITS = 8;
+	constexpr uint32_t MAX_ACK_COUNT_PER_PACKET = 128;
+
+	static_assert(HISTORY_COUNT <= (1u << BASELINE_DISTANCE_BITS));
+	static_assert(MAX_ACK_COUNT_PER_PACKET < (1u << ACK_COUNT_BITS));
+
+	[[nodiscard]] uint32_t GetChunkCount(const uint32_t slotCount);
+}
+
+struct NetPacket
+{
+	uint16_t port;
+	uint32_t size;
+	uint8_t data[NetSocket::MAX_PACKET_SIZE];
+};
+
+// MainSceneó ùķ̼  . ƽ ¸ ,  Ŭ̾Ʈ ûũ  Ȯι ¿ ̸ .
+// Ȯι ° HISTORY_COUNT ƽ Ǹ  ûũ ü .
+class NetServer final
+{
+public:
+	static constexpr uint32_t MAX_CLIENT_COUNT = 4;
+
+public:
+	NetServer() = default;
+	NetServer(const NetServer&) = delete;
+	NetServer& operator=(const NetServer&) = delete;
+
+	//   ϸ false ȯѴ.
+	[[nodiscard]] bool Initialize(const NetServerDesc& desc);
+	void Finalize();
+
+	//  û Ȯ óѴ.
+	void ReceivePackets();
+
+	// ¸   Ŷ . Ŭ̾Ʈ  ƹ͵  ʴ´.
+	void EncodeSnapshot(const NetWorldState& state);
+	void SendPackets(const std::chrono::steady_clock::time_point now);
+
+	[[nodiscard]] uint16_t GetPort() const;
+	[[nodiscard]] uint32_t GetClientCount() const;
+	[[nodiscard]] const NetSocketStatistics& GetSocketStatistics() const;
+
+	// ݱ  ûũ  ̷   ü  
+	[[nodiscard]] uint64_t GetDeltaChunkCount() const;
+	[[nodiscard]] uint64_t GetFullChunkCount() const;
+
+	//   tick . Ǿ  nullptr
+	[[nodiscard]] const NetEntityState* GetHistoryOrNull(const uint32_t tick) const;
+
+private:
+	struct Client
+	{
+		uint16_t port;
+
+		// ûũ Ȯι   ƽ
+		std::vector<uint32_t> ackedTicks;
+	};
+
+	void addClient(const uint16_t port);
+	void receiveAck(Client* client, const NetPacket& packet);
+
+private:
+	NetSocket mSocket{};
+	uint32_t mSlotCount = 0;
+	uint32_t mChunkCount = 0;
+
+	std::array<Client, MAX_CLIENT_COUNT> mClients{};
+	uint32_t mClientCount = 0;
+
+	// HISTORY_COUNT ƽ ¸ ƽ % HISTORY_COUNT ڸ д.
+	std::vector<NetEntityState> mHistory{};
+	std::array<uint32_t, NetProtocol::HISTORY_COUNT> mHistoryTicks{};
+
+	std::vector<NetPacket> mPackets{};
+
+	uint64_t mDeltaChunkCount = 0;
+	uint64_t mFullChunkCount = 0;
+};
+
+//    ޾ ¸ ǻ츮,  ûũ Ȯ ش.
+// ûũ  ϹǷ GetState ûũ ƽ ٸ  ִ.
+class NetClient final
+{
+public:
+	NetClient() = default;
+	NetClient(const NetClient&) = delete;
+	NetClient& operator=(const NetClient&) = delete;
+
+	//   ϸ false ȯѴ.
+	[[nodiscard]] bool Initialize(const NetClientDesc& desc);
+	void Finalize();
+
+	//  Ŷ  д.
+	void ReceivePackets();
+
+	//    Ǯ Ȯ ûũ .  ¸ ̹  Ŷ , ʰ  Ŷ θ .
+	void DecodeSnapshots();
+
+	//      û ٽ ,  Ȯ .
+	void SendPackets(const std::chrono::steady_clock::time_point now);
+
+	[[nodiscard]] const NetWorldState& GetState() const;
+	[[nodiscard]] uint32_t GetChunkTick(const uint32_t chunkIndex) const;
+	[[nodiscard]] const NetSocketStatistics& GetSocketStatistics() const;
+
+	//  °   Ŷ 
+	[[nodiscard]] uint64_t GetDiscardedPacketCount() const;
+
+private:
+	struct Ack
+	{
+		uint32_t tick;
+		uint32_t chunkIndex;
+	};
+
+	void decodeSnapshot(const NetPacket& packet);
+
+private:
+	NetSocket mSocket{};
+	uint16_t mServerPort = 0;
+	uint32_t mSlotCount = 0;
+	uint32_t mChunkCount = 0;
+
+	NetWorldState mState{};
+	std::vector<uint32_t> mChunkTicks{};
+
+	// ó HISTORY_COUNT ƽ , ûũ  ƽ ޶ ûũ ƽ ´.
+	std::vector<NetEntityState> mHistory{};
+	std::vector<uint32_t> mHistoryChunkTicks{};
+
+	std::vector<NetPacket> mPackets{};
+	std::vector<Ack> mAcks{};
+
+	bool mbConnected = false;
+	uint64_t mDiscardedPacketCount = 0;
+};
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include "pch.h"
+#include "NetSocket.h"
+
+#include <winsock2.h>
+#include <ws2tcpip.h>
+
+using namespace std::chrono;
+
+namespace
+{
+	//  ƽ   Ŷ Ƶ ޴  ۿ ġ ʵ ˳ ´.
+	constexpr int SOCKET_BUFFER_SIZE = 4 * 1024 * 1024;
+
+	sockaddr_in getLoopbackAddress(const uint16_t port)
+	{
+		sockaddr_in address{};
+		address.sin_family = AF_INET;
+		address.sin_port = htons(port);
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+		return address;
+	}
+}
+
+NetSocket::~NetSocket()
+{
+	Finalize();
+}
+
+bool NetSocket::Initialize(const NetSocketDesc& desc)
+{
+	ASSERT(mSocket == INVALID_SOCKET_HANDLE);
+	ASSERT(0.0f <= desc.condition.lossRate and desc.condition.lossRate <= 1.0f);
+	ASSERT(desc.condition.latencySeconds >= 0.0f and desc.condition.jitterSeconds >= 0.0f);
+
+	// WSAStartup ȣ Ƚ Ƿ ϸ θ Finalize  ŭ WSACleanupѴ.
+	WSADATA data{};
+	if (const int error = WSAStartup(MAKEWORD(2, 2), &data); error != 0)
+	{
+		LOG("Failed to call WSAStartup() (%d)", error);
+		return false;
+	}
+
+	const SOCKET handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (handle == INVALID_SOCKET)
+	{
+		LOG("Failed to create a UDP socket (%d)", WSAGetLastError());
+		WSACleanup();
+		return false;
+	}
+
+	mSocket = uintptr_t(handle);
+
+	u_long bNonBlocking = 1;
+	const sockaddr_in address = getLoopbackAddress(desc.port);
+
+	if (ioctlsocket(handle, FIONBIO, &bNonBlocking) != 0
+		or bind(handle, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+	{
+		LOG("Failed to bind a UDP socket to port %u (%d)", desc.port, WSAGetLastError());
+		Finalize();
+		return false;
+	}
+
+	setsockopt(handle, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&SOCKET_BUFFER_SIZE), sizeof(SOCKET_BUFFER_SIZE));
+	setsockopt(handle, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<const char*>(&SOCKET_BUFFER_SIZE), sizeof(SOCKET_BUFFER_SIZE));
+
+	sockaddr_in boundAddress{};
+	int addressSize = sizeof(boundAddress);
+	getsockname(handle, reinterpret_cast<sockaddr*>(&boundAddress), &addressSize);
+	mPort = ntohs(boundAddress.sin_port);
+
+	mLossRate = desc.condition.lossRate;
+	mLatencySeconds = desc.condition.latencySeconds;
+	mJitterSeconds = desc.condition.jitterSeconds;
+	mRandom.seed(desc.condition.seed);
+
+	mPendingPackets.clear();
+	mPendingPackets.reserve(desc.pendingCapacity);
+	mPendingCapacity = desc.pendingCapacity;
+
+	ResetStatistics();
+
+	return true;
+}
+
+void NetSocket::Finalize()
+{
+	if (mSocket == INVALID_SOCKET_HANDLE)
+	{
+		return;
+	}
+
+	closesocket(SOCKET(mSocket));
+	WSACleanup();
+
+	mSocket = INVALID_SOCKET_HANDLE;
+	mPort = 0;
+	mPendingPackets.clear();
+}
+
+void NetSocket::Send(const uint16_t port, const uint8_t* data, const uint32_t size, const steady_clock::time_point now)
+{
+	MASSERT(size <= MAX_PACKET_SIZE, "Ŷ ʹ Ůϴ.");
+
+	if (mLossRate > 0.0f and std::uniform_real_distribution<float>(0.0f, 1.0f)(mRandom) < mLossRate)
+	{
+		++mStatistics.droppedPacketCount;
+		return;
+	}
+
+	float delaySeconds = mLatencySeconds;
+
+	if (mJitterSeconds > 0.0f)
+	{
+		delaySeconds += std::uniform_real_distribution<float>(0.0f, mJitterSeconds)(mRandom);
+	}
+
+	if (delaySeconds <= 0.0f)
+	{
+		sendNow(port, data, size);
+		return;
+	}
+
+	if (mPendingPackets.size() == mPendingCapacity)
+	{
+		++mStatistics.droppedPacketCount;
+		return;
+	}
+
+	PendingPacket& packet = mPendingPackets.emplace_back();
+	packet.sendTime = now + duration_cast<steady_clock::duration>(duration<float>(delaySeconds));
+	packet.port = port;
+	packet.size = size;
+	memcpy(packet.data, data, size);
+}
+
+void NetSocket::Update(const steady_clock::time_point now)
+{
+	//    Ŷ    .
+	uint32_t keepCount = 0;
+
+	for (uint32_t i = 0; i < uint32_t(mPendingPackets.size()); ++i)
+	{
+		const PendingPacket& packet = mPendingPackets[i];
+
+		if (packet.sendTime <= now)
+		{
+			sendNow(packet.port, packet.data, packet.size);
+			continue;
+		}
+
+		if (keepCount != i)
+		{
+			mPendingPackets[keepCount] = packet;
+		}
+
+		++keepCount;
+	}
+
+	mPendingPackets.resize(keepCount);
+}
+
+bool NetSocket::Receive(uint8_t* outData, const uint32_t capacity, uint32_t* outSize, uint16_t* outPort)
+{
+	ASSERT(mSocket != INVALID_SOCKET_HANDLE);
+	ASSERT(outSize != nullptr);
+	ASSERT(outPort != nullptr);
+
+	while (true)
+	{
+		sockaddr_in address{};
+		int addressSize = sizeof(address);
+
+		const int size = recvfrom(SOCKET(mSocket), reinterpret_cast<char*>(outData), int(capacity), 0, reinterpret_cast<sockaddr*>(&address), &addressSize);
+
+		if (size >= 0)
+		{
+			++mStatistics.receivedPacketCount;
+			mStatistics.receivedByteCount += uint32_t(size);
+
+			*outSize = uint32_t(size);
+			*outPort = ntohs(address.sin_port);
+			return true;
+		}
+
+		//     ICMP   recvfrom Ƿ ǳʶٰ  д´.
+		const int error = WSAGetLastError();
+		if (error == WSAEWOULDBLOCK or (error != WSAECONNRESET and error != WSAEMSGSIZE))
+		{
+			return false;
+		}
+	}
+}
+
+uint16_t NetSocket::GetPort() const
+{
+	return mPort;
+}
+
+const NetSocketStatistics& NetSocket::GetStatistics() const
+{
+	return mStatistics;
+}
+
+void NetSocket::ResetStatistics()
+{
+	mStatistics = {};
+}
+
+void NetSocket::sendNow(const uint16_t port, const uint8_t* data, const uint32_t size)
+{
+	const sockaddr_in address = getLoopbackAddress(port);
+
+	if (sendto(SOCKET(mSocket), reinterpret_cast<const char*>(data), int(size), 0, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != int(size))
+	{
+		++mStatistics.droppedPacketCount;
+		return;
+	}
+
+	++mStatistics.sentPacketCount;
+	mStatistics.sentByteCount += size;
+}
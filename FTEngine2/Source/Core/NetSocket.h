@@ -0,0 +1,91 @@
+#pragma once
+
+// ÿ    ó  Ŷ ų .  0̸ ٷ .
+struct NetConditionDesc
+{
+	const float lossRate;
+
+	// Ŷ latencySeconds latencySeconds + jitterSeconds ̸ŭ ʰ . Ͱ   ٲ  ִ.
+	const float latencySeconds;
+	const float jitterSeconds;
+
+	const uint32_t seed;
+};
+
+struct NetSocketDesc
+{
+	// 0̸  Ʈ .
+	const uint16_t port;
+
+	//    ִ Ŷ . ġ   .
+	const uint32_t pendingCapacity;
+
+	const NetConditionDesc condition;
+};
+
+struct NetSocketStatistics
+{
+	uint64_t sentPacketCount;
+	uint64_t sentByteCount;
+	uint64_t droppedPacketCount;
+	uint64_t receivedPacketCount;
+	uint64_t receivedByteCount;
+};
+
+// 127.0.0.1  ŷ UDP .  Ʈθ Ѵ.
+// ð ȣϴ  ѱǷ, ƽ ð ѱ  ð  ƽ   䳻 .
+class NetSocket final
+{
+public:
+	// ȭ ʵ  Ŷ ̺ ۰ .
+	static constexpr uint32_t MAX_PACKET_SIZE = 1200;
+
+public:
+	NetSocket() = default;
+	NetSocket(const NetSocket&) = delete;
+	NetSocket& operator=(const NetSocket&) = delete;
+	~NetSocket();
+
+	//   ϸ false ȯѴ.
+	[[nodiscard]] bool Initialize(const NetSocketDesc& desc);
+	void Finalize();
+
+	// ǿ  ų  д.  Ŷ Update .
+	void Send(const uint16_t port, const uint8_t* data, const uint32_t size, const std::chrono::steady_clock::time_point now);
+	void Update(const std::chrono::steady_clock::time_point now);
+
+	//  Ŷ  false ȯѴ. ̰ 0 Ŷ   .
+	[[nodiscard]] bool Receive(uint8_t* outData, const uint32_t capacity, uint32_t* outSize, uint16_t* outPort);
+
+	[[nodiscard]] uint16_t GetPort() const;
+	[[nodiscard]] const NetSocketStatistics& GetStatistics() const;
+	void ResetStatistics();
+
+private:
+	struct PendingPacket
+	{
+		std::chrono::steady_clock::time_point sendTime;
+		uint16_t port;
+		uint32_t size;
+		uint8_t data[MAX_PACKET_SIZE];
+	};
+
+	void sendNow(const uint16_t port, const uint8_t* data, const uint32_t size);
+
+private:
+	// SOCKET . winsock2.h     ũ  ´.
+	static constexpr uintptr_t INVALID_SOCKET_HANDLE = ~uintptr_t(0);
+
+	uintptr_t mSocket = INVALID_SOCKET_HANDLE;
+	uint16_t mPort = 0;
+
+	float mLossRate = 0.0f;
+	float mLatencySeconds = 0.0f;
+	float mJitterSeconds = 0.0f;
+	std::mt19937 mRandom{};
+
+	std::vector<PendingPacket> mPendingPackets{};
+	uint32_t mPendingCapacity = 0;
+
+	NetSocketStatistics mStatistics{};
+};
\ No newline at end of file
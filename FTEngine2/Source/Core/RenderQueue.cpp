@@ -0,0 +1,191 @@
+#include "pch.h"
+#include "RenderQueue.h"
+
+#include "Constant.h"
+#include "Texture.h"
+
+using namespace D2D1;
+
+namespace
+{
+	constexpr float POSITION_UNIT = 4.0f;
+	constexpr float SCALE_UNIT = 256.0f;
+	constexpr float CENTER_UNIT = 64.0f;
+	constexpr float ANGLE_UNIT = 65536.0f / 360.0f;
+	constexpr float OPACITY_UNIT = 255.0f;
+
+	// ǵ   ʰ Ѵ.
+	constexpr float POSITION_STEP = 1.0f / POSITION_UNIT;
+	constexpr float SCALE_STEP = 1.0f / SCALE_UNIT;
+	constexpr float CENTER_STEP = 1.0f / CENTER_UNIT;
+	constexpr float RADIAN_STEP = 3.14159265f / 180.0f / ANGLE_UNIT;
+	constexpr float OPACITY_STEP = 1.0f / OPACITY_UNIT;
+
+	// ݿøѴ. std::lround Լ ȣ̶ Ʈ θ⿡ .
+	int32_t roundToInt(const float value)
+	{
+		return int32_t(value + (value < 0.0f ? -0.5f : 0.5f));
+	}
+
+	//  Ѵ  ߶󳽴. ȭ  ġ ġ ū ũ⿡ Ͼ.
+	int16_t quantizeInt16(const float value, const float unit)
+	{
+		return int16_t(roundToInt(std::clamp(value * unit, float(INT16_MIN), float(INT16_MAX))));
+	}
+
+	int8_t quantizeInt8(const float value, const float unit)
+	{
+		return int8_t(roundToInt(std::clamp(value * unit, float(INT8_MIN), float(INT8_MAX))));
+	}
+
+	//   Ѵ     ٲ   16Ʈ  [0, 360)  ´.
+	uint16_t quantizeAngle(const float angle)
+	{
+		const float scaled = angle * ANGLE_UNIT;
+		return uint16_t(int64_t(scaled + (scaled < 0.0f ? -0.5f : 0.5f)));
+	}
+}
+
+void RenderQueue::Reserve(const uint32_t recordCount)
+{
+	mRecords.reserve(recordCount);
+	mScreenHeight = float(Constant::Get().GetHeight());
+}
+
+void RenderQueue::Clear()
+{
+	mRecords.clear();
+}
+
+void RenderQueue::ClearTextures()
+{
+	// ؽó  ȣ ǥ ؽó ٸ ٽ ϵǹǷ ǵ ʴ´.
+	mTextures.clear();
+}
+
+void RenderQueue::Add(const RenderItemDesc& desc)
+{
+	ASSERT(desc.layer < UI_LAYER_BIT);
+
+	if (desc.texture == nullptr or desc.opacity <= 0.0f)
+	{
+		return;
+	}
+
+	mRecords.push_back
+	(
+		{
+			.x = quantizeInt16(desc.position.x, POSITION_UNIT),
+			.y = quantizeInt16(desc.position.y, POSITION_UNIT),
+			.angle = quantizeAngle(desc.angle),
+			.scaleX = quantizeInt16(desc.scale.width, SCALE_UNIT),
+			.scaleY = quantizeInt16(desc.scale.height, SCALE_UNIT),
+			.textureIndex = getTextureIndex(desc.texture),
+			.centerX = quantizeInt8(desc.center.x, CENTER_UNIT),
+			.centerY = quantizeInt8(desc.center.y, CENTER_UNIT),
+			.opacity = uint8_t(roundToInt(min(desc.opacity, 1.0f) * OPACITY_UNIT)),
+			.layerKey = uint8_t(desc.layer | (desc.bUI ? UI_LAYER_BIT : 0))
+		}
+	);
+}
+
+const RenderRecord* RenderQueue::GetRecords() const
+{
+	return mRecords.data();
+}
+
+uint32_t RenderQueue::GetCount() const
+{
+	return uint32_t(mRecords.size());
+}
+
+uint32_t RenderQueue::GetTextureCount() const
+{
+	return uint32_t(mTextures.size());
+}
+
+ID2D1Bitmap* RenderQueue::GetBitmap(const RenderRecord& record) const
+{
+	return mTextures[record.textureIndex].bitmap;
+}
+
+float RenderQueue::GetOpacity(const RenderRecord& record) const
+{
+	return float(record.opacity) * OPACITY_STEP;
+}
+
+bool RenderQueue::IsUI(const RenderRecord& record) const
+{
+	return (record.layerKey & UI_LAYER_BIT) != 0;
+}
+
+Matrix3x2F RenderQueue::GetWorldMatrix(const RenderRecord& record) const
+{
+	const RenderTexture& renderTexture = mTextures[record.textureIndex];
+
+	const float centerX = -(float(record.centerX) * CENTER_STEP + 0.5f) * renderTexture.width;
+	const float centerY = (float(record.centerY) * CENTER_STEP - 0.5f) * renderTexture.height;
+	const float scaleX = float(record.scaleX) * SCALE_STEP;
+	const float scaleY = float(record.scaleY) * SCALE_STEP;
+
+	// κ Ʈ ȸ Ƿ ﰢԼ ǳʶڴ.
+	float cosine = 1.0f;
+	float sine = 0.0f;
+
+	if (record.angle != 0)
+	{
+		const float radian = float(record.angle) * RADIAN_STEP;
+		cosine = std::cos(radian);
+		sine = std::sin(radian);
+	}
+
+	// Translation(center) * Scale * Rotation * Translation(position) Ǯ Ѵ.
+	Matrix3x2F world;
+	world._11 = scaleX * cosine;
+	world._12 = scaleX * sine;
+	world._21 = -scaleY * sine;
+	world._22 = scaleY * cosine;
+	world._31 = centerX * world._11 + centerY * world._21 + float(record.x) * POSITION_STEP;
+	world._32 = centerX * world._12 + centerY * world._22 + mScreenHeight - float(record.y) * POSITION_STEP - 1.0f;
+
+	return world;
+}
+
+uint16_t RenderQueue::getTextureIndex(Texture* texture)
+{
+	ID2D1Bitmap* bitmap = texture->_GetBitmap();
+	const uint32_t index = texture->_GetRenderIndex();
+
+	// ؽó ٽ о Ʈ ٲ ǥ  ģ.
+	if (index < mTextures.size() and mTextures[index].texture == texture)
+	{
+		RenderTexture& renderTexture = mTextures[index];
+
+		if (renderTexture.bitmap != bitmap)
+		{
+			renderTexture.bitmap = bitmap;
+			renderTexture.width = bitmap != nullptr ? float(texture->GetWidth()) : 0.0f;
+			renderTexture.height = bitmap != nullptr ? float(texture->GetHeight()) : 0.0f;
+		}
+
+		return uint16_t(index);
+	}
+
+	MASSERT(mTextures.size() <= UINT16_MAX, "׸  ִ ؽó  Ѿϴ.");
+
+	//    ؽó ũ⸦ 0 д.
+	mTextures.push_back
+	(
+		{
+			.texture = texture,
+			.bitmap = bitmap,
+			.width = bitmap != nullptr ? float(texture->GetWidth()) : 0.0f,
+			.height = bitmap != nullptr ? float(texture->GetHeight()) : 0.0f
+		}
+	);
+
+	const uint32_t newIndex = uint32_t(mTextures.size() - 1);
+	texture->_SetRenderIndex(newIndex);
+
+	return uint16_t(newIndex);
+}
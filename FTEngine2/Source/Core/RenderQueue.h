@@ -0,0 +1,85 @@
+#pragma once
+
+class Texture;
+
+// ׸ Ʈ ϳ. ĳ  ϳ     Ҽ ٿ ´.
+// ġ 1/4ȼ(8192), ũ 1/256(128),  360/65536, ߽ 1/64(2) ̴.
+struct RenderRecord
+{
+	int16_t x;
+	int16_t y;
+	uint16_t angle;
+	int16_t scaleX;
+	int16_t scaleY;
+	uint16_t textureIndex;
+	int8_t centerX;
+	int8_t centerY;
+	uint8_t opacity;
+
+	//  7Ʈ ̾ ȣ̰, ֻ Ʈ UI ̴.
+	uint8_t layerKey;
+};
+
+static_assert(sizeof(RenderRecord) == 16);
+
+struct RenderItemDesc
+{
+	Texture* const texture;
+	const D2D1_POINT_2F center;
+	const D2D1_POINT_2F position;
+	const float angle;
+	const D2D1_SIZE_F scale;
+	const float opacity;
+	const uint32_t layer;
+	const bool bUI;
+};
+
+// Ӹ ̴ Ʈ ׸  ڵ 迭 , ׸  迭 տ д´.
+// ؽó ǥ    ȣ Ű, ũ⵵ ǥ  ξ ׸  Ʈʿ  ʴ´.
+class RenderQueue final
+{
+public:
+	static constexpr uint32_t UI_LAYER_BIT = 0x80;
+
+public:
+	RenderQueue() = default;
+	RenderQueue(const RenderQueue&) = delete;
+	RenderQueue& operator=(const RenderQueue&) = delete;
+
+	// ȭ ̵ ̶ о д.
+	void Reserve(const uint32_t recordCount);
+
+	// ڵ常 . ؽó ǥ  ٲ  ClearTextures .
+	void Clear();
+	void ClearTextures();
+
+	// ϰų ؽó   ʴ´.
+	void Add(const RenderItemDesc& desc);
+
+	[[nodiscard]] const RenderRecord* GetRecords() const;
+	[[nodiscard]] uint32_t GetCount() const;
+	[[nodiscard]] uint32_t GetTextureCount() const;
+
+	[[nodiscard]] ID2D1Bitmap* GetBitmap(const RenderRecord& record) const;
+	[[nodiscard]] float GetOpacity(const RenderRecord& record) const;
+	[[nodiscard]] bool IsUI(const RenderRecord& record) const;
+
+	// ؽó ߽    . Transformation::getWorldMatrix  ǥ踦 .
+	[[nodiscard]] D2D1::Matrix3x2F GetWorldMatrix(const RenderRecord& record) const;
+
+private:
+	struct RenderTexture
+	{
+		const Texture* texture;
+		ID2D1Bitmap* bitmap;
+		float width;
+		float height;
+	};
+
+	[[nodiscard]] uint16_t getTextureIndex(Texture* texture);
+
+private:
+	std::pmr::vector<RenderRecord> mRecords{};
+	std::pmr::vector<RenderTexture> mTextures{};
+	float mScreenHeight = 0.0f;
+};
\ No newline at end of file
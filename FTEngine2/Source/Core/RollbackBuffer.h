@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Snapshot.h"
+
+// ֱ CAPACITY ƽ  ƽ   ¿  ƽ Է  ۿ .
+// ǰ  framesAgo ƽ  ҷ ,  ƽ   Է ٽ ùķ̼Ѵ.
+// ٽ ùķ̼ ƽ  GetSnapshot  .
+template <typename TInput, uint32_t CAPACITY>
+class RollbackBuffer final
+{
+	static_assert(CAPACITY > 0);
+	static_assert(std::is_trivially_copyable_v<TInput>);
+
+public:
+	RollbackBuffer() = default;
+	RollbackBuffer(const RollbackBuffer&) = delete;
+	RollbackBuffer& operator=(const RollbackBuffer&) = delete;
+
+	//  ̸ŭ ̸  д.
+	void Reserve(const size_t snapshotSize);
+	void Clear();
+
+	//  ƽ ְ  ƽ ùķ̼ϱ  ¸   ȯѴ.      ƽ .
+	[[nodiscard]] SnapshotWriter* Push(const TInput& input, const float deltaTime);
+
+	// ǰ  ִ ƽ 
+	[[nodiscard]] uint32_t GetCount() const;
+
+	// framesAgo 0̸   ƽ̴.
+	[[nodiscard]] SnapshotWriter* GetSnapshot(const uint32_t framesAgo);
+	[[nodiscard]] const TInput& GetInput(const uint32_t framesAgo) const;
+	[[nodiscard]] float GetDeltaTime(const uint32_t framesAgo) const;
+
+	// ʰ  Է  ƽ Է ģ. ǰƼ ٽ ùķ̼ؾ ݿȴ.
+	void SetInput(const uint32_t framesAgo, const TInput& input);
+
+private:
+	[[nodiscard]] uint32_t getSlot(const uint32_t framesAgo) const;
+
+private:
+	std::array<SnapshotWriter, CAPACITY> mSnapshots{};
+	std::array<TInput, CAPACITY> mInputs{};
+	std::array<float, CAPACITY> mDeltaTimes{};
+
+	// ݱ  ƽ 
+	uint64_t mPushCount = 0;
+};
+
+template <typename TInput, uint32_t CAPACITY>
+void RollbackBuffer<TInput, CAPACITY>::Reserve(const size_t snapshotSize)
+{
+	for (SnapshotWriter& snapshot : mSnapshots)
+	{
+		snapshot.Reserve(snapshotSize);
+	}
+}
+
+template <typename TInput, uint32_t CAPACITY>
+void RollbackBuffer<TInput, CAPACITY>::Clear()
+{
+	mPushCount = 0;
+}
+
+template <typename TInput, uint32_t CAPACITY>
+SnapshotWriter* RollbackBuffer<TInput, CAPACITY>::Push(const TInput& input, const float deltaTime)
+{
+	const uint32_t slot = uint32_t(mPushCount % CAPACITY);
+	++mPushCount;
+
+	mInputs[slot] = input;
+	mDeltaTimes[slot] = deltaTime;
+
+	return &mSnapshots[slot];
+}
+
+template <typename TInput, uint32_t CAPACITY>
+uint32_t RollbackBuffer<TInput, CAPACITY>::GetCount() const
+{
+	return uint32_t(min(mPushCount, uint64_t(CAPACITY)));
+}
+
+template <typename TInput, uint32_t CAPACITY>
+SnapshotWriter* RollbackBuffer<TInput, CAPACITY>::GetSnapshot(const uint32_t framesAgo)
+{
+	return &mSnapshots[getSlot(framesAgo)];
+}
+
+template <typename TInput, uint32_t CAPACITY>
+const TInput& RollbackBuffer<TInput, CAPACITY>::GetInput(const uint32_t framesAgo) const
+{
+	return mInputs[getSlot(framesAgo)];
+}
+
+template <typename TInput, uint32_t CAPACITY>
+float RollbackBuffer<TInput, CAPACITY>::GetDeltaTime(const uint32_t framesAgo) const
+{
+	return mDeltaTimes[getSlot(framesAgo)];
+}
+
+template <typename TInput, uint32_t CAPACITY>
+void RollbackBuffer<TInput, CAPACITY>::SetInput(const uint32_t framesAgo, const TInput& input)
+{
+	mInputs[getSlot(framesAgo)] = input;
+}
+
+template <typename TInput, uint32_t CAPACITY>
+uint32_t RollbackBuffer<TInput, CAPACITY>::getSlot(const uint32_t framesAgo) const
+{
+	ASSERT(framesAgo < GetCount());
+
+	return uint32_t((mPushCount - 1 - framesAgo) % CAPACITY);
+}
\ No newline at end of file
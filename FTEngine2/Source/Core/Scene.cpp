@@ -8,7 +8,12 @@ Helper* Scene::GetHelper() const
 	return mHelper;
 }
 
-const std::vector<Sprite*>* Scene::GetSpriteLayer(const uint32_t layerIndex) const
+std::pmr::memory_resource* Scene::GetMemoryResource() const
+{
+	return mMemoryResource;
+}
+
+const std::pmr::vector<Sprite*>* Scene::GetSpriteLayer(const uint32_t layerIndex) const
 {
 	MASSERT(layerIndex < mSpriteLayerCount, "̾ ε   ϴ.");
 
@@ -20,7 +25,7 @@ uint32_t Scene::GetSpriteLayerCount() const
 	return mSpriteLayerCount;
 }
 
-void Scene::SetSpriteLayers(const std::vector<Sprite*>* layers, const uint32_t layerCount)
+void Scene::SetSpriteLayers(const std::pmr::vector<Sprite*>* layers, const uint32_t layerCount)
 {
 	ASSERT(layers != nullptr);
 	MASSERT(layerCount <= MAX_LAYER_COUNT, "ϴ ̾ ִ  ʰմϴ.");
@@ -33,12 +38,12 @@ void Scene::SetSpriteLayers(const std::vector<Sprite*>* layers, const uint32_t l
 	mSpriteLayerCount = layerCount;
 }
 
-const std::vector<Label*>* Scene::GetLabelsOrNull() const
+const std::pmr::vector<Label*>* Scene::GetLabelsOrNull() const
 {
 	return mLabels;
 }
 
-void Scene::SetLabels(std::vector<Label*>* labels)
+void Scene::SetLabels(std::pmr::vector<Label*>* labels)
 {
 	ASSERT(labels != nullptr);
 
@@ -57,11 +62,61 @@ void Scene::SetCamera(const Camera* camera)
 	mCamera = camera;
 }
 
-void Scene::_Preinitialize(Helper* helper)
+SpriteHierarchy* Scene::GetSpriteHierarchyOrNull() const
+{
+	return mSpriteHierarchy;
+}
+
+void Scene::SetSpriteHierarchy(SpriteHierarchy* spriteHierarchy)
+{
+	ASSERT(spriteHierarchy != nullptr);
+
+	mSpriteHierarchy = spriteHierarchy;
+}
+
+EntityWorld* Scene::GetEntityWorldOrNull() const
+{
+	return mEntityWorld;
+}
+
+void Scene::SetEntityWorld(EntityWorld* entityWorld)
+{
+	ASSERT(entityWorld != nullptr);
+
+	mEntityWorld = entityWorld;
+}
+
+AudioEventBus* Scene::GetAudioEventBusOrNull() const
+{
+	return mAudioEventBus;
+}
+
+void Scene::SetAudioEventBus(AudioEventBus* audioEventBus)
+{
+	ASSERT(audioEventBus != nullptr);
+
+	mAudioEventBus = audioEventBus;
+}
+
+HotReload* Scene::GetHotReloadOrNull() const
+{
+	return mHotReload;
+}
+
+void Scene::SetHotReload(HotReload* hotReload)
+{
+	ASSERT(hotReload != nullptr);
+
+	mHotReload = hotReload;
+}
+
+void Scene::_Preinitialize(Helper* helper, std::pmr::memory_resource* memoryResource)
 {
 	ASSERT(helper != nullptr);
+	ASSERT(memoryResource != nullptr);
 
 	mHelper = helper;
+	mMemoryResource = memoryResource;
 }
 
 const Scene::Type Scene::GetType() const
@@ -1,9 +1,13 @@
 #pragma once
 
+class AudioEventBus;
 class Camera;
+class EntityWorld;
 class Helper;
+class HotReload;
 class Label;
 class Sprite;
+class SpriteHierarchy;
 
 class Scene
 {
@@ -40,29 +44,53 @@ public:
 
 	[[nodiscard]] Helper* GetHelper() const;
 
-	[[nodiscard]] const std::vector<Sprite*>* GetSpriteLayer(const uint32_t layerIndex) const;
+	//  Ʒ.  ٲ    .
+	[[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const;
+
+	[[nodiscard]] const std::pmr::vector<Sprite*>* GetSpriteLayer(const uint32_t layerIndex) const;
 	[[nodiscard]] uint32_t GetSpriteLayerCount() const;
-	void SetSpriteLayers(const std::vector<Sprite*>* layers, const uint32_t layerCount);
+	void SetSpriteLayers(const std::pmr::vector<Sprite*>* layers, const uint32_t layerCount);
 
-	[[nodiscard]] const std::vector<Label*>* GetLabelsOrNull() const;
-	void SetLabels(std::vector<Label*>* labels);
+	[[nodiscard]] const std::pmr::vector<Label*>* GetLabelsOrNull() const;
+	void SetLabels(std::pmr::vector<Label*>* labels);
 
 	[[nodiscard]] const Camera* GetCameraOrNull() const;
 	void SetCamera(const Camera* camera);
 
+	// Core  Ʈ  ׸    UpdateѴ.
+	[[nodiscard]] SpriteHierarchy* GetSpriteHierarchyOrNull() const;
+	void SetSpriteHierarchy(SpriteHierarchy* spriteHierarchy);
+
+	// Core  Ʈ  ̷  ϰ,  Ʈ ̾ ڿ  ̾ ƼƼ ׸.
+	[[nodiscard]] EntityWorld* GetEntityWorldOrNull() const;
+	void SetEntityWorld(EntityWorld* entityWorld);
+
+	// Core  Ʈ   ӿ   ƮŸ   Ѵ.
+	[[nodiscard]] AudioEventBus* GetAudioEventBusOrNull() const;
+	void SetAudioEventBus(AudioEventBus* audioEventBus);
+
+	// Core  Ʈϱ  ٲ ҽ  ٽ д´.
+	[[nodiscard]] HotReload* GetHotReloadOrNull() const;
+	void SetHotReload(HotReload* hotReload);
+
 public:
-	void _Preinitialize(Helper* helper);
+	void _Preinitialize(Helper* helper, std::pmr::memory_resource* memoryResource);
 
 private:
 	static constexpr uint32_t MAX_LAYER_COUNT = 8;
 
 	Helper* mHelper = nullptr;
+	std::pmr::memory_resource* mMemoryResource = nullptr;
 
-	const std::vector<Sprite*>* mSpriteLayers[MAX_LAYER_COUNT]{};
+	const std::pmr::vector<Sprite*>* mSpriteLayers[MAX_LAYER_COUNT]{};
 	uint32_t mSpriteLayerCount = 0;
 
-	const std::vector<Label*>* mLabels = nullptr;
+	const std::pmr::vector<Label*>* mLabels = nullptr;
 	const Camera* mCamera = nullptr;
+	SpriteHierarchy* mSpriteHierarchy = nullptr;
+	EntityWorld* mEntityWorld = nullptr;
+	AudioEventBus* mAudioEventBus = nullptr;
+	HotReload* mHotReload = nullptr;
 
 public:
 	[[nodiscard]] const Type GetType() const;
@@ -0,0 +1,81 @@
+#include "pch.h"
+#include "Snapshot.h"
+
+void SnapshotWriter::Reserve(const size_t size)
+{
+	mBuffer.reserve(size);
+}
+
+void SnapshotWriter::Begin(const uint32_t version, const void* owner)
+{
+	mBuffer.clear();
+
+	const SnapshotHeader header{ .magic = MAGIC, .version = version, .size = 0, .owner = uint64_t(uintptr_t(owner)) };
+	Write(header);
+}
+
+void SnapshotWriter::End()
+{
+	ASSERT(mBuffer.size() >= sizeof(SnapshotHeader));
+
+	SnapshotHeader* header = reinterpret_cast<SnapshotHeader*>(mBuffer.data());
+	header->size = mBuffer.size();
+}
+
+void SnapshotWriter::WriteBytes(const void* data, const size_t size)
+{
+	const size_t offset = mBuffer.size();
+	mBuffer.resize(offset + size);
+
+	memcpy(mBuffer.data() + offset, data, size);
+}
+
+const uint8_t* SnapshotWriter::GetData() const
+{
+	return mBuffer.data();
+}
+
+size_t SnapshotWriter::GetSize() const
+{
+	return mBuffer.size();
+}
+
+bool SnapshotReader::Begin(const uint8_t* data, const size_t size, const uint32_t version, const void* owner)
+{
+	mData = nullptr;
+	mSize = 0;
+	mOffset = 0;
+
+	if (size < sizeof(SnapshotHeader))
+	{
+		return false;
+	}
+
+	SnapshotHeader header;
+	memcpy(&header, data, sizeof(SnapshotHeader));
+
+	if (header.magic != SnapshotWriter::MAGIC or header.version != version or header.size != size or header.owner != uint64_t(uintptr_t(owner)))
+	{
+		LOG("Snapshot header mismatch: version %u (expected %u), size %llu (expected %zu)", header.version, version, header.size, size);
+		return false;
+	}
+
+	mData = data;
+	mSize = size;
+	mOffset = sizeof(SnapshotHeader);
+
+	return true;
+}
+
+void SnapshotReader::End()
+{
+	MASSERT(mOffset == mSize, "   ʾҽϴ.");
+}
+
+void SnapshotReader::ReadBytes(void* outData, const size_t size)
+{
+	MASSERT(mOffset + size <= mSize, "  Ѿ оϴ.");
+
+	memcpy(outData, mData + mOffset, size);
+	mOffset += size;
+}
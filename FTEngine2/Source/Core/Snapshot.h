@@ -0,0 +1,103 @@
+#pragma once
+
+//   տ ٴ Ӹ. ̳  ٸ  ʴ´.
+struct SnapshotHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t size;
+
+	//   ü. ͸ ״ Ƿ ٸ ü ǵ ʴ´.
+	uint64_t owner;
+};
+
+//  memcpy ʷ ̾ δ.     SnapshotReader .
+// memcpy ص Ǵ trivially copyable ŸԸ ް,  ʹ ״ ȴ.
+//  뷮 ϹǷ ũⰡ   ƽ  Ҵ ʴ´.
+class SnapshotWriter final
+{
+public:
+	static constexpr uint32_t MAGIC = 0x53535446; // "FTSS"
+
+public:
+	SnapshotWriter() = default;
+	SnapshotWriter(const SnapshotWriter&) = delete;
+	SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+	void Reserve(const size_t size);
+
+	//    Ӹ .
+	void Begin(const uint32_t version, const void* owner);
+
+	// Ӹ ü ũ⸦ ´.
+	void End();
+
+	template <typename T>
+	void Write(const T& value);
+
+	template <typename T>
+	void WriteArray(const T* values, const uint32_t count);
+
+	void WriteBytes(const void* data, const size_t size);
+
+	[[nodiscard]] const uint8_t* GetData() const;
+	[[nodiscard]] size_t GetSize() const;
+
+private:
+	std::pmr::vector<uint8_t> mBuffer{};
+};
+
+class SnapshotReader final
+{
+public:
+	SnapshotReader() = default;
+	SnapshotReader(const SnapshotReader&) = delete;
+	SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+	// Ӹ   false ȯϰ, ̶ ƹ͵  ʾƾ Ѵ.
+	[[nodiscard]] bool Begin(const uint8_t* data, const size_t size, const uint32_t version, const void* owner);
+
+	//  Ȯ о ȮѴ.
+	void End();
+
+	template <typename T>
+	void Read(T* outValue);
+
+	template <typename T>
+	void ReadArray(T* outValues, const uint32_t count);
+
+	void ReadBytes(void* outData, const size_t size);
+
+private:
+	const uint8_t* mData = nullptr;
+	size_t mSize = 0;
+	size_t mOffset = 0;
+};
+
+template <typename T>
+void SnapshotWriter::Write(const T& value)
+{
+	WriteArray(&value, 1);
+}
+
+template <typename T>
+void SnapshotWriter::WriteArray(const T* values, const uint32_t count)
+{
+	static_assert(std::is_trivially_copyable_v<T>);
+
+	WriteBytes(values, sizeof(T) * count);
+}
+
+template <typename T>
+void SnapshotReader::Read(T* outValue)
+{
+	ReadArray(outValue, 1);
+}
+
+template <typename T>
+void SnapshotReader::ReadArray(T* outValues, const uint32_t count)
+{
+	static_assert(std::is_trivially_copyable_v<T>);
+
+	ReadBytes(outValues, sizeof(T) * count);
+}
\ No newline at end of file
@@ -1,65 +1,91 @@
 #include "pch.h"
 #include "Sound.h"
 
-#include "Helper.h"
-
-void Sound::Initialize(Helper* helper, const std::string& filename, const bool bLoop)
+void Sound::Initialize(const std::string& filename, const bool bLoop, const bool bStream)
 {
-	ASSERT(helper != nullptr);
-
-	FMOD::System* system = helper->GetSoundSystem();
+	ASSERT(mVoiceIndex == AudioSystem::INVALID_VOICE);
 
-	FMOD::Sound* fmodSound = nullptr;
-	FC(system->createSound(filename.c_str(), not bLoop ? FMOD_DEFAULT : FMOD_LOOP_NORMAL, nullptr, &fmodSound));
-	MASSERT(fmodSound != nullptr, "  ã  ϴ.");
+	mFilename = filename;
+	mVolume = 1.0f;
+	mVoiceIndex = AudioSystem::Get().CreateVoice();
 
-	FC(system->playSound(fmodSound, nullptr, true, &mChannel));
-	FC(fmodSound->getLength(&mLength, FMOD_TIMEUNIT_MS));
+	AudioSystem::Get().Push
+	(
+		{
+			.type = eAudio_Command::Load,
+			.voiceIndex = mVoiceIndex,
+			.volume = mVolume,
+			.filename = mFilename.c_str(),
+			.bLoop = bLoop,
+			.bStream = bStream
+		}
+	);
 }
 
 void Sound::Finalize()
 {
-	FC(mChannel->stop());
+	if (mVoiceIndex == AudioSystem::INVALID_VOICE)
+	{
+		return;
+	}
+
+	AudioSystem::Get().DestroyVoice(mVoiceIndex);
+	mVoiceIndex = AudioSystem::INVALID_VOICE;
 }
 
 void Sound::Play()
 {
-	FC(mChannel->setPaused(false));
+	push(eAudio_Command::Play);
 }
 
 void Sound::Replay()
 {
-	FC(mChannel->setPosition(0, FMOD_TIMEUNIT_MS));
-	FC(mChannel->setPaused(false));
+	push(eAudio_Command::Replay);
+}
+
+void Sound::ReplayAt(const float gain, const float pan)
+{
+	ASSERT(mVoiceIndex != AudioSystem::INVALID_VOICE);
+
+	AudioSystem::Get().Push({ .type = eAudio_Command::ReplayAt, .voiceIndex = mVoiceIndex, .volume = gain, .pan = pan });
 }
 
 void Sound::Pause()
 {
-	FC(mChannel->setPaused(true));
+	push(eAudio_Command::Pause);
 }
 
 float Sound::GetVolume() const
 {
-	float volume = 0.0;
-	FC(mChannel->getVolume(&volume));
-
-	return volume;
+	return mVolume;
 }
 
 void Sound::SetVolume(float volume)
 {
-	FC(mChannel->setVolume(volume));
+	ASSERT(mVoiceIndex != AudioSystem::INVALID_VOICE);
+
+	mVolume = volume;
+
+	AudioSystem::Get().Push({ .type = eAudio_Command::SetVolume, .voiceIndex = mVoiceIndex, .volume = volume });
 }
 
 unsigned int Sound::GetLength() const
 {
-	return mLength;
+	ASSERT(mVoiceIndex != AudioSystem::INVALID_VOICE);
+
+	return AudioSystem::Get().GetLength(mVoiceIndex);
 }
 
 float Sound::GetElapsedTime()
 {
-	unsigned int pos;
-	FC(mChannel->getPosition(&pos, FMOD_TIMEUNIT_MS));
+	ASSERT(mVoiceIndex != AudioSystem::INVALID_VOICE);
+
+	return AudioSystem::Get().GetPosition(mVoiceIndex) * 0.001f;
+}
+
+void Sound::push(const eAudio_Command type)
+{
+	ASSERT(mVoiceIndex != AudioSystem::INVALID_VOICE);
 
-	return pos * 0.001f;
+	AudioSystem::Get().Push({ .type = type, .voiceIndex = mVoiceIndex });
 }
@@ -1,7 +1,8 @@
 #pragma once
 
-class Helper;
+#include "AudioSystem.h"
 
+//  FMOD ȣ AudioSystem  尡 Ѵ. ⼭  ְ ÷   б⸸ Ѵ.
 class Sound final
 {
 public:
@@ -9,10 +10,14 @@ public:
 	Sound& operator=(const Sound&) = delete;
 
 public:
-	void Initialize(Helper* helper, const std::string& filename, const bool bLoop);
+	//  ó   bStream  ޸𸮿  ڵ ʴ´.
+	void Initialize(const std::string& filename, const bool bLoop, const bool bStream);
 	void Finalize();
 	void Play();
 	void Replay();
+
+	// (0~1) ¿ ġ(-1~1) ؼ ٽ Ѵ. ġ   AudioEventBus Ѵ.
+	void ReplayAt(const float gain, const float pan);
 	void Pause();
 
 	float GetVolume() const;
@@ -21,6 +26,12 @@ public:
 	float GetElapsedTime();
 
 private:
-	FMOD::Channel* mChannel = nullptr;
-	unsigned int mLength = 0;
+	void push(const eAudio_Command type);
+
+private:
+	uint32_t mVoiceIndex = AudioSystem::INVALID_VOICE;
+	float mVolume = 1.0f;
+
+	// Load   ̸ ŰǷ Finalize  ִ´.
+	std::string mFilename{};
 };
\ No newline at end of file
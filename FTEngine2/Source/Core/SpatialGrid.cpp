@@ -0,0 +1,114 @@
+#include "pch.h"
+#include "SpatialGrid.h"
+
+void SpatialGrid::Initialize(const SpatialGridDesc& desc)
+{
+	ASSERT(desc.cellSize > 0.0f);
+	ASSERT(desc.halfExtent > 0.0f);
+
+	mCellSize = desc.cellSize;
+	mInverseCellSize = 1.0f / desc.cellSize;
+
+	mColumnCount = int32_t(std::ceil(desc.halfExtent * 2.0f * mInverseCellSize));
+	mRowCount = mColumnCount;
+	mOrigin = { .x = desc.center.x - desc.halfExtent, .y = desc.center.y - desc.halfExtent };
+
+	mCount = 0;
+	mCellStart.assign(size_t(mColumnCount) * mRowCount + 1, 0);
+	mItemCells.clear();
+	mSortedIndices.clear();
+	mSortedPositions.clear();
+}
+
+void SpatialGrid::Build(const D2D1_POINT_2F* positions, const uint32_t count)
+{
+	ASSERT(positions != nullptr or count == 0);
+
+	mCount = count;
+	mItemCells.resize(count);
+	mSortedIndices.resize(count);
+	mSortedPositions.resize(count);
+
+	//  ׸  .   ׸ ڸ  ִ´.
+	std::fill(mCellStart.begin(), mCellStart.end(), 0);
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		const uint32_t cell = uint32_t(getRow(positions[i].y) * mColumnCount + getColumn(positions[i].x));
+		mItemCells[i] = cell;
+		++mCellStart[cell + 1];
+	}
+
+	//     ġ Ѵ.
+	for (size_t cell = 1; cell < mCellStart.size(); ++cell)
+	{
+		mCellStart[cell] += mCellStart[cell - 1];
+	}
+
+	//   ε ġ Ѵ.   ȿ Է  Ѵ.
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		const uint32_t slot = mCellStart[mItemCells[i]]++;
+		mSortedIndices[slot] = i;
+		mSortedPositions[slot] = positions[i];
+	}
+
+	//  ġ оǷ  ĭ ǵ.
+	for (size_t cell = mCellStart.size() - 1; cell > 0; --cell)
+	{
+		mCellStart[cell] = mCellStart[cell - 1];
+	}
+	mCellStart[0] = 0;
+}
+
+void SpatialGrid::QueryCircle(const D2D1_POINT_2F center, const float radius, std::pmr::vector<uint32_t>* outIndices) const
+{
+	ASSERT(outIndices != nullptr);
+
+	outIndices->clear();
+
+	const int32_t minColumn = getColumn(center.x - radius);
+	const int32_t maxColumn = getColumn(center.x + radius);
+	const int32_t minRow = getRow(center.y - radius);
+	const int32_t maxRow = getRow(center.y + radius);
+
+	const float radiusSquared = radius * radius;
+
+	for (int32_t row = minRow; row <= maxRow; ++row)
+	{
+		//    ĵ 迭 ӵǾ ִ.
+		const uint32_t begin = mCellStart[row * mColumnCount + minColumn];
+		const uint32_t end = mCellStart[row * mColumnCount + maxColumn + 1];
+
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			const float dx = mSortedPositions[i].x - center.x;
+			const float dy = mSortedPositions[i].y - center.y;
+
+			if (dx * dx + dy * dy <= radiusSquared)
+			{
+				outIndices->push_back(mSortedIndices[i]);
+			}
+		}
+	}
+}
+
+uint32_t SpatialGrid::GetCount() const
+{
+	return mCount;
+}
+
+float SpatialGrid::GetCellSize() const
+{
+	return mCellSize;
+}
+
+int32_t SpatialGrid::getColumn(const float x) const
+{
+	return std::clamp(int32_t(std::floor((x - mOrigin.x) * mInverseCellSize)), 0, mColumnCount - 1);
+}
+
+int32_t SpatialGrid::getRow(const float y) const
+{
+	return std::clamp(int32_t(std::floor((y - mOrigin.y) * mInverseCellSize)), 0, mRowCount - 1);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+struct SpatialGridDesc
+{
+	const D2D1_POINT_2F center;
+	const float halfExtent;
+	const float cellSize;
+};
+
+class SpatialGrid final
+{
+public:
+	SpatialGrid() = default;
+	SpatialGrid(const SpatialGrid&) = delete;
+	SpatialGrid& operator=(const SpatialGrid&) = delete;
+
+	void Initialize(const SpatialGridDesc& desc);
+	void Build(const D2D1_POINT_2F* positions, const uint32_t count);
+
+	//  ȿ ִ ׸ ε outIndices ä. θ   ޸ ҽ ´.
+	void QueryCircle(const D2D1_POINT_2F center, const float radius, std::pmr::vector<uint32_t>* outIndices) const;
+
+	[[nodiscard]] uint32_t GetCount() const;
+	[[nodiscard]] float GetCellSize() const;
+
+private:
+	[[nodiscard]] int32_t getColumn(const float x) const;
+	[[nodiscard]] int32_t getRow(const float y) const;
+
+private:
+	D2D1_POINT_2F mOrigin{};
+	float mCellSize = 1.0f;
+	float mInverseCellSize = 1.0f;
+	int32_t mColumnCount = 0;
+	int32_t mRowCount = 0;
+
+	uint32_t mCount = 0;
+	std::vector<uint32_t> mCellStart{};
+	std::vector<uint32_t> mItemCells{};
+	std::vector<uint32_t> mSortedIndices{};
+	std::vector<D2D1_POINT_2F> mSortedPositions{};
+};
\ No newline at end of file
@@ -43,6 +43,17 @@ D2D1_POINT_2F Sprite::GetPosition() const
 void Sprite::SetPosition(const D2D1_POINT_2F& position)
 {
 	mPosition = position;
+	mbTransformDirty = true;
+
+	if (not mbHasParent)
+	{
+		mWorldPosition = position;
+	}
+}
+
+D2D1_POINT_2F Sprite::GetWorldPosition() const
+{
+	return mWorldPosition;
 }
 
 D2D1_POINT_2F Sprite::GetCenter() const
@@ -89,3 +100,26 @@ Texture* Sprite::_GetTextureOrNull() const
 {
 	return mTexture;
 }
+
+uint32_t Sprite::_GetHierarchyIndex() const
+{
+	return mHierarchyIndex;
+}
+
+void Sprite::_SetHierarchyIndex(const uint32_t index, const bool bHasParent)
+{
+	mHierarchyIndex = index;
+	mbHasParent = bHasParent;
+	mbTransformDirty = true;
+}
+
+bool Sprite::_IsTransformDirty() const
+{
+	return mbTransformDirty;
+}
+
+void Sprite::_SetWorldPosition(const D2D1_POINT_2F& position)
+{
+	mWorldPosition = position;
+	mbTransformDirty = false;
+}
@@ -5,9 +5,10 @@ class Texture;
 class Sprite final
 {
 public:
+	//  Ʈ    ֵ 縦  ʴ´. ̾  ּҸ  Ƿ  Ʈ ű ʴ´.
 	Sprite() = default;
-	Sprite(const Sprite&) = delete;
-	Sprite& operator=(const Sprite&) = delete;
+	Sprite(const Sprite&) = default;
+	Sprite& operator=(const Sprite&) = default;
 
 	[[nodiscard]] const Texture* GetTextureOrNull() const;
 	void SetTexture(Texture* texture);
@@ -18,9 +19,13 @@ public:
 	[[nodiscard]] D2D1_SIZE_F GetScale() const;
 	void SetScale(const D2D1_SIZE_F& scale);
 
+	// SpriteHierarchy θ  θ   ġ̴.
 	[[nodiscard]] D2D1_POINT_2F GetPosition() const;
 	void SetPosition(const D2D1_POINT_2F& position);
 
+	// θ  GetPosition ,   SpriteHierarchy::Update  ġ̴.
+	[[nodiscard]] D2D1_POINT_2F GetWorldPosition() const;
+
 	[[nodiscard]] D2D1_POINT_2F GetCenter() const;
 	void SetCenter(const D2D1_POINT_2F& center);
 
@@ -36,9 +41,23 @@ public:
 public:
 	[[nodiscard]] Texture* _GetTextureOrNull() const;
 
+	[[nodiscard]] uint32_t _GetHierarchyIndex() const;
+	void _SetHierarchyIndex(const uint32_t index, const bool bHasParent);
+
+	[[nodiscard]] bool _IsTransformDirty() const;
+	void _SetWorldPosition(const D2D1_POINT_2F& position);
+
+public:
+	static constexpr uint32_t INVALID_HIERARCHY_INDEX = UINT32_MAX;
+
 private:
 	Texture* mTexture = nullptr;
 
+	uint32_t mHierarchyIndex = INVALID_HIERARCHY_INDEX;
+	bool mbHasParent = false;
+	bool mbTransformDirty = false;
+	D2D1_POINT_2F mWorldPosition{};
+
 	bool mbActive = true;
 	D2D1_SIZE_F mScale{ .width = 1.0f, .height = 1.0f };
 	D2D1_POINT_2F mPosition{};
@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "SpriteHierarchy.h"
+
+#include "Sprite.h"
+
+void SpriteHierarchy::Reserve(const uint32_t count)
+{
+	mSprites.reserve(count);
+	mParentIndices.reserve(count);
+	mWorldPositions.reserve(count);
+	mUpdatedFlags.reserve(count);
+}
+
+void SpriteHierarchy::Attach(Sprite* child, Sprite* parent)
+{
+	ASSERT(child != nullptr);
+	ASSERT(parent != nullptr);
+	ASSERT(child != parent);
+
+	// ̹  ִ Ʈ ڽ ű θ𺸴 տ   Ƿ ´.
+	ASSERT(child->_GetHierarchyIndex() == Sprite::INVALID_HIERARCHY_INDEX);
+
+	uint32_t parentIndex = parent->_GetHierarchyIndex();
+
+	if (parentIndex == Sprite::INVALID_HIERARCHY_INDEX)
+	{
+		parentIndex = add(parent, Sprite::INVALID_HIERARCHY_INDEX);
+	}
+
+	add(child, parentIndex);
+}
+
+void SpriteHierarchy::Clear()
+{
+	for (Sprite* sprite : mSprites)
+	{
+		sprite->_SetHierarchyIndex(Sprite::INVALID_HIERARCHY_INDEX, false);
+		sprite->_SetWorldPosition(sprite->GetPosition());
+	}
+
+	mSprites.clear();
+	mParentIndices.clear();
+	mWorldPositions.clear();
+	mUpdatedFlags.clear();
+	mUpdatedCount = 0;
+}
+
+void SpriteHierarchy::Update()
+{
+	const uint32_t count = uint32_t(mSprites.size());
+	mUpdatedCount = 0;
+
+	// θ ׻ տ Ƿ θ  ̹ ̹ Update Ǿ ִ.
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		Sprite* sprite = mSprites[i];
+		const uint32_t parentIndex = mParentIndices[i];
+
+		bool bDirty = sprite->_IsTransformDirty();
+
+		if (parentIndex != Sprite::INVALID_HIERARCHY_INDEX)
+		{
+			bDirty = bDirty or mUpdatedFlags[parentIndex] != 0;
+		}
+
+		mUpdatedFlags[i] = bDirty;
+
+		if (not bDirty)
+		{
+			continue;
+		}
+
+		D2D1_POINT_2F worldPosition = sprite->GetPosition();
+
+		if (parentIndex != Sprite::INVALID_HIERARCHY_INDEX)
+		{
+			worldPosition = Math::AddVector(mWorldPositions[parentIndex], worldPosition);
+		}
+
+		mWorldPositions[i] = worldPosition;
+		sprite->_SetWorldPosition(worldPosition);
+		++mUpdatedCount;
+	}
+}
+
+void SpriteHierarchy::SyncWorldPositions()
+{
+	const uint32_t count = uint32_t(mSprites.size());
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		mWorldPositions[i] = mSprites[i]->GetWorldPosition();
+	}
+}
+
+uint32_t SpriteHierarchy::GetCount() const
+{
+	return uint32_t(mSprites.size());
+}
+
+uint32_t SpriteHierarchy::GetUpdatedCount() const
+{
+	return mUpdatedCount;
+}
+
+uint32_t SpriteHierarchy::add(Sprite* sprite, const uint32_t parentIndex)
+{
+	const uint32_t index = uint32_t(mSprites.size());
+
+	mSprites.push_back(sprite);
+	mParentIndices.push_back(parentIndex);
+	mWorldPositions.push_back(sprite->GetPosition());
+	mUpdatedFlags.push_back(0);
+
+	sprite->_SetHierarchyIndex(index, parentIndex != Sprite::INVALID_HIERARCHY_INDEX);
+
+	return index;
+}
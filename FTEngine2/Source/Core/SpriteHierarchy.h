@@ -0,0 +1,41 @@
+#pragma once
+
+class Sprite;
+
+// θ ڽĺ տ  Ʈ  迭 ΰ, Update տ   Ⱦ  ġ Ѵ.
+// ġ ٲ Ʈ  Ʒ ڽĸ ٽ Ѵ.
+// ڽ θ ġ ް,  ũ ڱ  ״ .
+class SpriteHierarchy final
+{
+public:
+	SpriteHierarchy() = default;
+	SpriteHierarchy(const SpriteHierarchy&) = delete;
+	SpriteHierarchy& operator=(const SpriteHierarchy&) = delete;
+
+	void Reserve(const uint32_t count);
+
+	// θ   Ʈ  ִ´. ڽ     ְ,  Ʒ ڽ  ڿ δ.
+	void Attach(Sprite* child, Sprite* parent);
+	void Clear();
+
+	void Update();
+
+	//  ǵ ó Ʈ °   θ. Ʈ   ġ ٽ о ´.
+	void SyncWorldPositions();
+
+	[[nodiscard]] uint32_t GetCount() const;
+
+	//  Update ٽ  Ʈ 
+	[[nodiscard]] uint32_t GetUpdatedCount() const;
+
+private:
+	uint32_t add(Sprite* sprite, const uint32_t parentIndex);
+
+private:
+	std::pmr::vector<Sprite*> mSprites{};
+	std::pmr::vector<uint32_t> mParentIndices{};
+	std::pmr::vector<D2D1_POINT_2F> mWorldPositions{};
+	std::pmr::vector<uint8_t> mUpdatedFlags{};
+
+	uint32_t mUpdatedCount = 0;
+};
\ No newline at end of file
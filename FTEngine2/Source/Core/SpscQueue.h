@@ -0,0 +1,72 @@
+#pragma once
+
+//  常 ְ ٸ  常   ũ  .   ʴ´.
+// Ӹ   Ű CAPACITY   ĭ .
+template <typename T, uint32_t CAPACITY>
+class SpscQueue final
+{
+	static_assert(std::has_single_bit(CAPACITY));
+	static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+	SpscQueue() = default;
+	SpscQueue(const SpscQueue&) = delete;
+	SpscQueue& operator=(const SpscQueue&) = delete;
+
+	// ִ 忡 θ.    false ȯѴ.
+	[[nodiscard]] bool TryPush(const T& value);
+
+	//  忡 θ.   false ȯѴ.
+	[[nodiscard]] bool TryPop(T* outValue);
+
+	[[nodiscard]] bool IsEmpty() const;
+
+private:
+	static constexpr uint32_t MASK = CAPACITY - 1;
+	static constexpr size_t CACHE_LINE_SIZE = 64;
+
+	//  尡     ĳ ο  ʰ ߸.
+	alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> mHead = 0;
+	alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> mTail = 0;
+	alignas(CACHE_LINE_SIZE) T mItems[CAPACITY]{};
+};
+
+template <typename T, uint32_t CAPACITY>
+bool SpscQueue<T, CAPACITY>::TryPush(const T& value)
+{
+	const uint32_t tail = mTail.load(std::memory_order_relaxed);
+
+	if (tail - mHead.load(std::memory_order_acquire) == CAPACITY)
+	{
+		return false;
+	}
+
+	mItems[tail & MASK] = value;
+	mTail.store(tail + 1, std::memory_order_release);
+
+	return true;
+}
+
+template <typename T, uint32_t CAPACITY>
+bool SpscQueue<T, CAPACITY>::TryPop(T* outValue)
+{
+	ASSERT(outValue != nullptr);
+
+	const uint32_t head = mHead.load(std::memory_order_relaxed);
+
+	if (head == mTail.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	*outValue = mItems[head & MASK];
+	mHead.store(head + 1, std::memory_order_release);
+
+	return true;
+}
+
+template <typename T, uint32_t CAPACITY>
+bool SpscQueue<T, CAPACITY>::IsEmpty() const
+{
+	return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire);
+}
\ No newline at end of file
@@ -0,0 +1,241 @@
+#include "pch.h"
+#include "Telemetry.h"
+
+Telemetry& Telemetry::Get()
+{
+	static Telemetry telemetry;
+	return telemetry;
+}
+
+void Telemetry::RecordFrame(const FrameTimingDesc& desc)
+{
+	const uint64_t writeIndex = mWriteIndex.load(std::memory_order_relaxed);
+	FrameRecord& record = mRecords[writeIndex % RING_SIZE];
+
+	//   ׷  ֱ RING_SIZE Ӹ .
+	if (writeIndex >= RING_SIZE)
+	{
+		for (uint32_t phase = 0; phase < uint32_t(eTelemetry_Phase::Count); ++phase)
+		{
+			--mBuckets[phase][getBucketIndex(record.microseconds[phase])];
+		}
+
+		if (record.microseconds[uint32_t(eTelemetry_Phase::Frame)] > mBudgetMicroseconds)
+		{
+			--mStutterCount;
+		}
+	}
+
+	const uint32_t update = uint32_t(desc.updateSeconds * 1e6f + 0.5f);
+	const uint32_t draw = uint32_t(desc.drawSeconds * 1e6f + 0.5f);
+	const uint32_t present = uint32_t(desc.presentSeconds * 1e6f + 0.5f);
+
+	record.frameIndex = writeIndex;
+	record.microseconds[uint32_t(eTelemetry_Phase::Update)] = update;
+	record.microseconds[uint32_t(eTelemetry_Phase::Draw)] = draw;
+	record.microseconds[uint32_t(eTelemetry_Phase::Present)] = present;
+	record.microseconds[uint32_t(eTelemetry_Phase::Frame)] = update + draw + present;
+
+	for (uint32_t phase = 0; phase < uint32_t(eTelemetry_Phase::Count); ++phase)
+	{
+		++mBuckets[phase][getBucketIndex(record.microseconds[phase])];
+	}
+
+	if (record.microseconds[uint32_t(eTelemetry_Phase::Frame)] > mBudgetMicroseconds)
+	{
+		++mStutterCount;
+		++mTotalStutterCount;
+	}
+
+	// ׸   ڿ ε ÷ д  ϼ ׸  Ѵ.
+	mWriteIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+TelemetryStatistics Telemetry::GetStatistics() const
+{
+	const uint64_t writeIndex = mWriteIndex.load(std::memory_order_relaxed);
+	const uint32_t frameCount = uint32_t(min(writeIndex, uint64_t(RING_SIZE)));
+
+	TelemetryStatistics statistics{};
+	statistics.frameCount = frameCount;
+	statistics.stutterCount = mStutterCount;
+	statistics.totalFrameCount = writeIndex;
+	statistics.totalStutterCount = mTotalStutterCount;
+
+	if (frameCount == 0)
+	{
+		return statistics;
+	}
+
+	// ִ   ƴ϶   .
+	uint32_t maxMicroseconds[uint32_t(eTelemetry_Phase::Count)]{};
+
+	for (uint32_t i = 0; i < frameCount; ++i)
+	{
+		for (uint32_t phase = 0; phase < uint32_t(eTelemetry_Phase::Count); ++phase)
+		{
+			maxMicroseconds[phase] = max(maxMicroseconds[phase], mRecords[i].microseconds[phase]);
+		}
+	}
+
+	for (uint32_t phase = 0; phase < uint32_t(eTelemetry_Phase::Count); ++phase)
+	{
+		TelemetryPhaseStatistics& phaseStatistics = statistics.phases[phase];
+		phaseStatistics.p50Milliseconds = getPercentile(eTelemetry_Phase(phase), frameCount, 0.5f);
+		phaseStatistics.p95Milliseconds = getPercentile(eTelemetry_Phase(phase), frameCount, 0.95f);
+		phaseStatistics.p99Milliseconds = getPercentile(eTelemetry_Phase(phase), frameCount, 0.99f);
+		phaseStatistics.p999Milliseconds = getPercentile(eTelemetry_Phase(phase), frameCount, 0.999f);
+		phaseStatistics.maxMilliseconds = float(maxMicroseconds[phase]) * 0.001f;
+	}
+
+	return statistics;
+}
+
+float Telemetry::GetFrameBudget() const
+{
+	return float(mBudgetMicroseconds) * 1e-6f;
+}
+
+void Telemetry::SetFrameBudget(const float seconds)
+{
+	ASSERT(seconds > 0.0f);
+
+	mBudgetMicroseconds = uint32_t(seconds * 1e6f + 0.5f);
+
+	//  ִ    ٽ .
+	const uint32_t frameCount = uint32_t(min(mWriteIndex.load(std::memory_order_relaxed), uint64_t(RING_SIZE)));
+	mStutterCount = 0;
+
+	for (uint32_t i = 0; i < frameCount; ++i)
+	{
+		if (mRecords[i].microseconds[uint32_t(eTelemetry_Phase::Frame)] > mBudgetMicroseconds)
+		{
+			++mStutterCount;
+		}
+	}
+}
+
+bool Telemetry::WriteCsv(const std::filesystem::path& path) const
+{
+	std::vector<FrameRecord> records;
+	copyRecords(&records);
+
+	std::ofstream file(path);
+
+	if (not file.is_open())
+	{
+		LOG("Failed to open %s", path.string().c_str());
+		return false;
+	}
+
+	file << "frame";
+	for (uint32_t phase = 0; phase < uint32_t(eTelemetry_Phase::Count); ++phase)
+	{
+		file << "," << GetPhaseName(eTelemetry_Phase(phase)) << "_us";
+	}
+	file << "\n";
+
+	for (const FrameRecord& record : records)
+	{
+		file << record.frameIndex;
+		for (uint32_t phase = 0; phase < uint32_t(eTelemetry_Phase::Count); ++phase)
+		{
+			file << "," << record.microseconds[phase];
+		}
+		file << "\n";
+	}
+
+	return true;
+}
+
+const char* Telemetry::GetPhaseName(const eTelemetry_Phase phase)
+{
+	switch (phase)
+	{
+	case eTelemetry_Phase::Update:
+		return "update";
+	case eTelemetry_Phase::Draw:
+		return "draw";
+	case eTelemetry_Phase::Present:
+		return "present";
+	case eTelemetry_Phase::Frame:
+		return "frame";
+	default:
+		ASSERT(false);
+		return "";
+	}
+}
+
+uint32_t Telemetry::getBucketIndex(const uint32_t microseconds)
+{
+	// SUB_BUCKET_COUNT   ״ ,  δ ֻ Ʈ Ʒ SUB_BUCKET_BITS Ʈ ĭ .
+	if (microseconds < SUB_BUCKET_COUNT)
+	{
+		return microseconds;
+	}
+
+	const uint32_t exponent = uint32_t(std::bit_width(microseconds)) - 1;
+	const uint32_t subBucket = (microseconds >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+
+	return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + subBucket;
+}
+
+uint32_t Telemetry::getBucketValue(const uint32_t bucketIndex)
+{
+	// ĭ   ִ  ū  ش.
+	if (bucketIndex < SUB_BUCKET_COUNT)
+	{
+		return bucketIndex;
+	}
+
+	const uint32_t exponent = bucketIndex / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+	const uint64_t subBucket = SUB_BUCKET_COUNT + bucketIndex % SUB_BUCKET_COUNT;
+
+	return uint32_t(min(((subBucket + 1) << (exponent - SUB_BUCKET_BITS)) - 1, uint64_t(UINT32_MAX)));
+}
+
+float Telemetry::getPercentile(const eTelemetry_Phase phase, const uint32_t frameCount, const float percentile) const
+{
+	const uint32_t rank = max(uint32_t(std::ceil(float(frameCount) * percentile)), 1u);
+	const uint32_t* buckets = mBuckets[uint32_t(phase)];
+
+	uint32_t count = 0;
+
+	for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+	{
+		count += buckets[i];
+
+		if (count >= rank)
+		{
+			return float(getBucketValue(i)) * 0.001f;
+		}
+	}
+
+	return float(getBucketValue(BUCKET_COUNT - 1)) * 0.001f;
+}
+
+void Telemetry::copyRecords(std::vector<FrameRecord>* outRecords) const
+{
+	ASSERT(outRecords != nullptr);
+
+	const uint64_t endIndex = mWriteIndex.load(std::memory_order_acquire);
+	const uint64_t beginIndex = endIndex > RING_SIZE ? endIndex - RING_SIZE : 0;
+
+	outRecords->clear();
+	outRecords->reserve(size_t(endIndex - beginIndex));
+
+	for (uint64_t i = beginIndex; i < endIndex; ++i)
+	{
+		outRecords->push_back(mRecords[i % RING_SIZE]);
+	}
+
+	// ϴ    ִ  ׸ .
+	const uint64_t latestIndex = mWriteIndex.load(std::memory_order_acquire);
+	const uint64_t validIndex = latestIndex > RING_SIZE ? latestIndex - RING_SIZE + 1 : 0;
+
+	if (validIndex > beginIndex)
+	{
+		const size_t discardCount = size_t(min(validIndex - beginIndex, endIndex - beginIndex));
+		outRecords->erase(outRecords->begin(), outRecords->begin() + discardCount);
+	}
+}
\ No newline at end of file
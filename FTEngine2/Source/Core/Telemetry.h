@@ -0,0 +1,88 @@
+#pragma once
+
+enum class eTelemetry_Phase
+{
+	Update,
+	Draw,
+	Present,
+	Frame,
+	Count
+};
+
+// Frame Update, Draw, Present   Ѵ.
+struct FrameTimingDesc
+{
+	const float updateSeconds;
+	const float drawSeconds;
+	const float presentSeconds;
+};
+
+struct TelemetryPhaseStatistics
+{
+	float p50Milliseconds;
+	float p95Milliseconds;
+	float p99Milliseconds;
+	float p999Milliseconds;
+	float maxMilliseconds;
+};
+
+struct TelemetryStatistics
+{
+	TelemetryPhaseStatistics phases[uint32_t(eTelemetry_Phase::Count)];
+	uint32_t frameCount;
+	uint32_t stutterCount;
+	uint64_t totalFrameCount;
+	uint64_t totalStutterCount;
+};
+
+// ֱ RING_SIZE  ܰ躰 ð Ѵ.
+//  ۴  忡 , ٸ  WriteCsv  ʰ   ִ.
+// ׷ 2 ŵ  16ĭ  α- ̶    6% ̴̳.
+class Telemetry final
+{
+public:
+	[[nodiscard]] static Telemetry& Get();
+
+	void RecordFrame(const FrameTimingDesc& desc);
+
+	[[nodiscard]] TelemetryStatistics GetStatistics() const;
+
+	[[nodiscard]] float GetFrameBudget() const;
+	void SetFrameBudget(const float seconds);
+
+	bool WriteCsv(const std::filesystem::path& path) const;
+
+	[[nodiscard]] static const char* GetPhaseName(const eTelemetry_Phase phase);
+
+private:
+	Telemetry() = default;
+	Telemetry(const Telemetry&) = delete;
+	Telemetry& operator=(const Telemetry&) = delete;
+	~Telemetry() = default;
+
+	struct FrameRecord
+	{
+		uint64_t frameIndex;
+		uint32_t microseconds[uint32_t(eTelemetry_Phase::Count)];
+	};
+
+	[[nodiscard]] static uint32_t getBucketIndex(const uint32_t microseconds);
+	[[nodiscard]] static uint32_t getBucketValue(const uint32_t bucketIndex);
+
+	[[nodiscard]] float getPercentile(const eTelemetry_Phase phase, const uint32_t frameCount, const float percentile) const;
+	void copyRecords(std::vector<FrameRecord>* outRecords) const;
+
+private:
+	static constexpr uint32_t RING_SIZE = 1024;
+	static constexpr uint32_t SUB_BUCKET_BITS = 4;
+	static constexpr uint32_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+	static constexpr uint32_t BUCKET_COUNT = (32 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+	FrameRecord mRecords[RING_SIZE]{};
+	std::atomic<uint64_t> mWriteIndex = 0;
+
+	uint32_t mBuckets[uint32_t(eTelemetry_Phase::Count)][BUCKET_COUNT]{};
+	uint32_t mBudgetMicroseconds = 16667;
+	uint32_t mStutterCount = 0;
+	uint64_t mTotalStutterCount = 0;
+};
\ No newline at end of file
@@ -3,33 +3,94 @@
 
 #include "Helper.h"
 
+namespace
+{
+	// ص ߰  ü   HRESULT ״ ش.
+	//  Ÿ  ũ⸸ а Ʈ  ʴ´.
+	HRESULT createBitmap(Helper* helper, const std::wstring& filename, ID2D1Bitmap** outBitmap, uint32_t* outWidth, uint32_t* outHeight)
+	{
+		ID2D1HwndRenderTarget* renderTarget = helper->GetRenderTarget();
+		IWICImagingFactory* wicImagingFactory = helper->GetWICImagingFactory();
+
+		IWICBitmapDecoder* decoder = nullptr;
+		IWICBitmapFrameDecode* frame = nullptr;
+		IWICFormatConverter* converter = nullptr;
+
+		HRESULT hr = wicImagingFactory->CreateDecoderFromFilename(filename.c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, &decoder);
+
+		if (SUCCEEDED(hr))
+		{
+			hr = decoder->GetFrame(0, &frame);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			hr = frame->GetSize(outWidth, outHeight);
+		}
+
+		if (SUCCEEDED(hr) and renderTarget != nullptr)
+		{
+			hr = wicImagingFactory->CreateFormatConverter(&converter);
+		}
+
+		if (SUCCEEDED(hr) and renderTarget != nullptr)
+		{
+			hr = converter->Initialize(frame, GUID_WICPixelFormat32bppPRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom);
+		}
+
+		if (SUCCEEDED(hr) and renderTarget != nullptr)
+		{
+			hr = renderTarget->CreateBitmapFromWicBitmap(converter, nullptr, outBitmap);
+		}
+
+		RELEASE_D2D1(converter);
+		RELEASE_D2D1(frame);
+		RELEASE_D2D1(decoder);
+
+		return hr;
+	}
+}
+
 Texture::Texture(const Texture& other)
+	: mBitmap(other.mBitmap)
+	, mWidth(other.mWidth)
+	, mHeight(other.mHeight)
+	, mRenderIndex(other.mRenderIndex)
+	, mFilename(other.mFilename)
 {
-	memcpy(this, &other, sizeof(Texture));
 }
 
 void Texture::Initialize(Helper* helper, const std::wstring& filename)
 {
 	ASSERT(helper != nullptr);
 
-	ID2D1HwndRenderTarget* renderTarget = helper->GetRenderTarget();
-	IWICImagingFactory* wicImagingFactory = helper->GetWICImagingFactory();
+	HR(createBitmap(helper, filename, &mBitmap, &mWidth, &mHeight));
+
+	mFilename = filename;
+}
 
-	IWICBitmapDecoder* decoder = nullptr;
-	HR(wicImagingFactory->CreateDecoderFromFilename(filename.c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, &decoder));
+bool Texture::Reload(Helper* helper)
+{
+	ASSERT(helper != nullptr);
+	ASSERT(not mFilename.empty());
 
-	IWICBitmapFrameDecode* frame = nullptr;
-	HR(decoder->GetFrame(0, &frame));
+	ID2D1Bitmap* bitmap = nullptr;
+	uint32_t width = 0;
+	uint32_t height = 0;
 
-	IWICFormatConverter* converter = nullptr;
-	HR(wicImagingFactory->CreateFormatConverter(&converter));
-	HR(converter->Initialize(frame, GUID_WICPixelFormat32bppPRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom));
+	if (const HRESULT hr = createBitmap(helper, mFilename, &bitmap, &width, &height); FAILED(hr))
+	{
+		LOG("Failed to reload %ls (0x%08X)", mFilename.c_str(), uint32_t(hr));
+		return false;
+	}
 
-	HR(renderTarget->CreateBitmapFromWicBitmap(converter, nullptr, &mBitmap));
+	// RenderQueue  ׸  Ʈ ٲ   ؽó ǥ  ũ⸦ ģ.
+	RELEASE_D2D1(mBitmap);
+	mBitmap = bitmap;
+	mWidth = width;
+	mHeight = height;
 
-	RELEASE_D2D1(converter);
-	RELEASE_D2D1(frame);
-	RELEASE_D2D1(decoder);
+	return true;
 }
 
 void Texture::Finalize()
@@ -37,19 +98,32 @@ void Texture::Finalize()
 	RELEASE_D2D1(mBitmap);
 }
 
+const std::wstring& Texture::GetFilename() const
+{
+	return mFilename;
+}
+
 uint32_t Texture::GetWidth() const
 {
-	uint32_t width = mBitmap->GetPixelSize().width;
-	return width;
+	return mWidth;
 }
 
 uint32_t Texture::GetHeight() const
 {
-	uint32_t height = mBitmap->GetPixelSize().height;
-	return height;
+	return mHeight;
 }
 
 ID2D1Bitmap* Texture::_GetBitmap() const
 {
 	return mBitmap;
 }
+
+uint32_t Texture::_GetRenderIndex() const
+{
+	return mRenderIndex;
+}
+
+void Texture::_SetRenderIndex(const uint32_t index)
+{
+	mRenderIndex = index;
+}
@@ -9,15 +9,32 @@ public:
 	Texture(const Texture& other);
 	Texture& operator=(const Texture&) = delete;
 
+	// Helper  Ÿ  Ʈ  ũ⸸ д´. ׸ ʰ ùķ̼Ǹ ϴ  .
 	void Initialize(Helper* helper, const std::wstring& filename);
 	void Finalize();
 
+	// Initialize ѱ  ٽ о Ʈʸ ٲ۴.  ̶  ϸ  Ʈ ״ ΰ false ȯѴ.
+	bool Reload(Helper* helper);
+
+	[[nodiscard]] const std::wstring& GetFilename() const;
+
 	[[nodiscard]] uint32_t GetWidth() const;
 	[[nodiscard]] uint32_t GetHeight() const;
 
 public:
 	[[nodiscard]] ID2D1Bitmap* _GetBitmap() const;
 
+	// RenderQueue ؽó ǥ ȣ
+	[[nodiscard]] uint32_t _GetRenderIndex() const;
+	void _SetRenderIndex(const uint32_t index);
+
+public:
+	static constexpr uint32_t INVALID_RENDER_INDEX = UINT32_MAX;
+
 private:
 	ID2D1Bitmap* mBitmap = nullptr;
+	uint32_t mWidth = 0;
+	uint32_t mHeight = 0;
+	uint32_t mRenderIndex = INVALID_RENDER_INDEX;
+	std::wstring mFilename{};
 };
\ No newline at end of file
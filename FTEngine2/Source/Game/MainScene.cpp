@@ -3,17 +3,45 @@
 
 #include "Core/Collision.h"
 #include "Core/Constant.h"
+#include "Core/FrameAllocator.h"
 #include "Core/Helper.h"
 #include "Core/Input.h"
+#include "Core/InputLatency.h"
 #include "Core/Transformation.h"
 
 using namespace D2D1;
 
+MainScene::MainScene(const MainSceneDesc& desc)
+	: mPoolScale(desc.poolScale)
+	, mRandomSeed(desc.randomSeed)
+	, mIsHeadless(desc.bHeadless)
+	, mIsRollbackEnabled(desc.bRollback)
+	, mIsNetServerEnabled(desc.bNetServer)
+	, mBullets(BULLET_COUNT * desc.poolScale.bullet)
+	, mBulletValue(int32_t(BULLET_COUNT * desc.poolScale.bullet))
+	, mBulletMaxValue(int32_t(BULLET_COUNT * desc.poolScale.bullet))
+	, mCasings(CASING_COUNT * desc.poolScale.casing)
+	, mBigMonsters(BIG_MONSTER_COUNT * desc.poolScale.bigMonster)
+	, mRunMonsters(RUN_MONSTER_COUNT * desc.poolScale.runMonster)
+	, mSlowMonsters(SLOW_MONSTER_COUNT * desc.poolScale.slowMonster)
+	, mLongEffect(LONG_EFFECT_COUNT * desc.poolScale.bigMonster)
+	, mLongEffectTimer(LONG_EFFECT_COUNT * desc.poolScale.bigMonster)
+	, mCyanEffect(CYAN_EFFECT_COUNT * desc.poolScale.runMonster)
+	, mGreenEffect(GREEN_EFFECT_COUNT * desc.poolScale.slowMonster)
+{
+	ASSERT(desc.poolScale.bullet > 0
+		and desc.poolScale.casing > 0
+		and desc.poolScale.bigMonster > 0
+		and desc.poolScale.runMonster > 0
+		and desc.poolScale.slowMonster > 0
+		and desc.poolScale.particle > 0);
+}
+
 void MainScene::Initialize()
 {
 	// ⺻ ͸ ʱȭѴ.
 	{
-		for (std::vector<Sprite*>& layer : mSpriteLayers)
+		for (std::pmr::vector<Sprite*>& layer : mSpriteLayers)
 		{
 			layer.reserve(128);
 		}
@@ -22,6 +50,24 @@ void MainScene::Initialize()
 
 		SetCamera(&mMainCamera);
 
+		// ͸ , ü¹ , ü¹ٰ   ʹ ߹ٰ  .
+		mSpriteHierarchy.Reserve(uint32_t(mBigMonsters.size() * 3 + mRunMonsters.size() * 4 + mSlowMonsters.size() * 3));
+		SetSpriteHierarchy(&mSpriteHierarchy);
+
+		SetEntityWorld(&mEntityWorld);
+
+		mAudioEvents.Initialize
+		(
+			{
+				.eventCapacity = 16,
+				.maxPlayCountPerFrame = MAX_SOUND_PLAY_COUNT_PER_FRAME,
+				.minDistance = Constant::Get().GetWidth() * 0.5f,
+				.maxDistance = Constant::Get().GetWidth() * 1.5f,
+				.panDistance = Constant::Get().GetWidth() * 0.5f
+			}
+		);
+		SetAudioEventBus(&mAudioEvents);
+
 		mLabels.reserve(16);
 		SetLabels(&mLabels);
 
@@ -29,19 +75,41 @@ void MainScene::Initialize()
 		mDefaultFont.Initialize(GetHelper(), L"Arial", 20.0f);
 		mBulletFont.Initialize(GetHelper(), L"Arial", 30.0f);
 
-		Input::Get().SetCursorVisible(false);
-		Input::Get().SetCursorLockState(Input::eCursorLockState::Confined);
+		if (not mIsHeadless)
+		{
+			Input::Get().SetCursorVisible(false);
+			Input::Get().SetCursorLockState(Input::eCursorLockState::Confined);
+
+			ID2D1HwndRenderTarget* renderTarget = GetHelper()->GetRenderTarget();
+			HR(renderTarget->CreateSolidColorBrush(ColorF(1.0f, 1.0f, 1.0f), &mDefaultBrush));
+			HR(renderTarget->CreateSolidColorBrush(ColorF(ColorF::Yellow), &mYellowBrush));
+			HR(renderTarget->CreateSolidColorBrush(ColorF(ColorF::Orange), &mOrange));
+			HR(renderTarget->CreateSolidColorBrush(ColorF(ColorF::Cyan), &mCyanBrush));
+			HR(renderTarget->CreateSolidColorBrush(ColorF(ColorF::DarkGreen), &mDarkGreen));
 
-		ID2D1HwndRenderTarget* renderTarget = GetHelper()->GetRenderTarget();
-		HR(renderTarget->CreateSolidColorBrush(ColorF(1.0f, 1.0f, 1.0f), &mDefaultBrush));
-		HR(renderTarget->CreateSolidColorBrush(ColorF(ColorF::Yellow), &mYellowBrush));
-		HR(renderTarget->CreateSolidColorBrush(ColorF(ColorF::Orange), &mOrange));
-		HR(renderTarget->CreateSolidColorBrush(ColorF(ColorF::Cyan), &mCyanBrush));
-		HR(renderTarget->CreateSolidColorBrush(ColorF(ColorF::DarkGreen), &mDarkGreen));
+			mIsCursorConfined = (Input::Get().GetCursorLockState() == Input::eCursorLockState::Confined);
+		}
 
-		mIsCursorConfined = (Input::Get().GetCursorLockState() == Input::eCursorLockState::Confined);
+		mRandom.seed(mRandomSeed != 0 ? mRandomSeed : uint32_t(time(nullptr)));
 
-		srand(unsigned int(time(nullptr)));
+		// Ʈ ̹     ȥ Ѵ.
+		if (mIsNetServerEnabled)
+		{
+			const uint32_t netSlotCount = GetNetSlotCount();
+			mNetState.entities.resize(netSlotCount);
+			mIsNetServerOpen = mNetServer.Initialize
+			(
+				{
+					.slotCount = netSlotCount,
+					.socket =
+					{
+						.port = NET_SERVER_PORT,
+						.pendingCapacity = 0,
+						.condition = {}
+					}
+				}
+			);
+		}
 	}
 
 	// Ǵ ̹ ʱȭѴ.
@@ -64,45 +132,63 @@ void MainScene::Initialize()
 		mBlueBarTexture.Initialize(GetHelper(), L"Resource/BlueBar.png");
 	}
 
-	// 带 ʱȭѴ.
+	// 带 ʱȭѴ. 帮  带  ʰ ̺Ʈ Ѵ.
+	if (not mIsHeadless)
 	{
-		mBackgroundSound.Initialize(GetHelper(), "Resource/Sound/DST-TowerDefenseTheme.mp3", true);
+		mBackgroundSound.Initialize("Resource/Sound/DST-TowerDefenseTheme.mp3", true, true);
 		mBackgroundSound.SetVolume(0.3f);
 		mBackgroundSound.Play();
 
-		mBulletSound.Initialize(GetHelper(), "Resource/Sound/shoot_sound.wav", false);
+		mBulletSound.Initialize("Resource/Sound/shoot_sound.wav", false, false);
 
-		mReloadSound.Initialize(GetHelper(), "Resource/Sound/reload.mp3", false);
+		mReloadSound.Initialize("Resource/Sound/reload.mp3", false, false);
 		mReloadSound.SetVolume(0.5f);
 
-		mHeroHitSound.Initialize(GetHelper(), "Resource/Sound/hit.mp3", false);
+		mHeroHitSound.Initialize("Resource/Sound/hit.mp3", false, false);
 		mHeroHitSound.SetVolume(1.0f);
 
-		mDashSound.Initialize(GetHelper(), "Resource/Sound/dash.mp3", false);
+		mDashSound.Initialize("Resource/Sound/dash.mp3", false, false);
 		mDashSound.SetVolume(0.3f);
 
-		mShieldSound.Initialize(GetHelper(), "Resource/Sound/E_Skill.mp3", false);
+		mShieldSound.Initialize("Resource/Sound/E_Skill.mp3", false, false);
 		mShieldSound.SetVolume(0.2f);
 
-		mOrbitSound.Initialize(GetHelper(), "Resource/Sound/Q_Skill.mp3", false);
+		mOrbitSound.Initialize("Resource/Sound/Q_Skill.mp3", false, false);
 		mOrbitSound.SetVolume(0.2f);
 
-		mBigMonsterDeadSound.Initialize(GetHelper(), "Resource/Sound/bone_break.mp3", false);
+		mBigMonsterDeadSound.Initialize("Resource/Sound/bone_break.mp3", false, false);
 		mBigMonsterDeadSound.SetVolume(0.5f);
 
-		mRunMonsterDeadSound.Initialize(GetHelper(), "Resource/Sound/bone_break2.mp3", false);
+		mRunMonsterDeadSound.Initialize("Resource/Sound/bone_break2.mp3", false, false);
 		mRunMonsterDeadSound.SetVolume(0.5f);
 
-		mSlowMonsterDeadSound.Initialize(GetHelper(), "Resource/Sound/bone_break3.mp3", false);
+		mSlowMonsterDeadSound.Initialize("Resource/Sound/bone_break3.mp3", false, false);
 		mSlowMonsterDeadSound.SetVolume(0.5f);
 
-		mGameOverSound.Initialize(GetHelper(), "Resource/Sound/game_over.mp3", false);
+		mGameOverSound.Initialize("Resource/Sound/game_over.mp3", false, false);
 		mGameOverSound.SetVolume(0.3f);
 
-		mButtonSound.Initialize(GetHelper(), "Resource/Sound/button_sound.wav", false);
+		mButtonSound.Initialize("Resource/Sound/button_sound.wav", false, false);
 		mButtonSound.SetVolume(0.2f);
 	}
 
+	// ùķ̼   ̺Ʈ Ѵ.
+	{
+		mHeroHitSoundEvent = mAudioEvents.Register({ .sound = &mHeroHitSound, .coalesceTime = 0.1f, .priority = 3 });
+		mBulletSoundEvent = mAudioEvents.Register({ .sound = &mBulletSound, .coalesceTime = 0.05f, .priority = 2 });
+		mBigMonsterDeadSoundEvent = mAudioEvents.Register({ .sound = &mBigMonsterDeadSound, .coalesceTime = 0.08f, .priority = 1 });
+		mRunMonsterDeadSoundEvent = mAudioEvents.Register({ .sound = &mRunMonsterDeadSound, .coalesceTime = 0.08f, .priority = 1 });
+		mSlowMonsterDeadSoundEvent = mAudioEvents.Register({ .sound = &mSlowMonsterDeadSound, .coalesceTime = 0.08f, .priority = 1 });
+
+		// ÷̾     庸  Ѵ.
+		mDashSoundEvent = mAudioEvents.Register({ .sound = &mDashSound, .coalesceTime = 0.05f, .priority = 4 });
+		mReloadSoundEvent = mAudioEvents.Register({ .sound = &mReloadSound, .coalesceTime = 0.05f, .priority = 4 });
+		mShieldSoundEvent = mAudioEvents.Register({ .sound = &mShieldSound, .coalesceTime = 0.05f, .priority = 4 });
+		mOrbitSoundEvent = mAudioEvents.Register({ .sound = &mOrbitSound, .coalesceTime = 0.05f, .priority = 4 });
+		mButtonSoundEvent = mAudioEvents.Register({ .sound = &mButtonSound, .coalesceTime = 0.05f, .priority = 4 });
+		mGameOverSoundEvent = mAudioEvents.Register({ .sound = &mGameOverSound, .coalesceTime = 0.05f, .priority = 5 });
+	}
+
 	// ÷̾ ʱȭѴ.
 	{
 		mHero.hp = HERO_MAX_HP;
@@ -201,11 +287,13 @@ void MainScene::Initialize()
 			);
 
 			Sprite& startBar = run.startBar;
+			startBar.SetPosition({ .x = -10.0f, .y = -20.0f });
 			startBar.SetScale({ .width = 0.0f, .height = 0.1f });
 			startBar.SetCenter({ .x = -0.5f, .y = 0.0f });
 			startBar.SetActive(false);
 			startBar.SetTexture(&mRectangleTexture);
 			mSpriteLayers[uint32_t(Layer::Monster)].push_back(&startBar);
+			mSpriteHierarchy.Attach(&startBar, &run.monster.sprite);
 		}
 	}
 
@@ -238,6 +326,18 @@ void MainScene::Initialize()
 		}
 	}
 
+	//  ̵ θ ʱȭѴ.
+	{
+		initializeBoundary();
+
+		const size_t monsterCount = mBigMonsters.size() + mRunMonsters.size() + mSlowMonsters.size();
+		mGridMonsters.reserve(monsterCount);
+		mGridPositions.reserve(monsterCount);
+		mGridRadii.reserve(monsterCount);
+		mSeparationOffsets.reserve(monsterCount);
+		mNeighborIndices.reserve(monsterCount);
+	}
+
 	// Ʈ ʱȭѴ.
 	{
 		for (Sprite& effect : mLongEffect)
@@ -279,34 +379,43 @@ void MainScene::Initialize()
 			&mPurpleStarTexture
 		};
 
+		// ƼŬ Effect ̾ Ʈ  ׸ ڿ ׷.
+		mSpawnedParticles.reserve(PARTICLE_PER * mPoolScale.particle);
+
 		// Star
-		for (uint32_t i = 0; i < mStarParticles.size(); ++i)
+		const ComponentMask starMask = EntityWorld::GetMask<TransformComponent, SpriteComponent, ParticleComponent, StarParticleTag, DisabledTag>();
+		for (uint32_t i = 0; i < STAR_PARTICLE_COUNT * mPoolScale.particle; ++i)
 		{
-			Particle& particle = mStarParticles[i];
-			particle.direction = {};
-			particle.speed = getRandom(100.0f, 300.0f);
+			const Entity entity = mEntityWorld.Create(starMask);
 
-			Sprite& sprite = particle.sprite;
-			sprite.SetScale({ .width = 0.5f, .height = 0.5f });
-			sprite.SetActive(false);
-			sprite.SetTexture(starParticleTextures[i % COLOR_COUNT]);
-			mSpriteLayers[uint32_t(Layer::Effect)].push_back(&sprite);
+			*mEntityWorld.GetOrNull<ParticleComponent>(entity) = { .direction = {}, .speed = getRandom(100.0f, 300.0f) };
+			*mEntityWorld.GetOrNull<TransformComponent>(entity) = { .position = {}, .angle = 0.0f, .scale = { .width = 0.5f, .height = 0.5f } };
+			*mEntityWorld.GetOrNull<SpriteComponent>(entity) =
+			{
+				.texture = starParticleTextures[i % COLOR_COUNT],
+				.center = {},
+				.opacity = 1.0f,
+				.layer = uint32_t(Layer::Effect),
+				.bUI = false
+			};
 		}
 
 		// Rect
-		for (uint32_t i = 0; i < mRectParticles.size(); ++i)
+		const ComponentMask rectMask = EntityWorld::GetMask<TransformComponent, SpriteComponent, ParticleComponent, RectParticleTag, DisabledTag>();
+		for (uint32_t i = 0; i < RECT_PARTICLE_COUNT * mPoolScale.particle; ++i)
 		{
-			Particle& particle = mRectParticles[i];
+			const Entity entity = mEntityWorld.Create(rectMask);
 
-			particle.direction = {};
-			particle.speed = getRandom(100.0f, 300.0f);
-
-			Sprite& sprite = particle.sprite;
-			sprite.SetScale({ .width = 0.7f, .height = 0.7f });
-			sprite.SetAngle(45.0f);
-			sprite.SetActive(false);
-			sprite.SetTexture(rectParticleTextures[i % COLOR_COUNT]);
-			mSpriteLayers[uint32_t(Layer::Effect)].push_back(&sprite);
+			*mEntityWorld.GetOrNull<ParticleComponent>(entity) = { .direction = {}, .speed = getRandom(100.0f, 300.0f) };
+			*mEntityWorld.GetOrNull<TransformComponent>(entity) = { .position = {}, .angle = 45.0f, .scale = { .width = 0.7f, .height = 0.7f } };
+			*mEntityWorld.GetOrNull<SpriteComponent>(entity) =
+			{
+				.texture = rectParticleTextures[i % COLOR_COUNT],
+				.center = {},
+				.opacity = 1.0f,
+				.layer = uint32_t(Layer::Effect),
+				.bUI = false
+			};
 		}
 	}
 
@@ -408,7 +517,7 @@ void MainScene::Initialize()
 			mDashValueLabel.SetPosition(offset);
 
 			mDashValueLabel.SetCenter({ .x = 0.5f, .y = 0.0f });
-			mDashValueLabel.SetText(L"Dash: " + std::to_wstring(mDash.count) + L" / " + std::to_wstring(DASH_MAX_COUNT));
+			mDashValueLabel.Format(L"Dash: ", mDash.count, L" / ", DASH_MAX_COUNT);
 			mLabels.push_back(&mDashValueLabel);
 		}
 
@@ -423,7 +532,7 @@ void MainScene::Initialize()
 			mHpValueLabel.SetPosition(offset);
 
 			mHpValueLabel.SetCenter({ .x = 0.5f, .y = 0.0f });
-			mHpValueLabel.SetText(L"Hp: " + std::to_wstring(mHero.hp) + L" / " + std::to_wstring(HERO_MAX_HP));
+			mHpValueLabel.Format(L"Hp: ", mHero.hp, L" / ", HERO_MAX_HP);
 			mLabels.push_back(&mHpValueLabel);
 		}
 
@@ -437,7 +546,7 @@ void MainScene::Initialize()
 			const D2D1_POINT_2F offset = { .x = position.x + barOffsetX + 55.0f, .y = position.y };
 			mBulletLabel.SetPosition(offset);
 
-			mBulletLabel.SetText(std::to_wstring(mBulletValue) + L"/" + std::to_wstring(BULLET_COUNT));
+			mBulletLabel.Format(mBulletValue, L"/", mBulletMaxValue);
 			mBulletLabel.SetCenter({ .x = -0.5f, .y = 0.0f });
 			mLabels.push_back(&mBulletLabel);
 		}
@@ -505,7 +614,7 @@ void MainScene::Initialize()
 
 			D2D1_POINT_2F offset = { .x = mUiKillBackgroundBar.GetPosition().x - 5.0f, .y = mUiKillBackgroundBar.GetPosition().y };
 			mKillAllMonsterLabel.SetPosition(offset);
-			mKillAllMonsterLabel.SetText(L"F: " + std::to_wstring(mKillMonsterCount) + L" / " + std::to_wstring(KILL_ALL_MONSTER_COUNT));
+			mKillAllMonsterLabel.Format(L"F: ", mKillMonsterCount, L" / ", KILL_ALL_MONSTER_COUNT);
 			mKillAllMonsterLabel.SetCenter({ .x = 0.5f, .y = 0.0f });
 			mLabels.push_back(&mKillAllMonsterLabel);
 		}
@@ -553,6 +662,74 @@ void MainScene::Initialize()
 			mSpriteLayers[uint32_t(Layer::UI)].push_back(&mExitButton);
 		}
 	}
+
+	// ٲ ̹  ٽ д´. 帮       .
+	if (not mIsHeadless)
+	{
+		mHotReload.Initialize
+		(
+			{
+				.helper = GetHelper(),
+				.directory = L"Resource",
+				.tunablesPath = L"Resource/Tunables.txt",
+				.quietSeconds = 0.2f
+			}
+		);
+
+		Texture* textures[] =
+		{
+			&mRectangleTexture,
+			&mRedRectangleTexture,
+			&mYellowRectangleTexture,
+			&mSkyBlueRectangleTexture,
+			&mBlueRectangleTexture,
+			&mPinkRectangleTexture,
+			&mPurpleRectangleTexture,
+			&mBlackRectangleTexture,
+			&mCircleTexture,
+			&mRedCircleTexture,
+			&mWhiteBarTexture,
+			&mRedBarTexture,
+			&mYellowBarTexture,
+			&mBlueBarTexture,
+			&mGameOverTexture,
+			&mRedStarTexture,
+			&mOrangeStarTexture,
+			&mYellowStarTexture,
+			&mGreenStarTexture,
+			&mBlueStarTexture,
+			&mPurpleStarTexture,
+			&mResumeIdleButtonTexture,
+			&mResumeContactButtonTexture,
+			&mExitIdleButtonTexture,
+			&mExitContactButtonTexture
+		};
+
+		for (Texture* texture : textures)
+		{
+			mHotReload.AddTexture(texture);
+		}
+
+		SetHotReload(&mHotReload);
+	}
+
+	//      ´.
+	readTunables();
+
+	//  ۸ ̸  д. Ǯ Ű ƼŬ 鼭 ŰŸ þ ٽ Ҵ ʵ ó ũ  踦 ´.
+	{
+		SaveSnapshot(&mRollbackAfterSnapshot);
+
+		const size_t snapshotCapacity = max(SNAPSHOT_CAPACITY, mRollbackAfterSnapshot.GetSize() * 2);
+		mSnapshot.Reserve(snapshotCapacity);
+
+		if (mIsRollbackEnabled)
+		{
+			mRollbackBuffer.Reserve(snapshotCapacity);
+			mRollbackBeforeSnapshot.Reserve(snapshotCapacity);
+			mRollbackAfterSnapshot.Reserve(snapshotCapacity);
+		}
+	}
 }
 
 void MainScene::PreDraw(const D2D1::Matrix3x2F& view, const D2D1::Matrix3x2F& viewForUI)
@@ -564,7 +741,7 @@ void MainScene::PreDraw(const D2D1::Matrix3x2F& view, const D2D1::Matrix3x2F& vi
 		const Matrix3x2F worldView = Transformation::getWorldMatrix() * view;
 		renderTarget->SetTransform(worldView);
 
-		const D2D1_ELLIPSE ellipse{ .radiusX = BOUNDARY_RADIUS, .radiusY = BOUNDARY_RADIUS };
+		const D2D1_ELLIPSE ellipse{ .radiusX = mBoundaryRadius, .radiusY = mBoundaryRadius };
 		renderTarget->DrawEllipse(ellipse, mDefaultBrush, 2.0f);
 	}
 
@@ -583,13 +760,13 @@ bool MainScene::Update(const float deltaTime)
 	// Ű ƮѴ.
 	{
 		//  Ѵ.
-		if (Input::Get().GetKeyDown(VK_ESCAPE))
+		if (Input::Get().GetKeyDown(VK_ESCAPE) and not mIsHeadless)
 		{
 			PostQuitMessage(0);
 		}
 
 		// 콺 Ŀ Ѵ.
-		if (Input::Get().GetKeyDown(VK_CONTROL))
+		if (Input::Get().GetKeyDown(VK_CONTROL) and not mIsHeadless)
 		{
 			mIsCursorConfined = !mIsCursorConfined;
 			Input::Get().SetCursorLockState(mIsCursorConfined ? Input::eCursorLockState::Confined : Input::eCursorLockState::None);
@@ -601,9 +778,110 @@ bool MainScene::Update(const float deltaTime)
 		{
 			mIsColliderKeyDown = !mIsColliderKeyDown;
 		}
+
+		//   ٽ  ¸ ϰ ǵ.
+		if (Input::Get().GetKeyDown(VK_F5))
+		{
+			SaveSnapshot(&mSnapshot);
+			LOG("Saved snapshot (%zu bytes)", mSnapshot.GetSize());
+		}
+
+		if (Input::Get().GetKeyDown(VK_F9) and mSnapshot.GetSize() > 0)
+		{
+			const bool bLoaded = LoadSnapshot(mSnapshot.GetData(), mSnapshot.GetSize());
+			ASSERT(bLoaded);
+		}
+
+		if (Input::Get().GetKeyDown(VK_F6))
+		{
+			const uint32_t tickCount = min(ROLLBACK_TICK_COUNT, mRollbackBuffer.GetCount());
+			const bool bSame = Rollback(tickCount);
+			LOG("Rolled back %u ticks (%s)", tickCount, bSame ? "same state" : "diverged");
+		}
 #endif
 	}
 
+	//   ٽ о ̹ ƽ Էº ´.
+	if (mHotReload.GetTunables().GetVersion() != mTunablesVersion)
+	{
+		readTunables();
+	}
+
+	// ǰ⸦  ̹ ƽ Է°   ¸  ùķ̼Ѵ.
+	SimulationInput input = ReadSimulationInput();
+	input.tunables = mTunables;
+
+	if (mIsRollbackEnabled)
+	{
+		SaveSnapshot(mRollbackBuffer.Push(input, deltaTime));
+	}
+
+	const uint32_t prevShotCount = mShotCount;
+	const bool bPrevGameOver = mIsGameOver;
+
+	simulate(input, deltaTime);
+
+	updateLabels();
+	updateSounds();
+
+	// Ŭ ó  Ѿ̸     Է  Ѵ. Ÿ  ʰ  ͵  .
+	if (mShotCount != prevShotCount)
+	{
+		if (const InputEvent* event = Input::Get().GetMouseButtonPressEventOrNull(Input::eMouseButton::Left); event != nullptr)
+		{
+			InputLatency::Get().Reflect(*event);
+		}
+	}
+
+	if (mIsGameOver and not bPrevGameOver and not mIsHeadless)
+	{
+		Input::Get().SetCursorVisible(true);
+	}
+
+	if (mIsExitRequested and not mIsHeadless)
+	{
+		PostQuitMessage(0);
+	}
+
+	if (mIsNetServerOpen)
+	{
+		updateNetServer();
+	}
+
+	return mIsUpdate;
+}
+
+SimulationInput MainScene::ReadSimulationInput()
+{
+	const Input& input = Input::Get();
+
+	const SimulationInput result =
+	{
+		.mousePosition = input.GetMousePosition(),
+		.leftButtonDownElapsedTime = input.GetMouseButtonDownElapsedTime(Input::eMouseButton::Left),
+		.moveX = input.GetKey('D') - input.GetKey('A'),
+		.moveY = input.GetKey('W') - input.GetKey('S'),
+		.bLeftButton = input.GetMouseButton(Input::eMouseButton::Left) or input.GetMouseButtonDown(Input::eMouseButton::Left),
+		.bLeftButtonDown = input.GetMouseButtonDown(Input::eMouseButton::Left),
+		.bDash = input.GetKeyDown(VK_SPACE),
+		.bReload = input.GetKeyDown('R'),
+		.bShield = input.GetKeyDown('E'),
+		.bOrbit = input.GetKeyDown('Q'),
+		.bKillAll = input.GetKeyDown('F')
+	};
+
+	return result;
+}
+
+void MainScene::simulate(const SimulationInput& input, const float deltaTime)
+{
+	if (mPhaseSeconds != nullptr)
+	{
+		mPhaseStartTime = std::chrono::steady_clock::now();
+	}
+
+	applyTunables(input.tunables);
+
 	//  ƮѴ.
 	{
 		// õǾ ִ ǥ(0, 0) ش.
@@ -613,10 +891,8 @@ bool MainScene::Update(const float deltaTime)
 			.y = (Constant::Get().GetHeight() - 1.0f) * 0.5f
 		};
 
-		const D2D1_POINT_2F mousePosition = Input::Get().GetMousePosition();
-
 		// 콺 ǥ ǥ迡 .
-		const D2D1_POINT_2F screenPosition = Math::SubtractVector(mousePosition, centerOffset);
+		const D2D1_POINT_2F screenPosition = Math::SubtractVector(input.mousePosition, centerOffset);
 		mZoom.SetPosition(screenPosition);
 
 		const D2D1_POINT_2F heroPosition = mHero.sprite.GetPosition();
@@ -638,52 +914,50 @@ bool MainScene::Update(const float deltaTime)
 		// ̵ ƮѴ.
 		{
 			constexpr float MAX_SPEED = 400.0f;
-			constexpr float ACC = 50.0f; // ӵ
 
-			const int32_t moveX = Input::Get().GetKey('D') - Input::Get().GetKey('A');
-			const int32_t moveY = Input::Get().GetKey('W') - Input::Get().GetKey('S');
+			const int32_t moveX = input.moveX;
+			const int32_t moveY = input.moveY;
+
+			mHero.prevPosition = mHero.sprite.GetPosition();
 
-			static int32_t previousMoveX;
-			static int32_t previousMoveY;
 			D2D1_POINT_2F& velocity = mHero.velocity;
 
 			if (moveX != 0)
 			{
-				velocity.x = std::clamp(velocity.x + ACC * moveX, -MAX_SPEED, MAX_SPEED);
-				previousMoveX = moveX;
+				velocity.x = std::clamp(velocity.x + mHeroAcc * moveX, -MAX_SPEED, MAX_SPEED);
+				mPreviousMoveX = moveX;
 			}
 			else
 			{
-				if (previousMoveX > 0)
+				if (mPreviousMoveX > 0)
 				{
-					velocity.x = max(velocity.x - ACC, 0.0f);
+					velocity.x = max(velocity.x - mHeroAcc, 0.0f);
 				}
 				else
 				{
-					velocity.x = min(velocity.x + ACC, 0.0f);
+					velocity.x = min(velocity.x + mHeroAcc, 0.0f);
 				}
 			}
 
 			if (moveY != 0)
 			{
-				velocity.y = std::clamp(velocity.y + ACC * moveY, -MAX_SPEED, MAX_SPEED);
-				previousMoveY = moveY;
+				velocity.y = std::clamp(velocity.y + mHeroAcc * moveY, -MAX_SPEED, MAX_SPEED);
+				mPreviousMoveY = moveY;
 			}
 			else
 			{
-				if (previousMoveY > 0)
+				if (mPreviousMoveY > 0)
 				{
-					velocity.y = max(velocity.y - ACC, 0.0f);
+					velocity.y = max(velocity.y - mHeroAcc, 0.0f);
 				}
 				else
 				{
-					velocity.y = min(velocity.y + ACC, 0.0f);
+					velocity.y = min(velocity.y + mHeroAcc, 0.0f);
 				}
 			}
 
 			constexpr float MAX_DASH_SPEED = 600.0f;
 			constexpr float DASH_ACC = 30.0f;
-			static D2D1_POINT_2F dashDirection;
 
 			if (Math::GetVectorLength(velocity) != 0.0f)
 			{
@@ -692,15 +966,15 @@ bool MainScene::Update(const float deltaTime)
 				D2D1_POINT_2F adjustVelocity = Math::ScaleVector(direction, speed);
 				adjustVelocity = Math::ScaleVector(adjustVelocity, deltaTime);
 
-				if (not mDash.isActive and Input::Get().GetKeyDown(VK_SPACE))
+				if (not mDash.isActive and input.bDash)
 				{
-					dashDirection = direction;
+					mDashDirection = direction;
 
 					if (mDash.count != 0)
 					{
 						mDash.count--;
 						mDash.isActive = true;
-						mDashSound.Replay();
+						mAudioEvents.Trigger(mDashSoundEvent);
 						mDash.shadowCoolTimer = 0.0f;
 					}
 				}
@@ -712,7 +986,7 @@ bool MainScene::Update(const float deltaTime)
 			if (mDash.isActive)
 			{
 				mDash.moveSpeed = min(mDash.moveSpeed + DASH_ACC, MAX_DASH_SPEED);
-				const D2D1_POINT_2F velocity = Math::ScaleVector(dashDirection, mDash.moveSpeed * deltaTime);
+				const D2D1_POINT_2F velocity = Math::ScaleVector(mDashDirection, mDash.moveSpeed * deltaTime);
 
 				if (mDash.moveSpeed >= MAX_DASH_SPEED)
 				{
@@ -772,21 +1046,42 @@ bool MainScene::Update(const float deltaTime)
 			}
 		}
 
+		endPhase(eMainScene_Phase::Hero);
+
 		// Ѿ ƮѴ.
 		{
 			constexpr float LENGTH = 100.0f;
 
-			mBulletShootingCoolTimer = max(mBulletShootingCoolTimer - deltaTime, 0.0f);
+			//  ȿ   Ŭ   .
+			const bool bShooting = input.bLeftButton
+				and mBulletValue != 0
+				and not misKeyDownReload;
+
+			//  ȿ  Ÿ  ߻ Ѱܼ  Ʈ    .
+			// ̹ ӿ ٸ  ð .
+			mBulletShootingCoolTimer -= deltaTime;
+
+			if (not bShooting)
+			{
+				mBulletShootingCoolTimer = max(mBulletShootingCoolTimer, 0.0f);
+			}
+			else if (input.bLeftButtonDown)
+			{
+				mBulletShootingCoolTimer = max(mBulletShootingCoolTimer, -input.leftButtonDownElapsedTime);
+			}
 
 			// Ѿ Ѵ.
-			if (Input::Get().GetMouseButton(Input::eMouseButton::Left)
+			while (bShooting
 				and mBulletShootingCoolTimer <= 0.001f
-				and mBulletValue != 0
-				and not misKeyDownReload)
+				and mBulletValue != 0)
 			{
-				mBulletSound.Replay();
+				mAudioEvents.Trigger(mBulletSoundEvent);
+				++mShotCount;
+
+				// Ǯ Ű ŭ     .
+				uint32_t shotBulletCount = 0;
 
-				for (uint32_t i = 0; i < BULLET_COUNT; ++i)
+				for (uint32_t i = 0; i < uint32_t(mBullets.size()); ++i)
 				{
 					Bullet& bullet = mBullets[i];
 					Sprite& bulletSprite = bullet.sprite;
@@ -822,7 +1117,7 @@ bool MainScene::Update(const float deltaTime)
 
 					// źǸ Ѵ.
 					{
-						for (uint32_t j = 0; j < CASING_COUNT; ++j)
+						for (uint32_t j = 0; j < uint32_t(mCasings.size()); ++j)
 						{
 							Casing& casing = mCasings[j];
 							Sprite& casingSprite = casing.sprite;
@@ -861,17 +1156,22 @@ bool MainScene::Update(const float deltaTime)
 						initializeCameraShake(amplitude, duration, frequency);
 					}
 
-					break;
+					++shotBulletCount;
+
+					if (shotBulletCount == mPoolScale.bullet or mBulletValue == 0)
+					{
+						break;
+					}
 				}
 
-				mBulletShootingCoolTimer = 0.12f;
+				mBulletShootingCoolTimer += 0.12f;
 			}
 
 			// Ѿ ̵Ų.
 			{
 				constexpr float MOVE_SPEED = 1500.0f;
 
-				for (uint32_t i = 0; i < BULLET_COUNT; ++i)
+				for (uint32_t i = 0; i < uint32_t(mBullets.size()); ++i)
 				{
 					Bullet& bullet = mBullets[i];
 					Sprite& bulletSprite = bullet.sprite;
@@ -900,7 +1200,7 @@ bool MainScene::Update(const float deltaTime)
 				constexpr float SPEED = 400.0f;
 				constexpr float MOVE_TIME = 1.0f;
 
-				for (uint32_t i = 0; i < CASING_COUNT; ++i)
+				for (uint32_t i = 0; i < uint32_t(mCasings.size()); ++i)
 				{
 					Casing& casing = mCasings[i];
 					Sprite& casingSprite = casing.sprite;
@@ -938,24 +1238,24 @@ bool MainScene::Update(const float deltaTime)
 				{
 					if (mreloadCoolTimer == 0.0f) 
 					{
-						mReloadSound.Replay();
+						mAudioEvents.Trigger(mReloadSoundEvent);
 					}
 
 					mreloadCoolTimer += deltaTime;
 
 					if (mreloadCoolTimer >= RELOAD_TIME)
 					{
-						mBulletValue = BULLET_COUNT;
+						mBulletValue = mBulletMaxValue;
 						mreloadCoolTimer = 0.0f;
 					}
 				}
 
 				// Ű ,  ȴ.
-				if (Input::Get().GetKeyDown('R'))
+				if (input.bReload)
 				{
-					if (mBulletValue != BULLET_COUNT)
+					if (mBulletValue != mBulletMaxValue)
 					{
-						mReloadSound.Replay();
+						mAudioEvents.Trigger(mReloadSoundEvent);
 
 						misKeyDownReload = true;
 					}
@@ -967,7 +1267,7 @@ bool MainScene::Update(const float deltaTime)
 
 					if (mreloadKeyDownCoolTimer >= RELOAD_TIME)
 					{
-						mBulletValue = BULLET_COUNT;
+						mBulletValue = mBulletMaxValue;
 						mreloadKeyDownCoolTimer = 0.0f;
 						misKeyDownReload = false;
 					}
@@ -975,44 +1275,25 @@ bool MainScene::Update(const float deltaTime)
 			}
 		}
 
+		endPhase(eMainScene_Phase::Bullet);
+
 		//  Ű ƮѴ.
 		{
 			if (mShield.state == eShield_State::End
-				and Input::Get().GetKeyDown('E'))
+				and input.bShield)
 			{
-				mShieldSound.Replay();
+				mAudioEvents.Trigger(mShieldSoundEvent);
 
-				mShieldLabel.SetActive(true);
 				mShield.state = eShield_State::Growing;
 			}
 
-			constexpr float SHIELD_SKILL_DURATION = 3.0f;
-			constexpr float COOL_TIME = 8.0f;
-
-			// Ÿ ǥѴ.
-			{
-				mShield.labelCoolTimer += deltaTime;
-				const uint32_t seconds = uint32_t(mShield.labelCoolTimer) % 60;
-
-				if (mShield.state != eShield_State::End)
-				{
-					mShieldKeyLabel.SetActive(false);
-					mShieldLabel.SetText(std::to_wstring(uint32_t(2.0f + SHIELD_SKILL_DURATION + COOL_TIME) - seconds));
-
-				}
-				else
-				{
-					mShieldKeyLabel.SetActive(true);
-					mShieldLabel.SetActive(false);
-				}
-			}
+			// Ÿ  Update  Ÿ̸Ӹ  .
+			mShield.labelCoolTimer += deltaTime;
 
 			switch (mShield.state)
 			{
 			case eShield_State::Growing:
 			{
-				mShieldKeyLabel.SetActive(false);
-
 				mShield.speed = 100.0f;
 
 				mShield.scale.width += mShield.speed * deltaTime;
@@ -1066,11 +1347,9 @@ bool MainScene::Update(const float deltaTime)
 
 			case eShield_State::CoolTime:
 			{
-				mShieldSound.Pause();
-
 				mShield.coolTimer += deltaTime;
 
-				if (mShield.coolTimer >= COOL_TIME)
+				if (mShield.coolTimer >= SHIELD_COOL_TIME)
 				{
 					mShield.coolTimer = 0.0f;
 					mShield.state = eShield_State::End;
@@ -1092,33 +1371,22 @@ bool MainScene::Update(const float deltaTime)
 
 		// ÷̾ ֺ ϴ ų ƮѴ.
 		{
-			if (Input::Get().GetKeyDown('Q')
+			if (input.bOrbit
 				and mOrbit.state == eOrbit_State::End)
 			{
-				mOrbitSound.Replay();
+				mAudioEvents.Trigger(mOrbitSoundEvent);
 
-				mOrbitLabel.SetActive(true);
 				mOrbit.state = eOrbit_State::Rotating;
+
+				// ù ƽ  ÷̾ ߽ɿ  ʵ   .
+				mOrbit.ellipse.point = Math::RotateVector({ .x = 0.0f, .y = ORBIT_OFFSET }, -mOrbit.angle);
+				mOrbit.prevPoint = mOrbit.ellipse.point;
 			}
 
 			constexpr float SPEED = 400.0f;
-			constexpr float ROTATE_TIME = 4.0f;
-			constexpr float COOL_TIME = 6.0f;
 
+			// Ÿ  Update  Ÿ̸Ӹ  .
 			mOrbit.labelCoolTimer += deltaTime;
-			const uint32_t seconds = uint32_t(mOrbit.labelCoolTimer) % 60;
-
-			// Ÿ ǥѴ.
-			if (mOrbit.state != eOrbit_State::End)
-			{
-				mOrbitKeyLabel.SetActive(false);
-				mOrbitLabel.SetText(std::to_wstring(uint32_t(ROTATE_TIME + COOL_TIME) - seconds));
-			}
-			else
-			{
-				mOrbitKeyLabel.SetActive(true);
-				mOrbitLabel.SetActive(false);
-			}
 
 			switch (mOrbit.state)
 			{
@@ -1127,12 +1395,12 @@ bool MainScene::Update(const float deltaTime)
 				mOrbit.rotatingTimer += deltaTime;
 				mOrbit.angle += SPEED * deltaTime;
 
-				constexpr float OFFSET = 160.0f;
-				mOrbit.ellipse.point = { .x = 0.0f, .y = OFFSET };
+				mOrbit.prevPoint = mOrbit.ellipse.point;
+				mOrbit.ellipse.point = { .x = 0.0f, .y = ORBIT_OFFSET };
 				mOrbit.ellipse.point = Math::RotateVector(mOrbit.ellipse.point, -mOrbit.angle);
 
 				// 1   Ÿ. ( 4 )
-				if ((ROTATE_TIME - mOrbit.rotatingTimer) <= 1.0f)
+				if ((ORBIT_ROTATE_TIME - mOrbit.rotatingTimer) <= 1.0f)
 				{
 					mOrbit.blinkTimer += deltaTime;
 
@@ -1147,7 +1415,7 @@ bool MainScene::Update(const float deltaTime)
 					mOrbit.isBlinkOn = true;
 				}
 
-				if (mOrbit.rotatingTimer >= ROTATE_TIME)
+				if (mOrbit.rotatingTimer >= ORBIT_ROTATE_TIME)
 				{
 					mOrbit.rotatingTimer = 0.0f;
 					mOrbit.state = eOrbit_State::CoolTime;
@@ -1157,11 +1425,9 @@ bool MainScene::Update(const float deltaTime)
 			}
 			case eOrbit_State::CoolTime:
 			{
-				mOrbitSound.Pause();
-
 				mOrbit.coolTimer += deltaTime;
 
-				if (mOrbit.coolTimer >= COOL_TIME)
+				if (mOrbit.coolTimer >= ORBIT_COOL_TIME)
 				{
 					mOrbit.coolTimer = 0.0f;
 					mOrbit.state = eOrbit_State::End;
@@ -1180,7 +1446,7 @@ bool MainScene::Update(const float deltaTime)
 
 		//  ͸   ִ ų ƮѴ.
 		{			
-			if (Input::Get().GetKeyDown('F'))
+			if (input.bKillAll)
 			{
 				if (mKillMonsterCount >= KILL_ALL_MONSTER_COUNT)
 				{
@@ -1198,7 +1464,7 @@ bool MainScene::Update(const float deltaTime)
 					}
 
 					monster.hp = 0;
-					spawnParticle(mRectParticles.data(), mRectParticles.size(), &monster, PARTICLE_PER);
+					spawnParticle(EntityWorld::GetMask<RectParticleTag>(), &monster, PARTICLE_PER);
 				}
 
 				for (RunMonster& run : mRunMonsters)
@@ -1209,7 +1475,7 @@ bool MainScene::Update(const float deltaTime)
 					}
 
 					run.monster.hp = 0;
-					spawnParticle(mRectParticles.data(), mRectParticles.size(), &run.monster, PARTICLE_PER);
+					spawnParticle(EntityWorld::GetMask<RectParticleTag>(), &run.monster, PARTICLE_PER);
 				}
 
 				for (SlowMonster& slow : mSlowMonsters)
@@ -1220,7 +1486,7 @@ bool MainScene::Update(const float deltaTime)
 					}
 
 					slow.monster.hp = 0;
-					spawnParticle(mRectParticles.data(), mRectParticles.size(), &slow.monster, PARTICLE_PER);
+					spawnParticle(EntityWorld::GetMask<RectParticleTag>(), &slow.monster, PARTICLE_PER);
 				}
 
 				mKillMonsterCount = 0;
@@ -1229,12 +1495,16 @@ bool MainScene::Update(const float deltaTime)
 		}
 	}
 
-	// ͸  ð Ѵ.
+	endPhase(eMainScene_Phase::Hero);
+
+	// ͸  ð Ѵ. Ǯ Ű ŭ     Ѵ.
 	{
 		// ū 
 		mBigMonsterSpawnTimer += deltaTime;
-		if (mBigMonsterSpawnTimer >= 0.5f)
+		if (mBigMonsterSpawnTimer >= mBigMonsterSpawnTime)
 		{
+			uint32_t spawnCount = 0;
+
 			for (Monster& monster : mBigMonsters)
 			{
 				if (monster.sprite.IsActive())
@@ -1253,14 +1523,21 @@ bool MainScene::Update(const float deltaTime)
 
 				monster.moveSpeed = getRandom(10.0f, 80.0f);
 				mBigMonsterSpawnTimer = 0.0f;
-				break;
+				++spawnCount;
+
+				if (spawnCount == mPoolScale.bigMonster)
+				{
+					break;
+				}
 			}
 		}
 
 		//  
 		mRunMonsterSpawnTimer += deltaTime;
-		if (mRunMonsterSpawnTimer >= 2.0f)
+		if (mRunMonsterSpawnTimer >= mRunMonsterSpawnTime)
 		{
+			uint32_t spawnCount = 0;
+
 			for (RunMonster& run : mRunMonsters)
 			{
 				Sprite& sprite = run.monster.sprite;
@@ -1280,19 +1557,25 @@ bool MainScene::Update(const float deltaTime)
 
 				// ߹ٸ Ѵ.
 				run.isMoveable = false;
-				run.startBar.SetPosition({ .x = sprite.GetPosition().x - 10.0f, .y = sprite.GetPosition().y - 20.0f });
 				run.startBar.SetScale({ .width = 0.0f, .height = 0.1f });
 				run.startBar.SetActive(false);
 
 				mRunMonsterSpawnTimer = 0.0f;
-				break;
+				++spawnCount;
+
+				if (spawnCount == mPoolScale.runMonster)
+				{
+					break;
+				}
 			}
 		}
 
 		//  
 		mSlowMonsterSpawnTimer += deltaTime;
-		if (mSlowMonsterSpawnTimer >= 1.0f)
+		if (mSlowMonsterSpawnTimer >= mSlowMonsterSpawnTime)
 		{
+			uint32_t spawnCount = 0;
+
 			for (SlowMonster& slow : mSlowMonsters)
 			{
 				Monster& monster = slow.monster;
@@ -1313,7 +1596,12 @@ bool MainScene::Update(const float deltaTime)
 				);
 
 				mSlowMonsterSpawnTimer = 0.0f;
-				break;
+				++spawnCount;
+
+				if (spawnCount == mPoolScale.slowMonster)
+				{
+					break;
+				}
 			}
 		}
 	}
@@ -1383,6 +1671,8 @@ bool MainScene::Update(const float deltaTime)
 		}
 	}
 
+	endPhase(eMainScene_Phase::Spawn);
+
 	//  HpBar Active ƮѴ.
 	{
 		// ū 
@@ -1455,6 +1745,9 @@ bool MainScene::Update(const float deltaTime)
 
 	//  ̵ ƮѴ.
 	{
+		// ÷̾  ٲ ̵ θ ٽ Ѵ.
+		mFlowField.SetTarget(mHero.sprite.GetPosition());
+
 		// ū 
 		for (Monster& monster : mBigMonsters)
 		{
@@ -1465,20 +1758,13 @@ bool MainScene::Update(const float deltaTime)
 
 			Sprite& sprite = monster.sprite;
 			D2D1_POINT_2F position = sprite.GetPosition();
+			monster.prevPosition = position;
 
-			D2D1_POINT_2F direction = Math::SubtractVector({}, position);
-			direction = Math::NormalizeVector(direction);
+			const D2D1_POINT_2F direction = mFlowField.GetDirection(position);
 			const D2D1_POINT_2F velocity = Math::ScaleVector(direction, monster.moveSpeed * deltaTime);
 
 			position = Math::AddVector(position, velocity);
 			sprite.SetPosition(position);
-
-			// hp ǥ ƮѴ.
-			{
-				const D2D1_POINT_2F position = getHpBarOffset(sprite, { .x = 3.5f, .y = -10.0f });
-				monster.backgroundHpBar.SetPosition(position);
-				monster.hpBar.SetPosition(position);
-			}
 		}
 
 		//  
@@ -1491,6 +1777,7 @@ bool MainScene::Update(const float deltaTime)
 			}
 
 			Sprite& sprite = monster.sprite;
+			monster.prevPosition = sprite.GetPosition();
 
 			if (not run.isMoveable)
 			{
@@ -1529,13 +1816,6 @@ bool MainScene::Update(const float deltaTime)
 			D2D1_POINT_2F position = sprite.GetPosition();
 			position = Math::AddVector(position, velocity);
 			sprite.SetPosition(position);
-
-			// hp ǥ ƮѴ.
-			{
-				const D2D1_POINT_2F position = getHpBarOffset(sprite, { .x = 0.0f, .y = -10.0f });
-				monster.backgroundHpBar.SetPosition(position);
-				monster.hpBar.SetPosition(position);
-			}
 		}
 
 		//  
@@ -1554,6 +1834,8 @@ bool MainScene::Update(const float deltaTime)
 					continue;
 				}
 
+				monster.prevPosition = sprite.GetPosition();
+
 				//   ̵
 				switch (slow.moveState)
 				{
@@ -1576,13 +1858,6 @@ bool MainScene::Update(const float deltaTime)
 						slow.stopTimer = 0.0f;
 					}
 
-					// hp ǥ ƮѴ.
-					{
-						const D2D1_POINT_2F position = getHpBarOffset(sprite, { .x = 2.0f, .y = -10.0f });
-						monster.backgroundHpBar.SetPosition(position);
-						monster.hpBar.SetPosition(position);
-					}
-
 					break;
 				}
 
@@ -1596,8 +1871,7 @@ bool MainScene::Update(const float deltaTime)
 						slow.shadowCoolTimer = 0.0f;
 
 						slow.startPosition = sprite.GetPosition();
-						D2D1_POINT_2F direction = Math::SubtractVector({}, slow.startPosition);
-						direction = Math::NormalizeVector(direction);
+						const D2D1_POINT_2F direction = mFlowField.GetDirection(slow.startPosition);
 						slow.endPosition = Math::AddVector(slow.startPosition, Math::ScaleVector(direction, LENGTH));
 
 						slow.moveState = eSlow_Monster_State::Moving;
@@ -1661,6 +1935,14 @@ bool MainScene::Update(const float deltaTime)
 		}
 	}
 
+	endPhase(eMainScene_Phase::Monster);
+
+	// ͳ ġ ʵ о.
+	buildMonsterGrid();
+	separateMonsters(deltaTime);
+
+	endPhase(eMainScene_Phase::Separation);
+
 	// Ѿ -  浹 , ƼŬ Ѵ.
 	{
 		// ū 
@@ -1671,7 +1953,7 @@ bool MainScene::Update(const float deltaTime)
 				continue;
 			}
 
-			spawnParticle(mStarParticles.data(), mStarParticles.size(), &monster, PARTICLE_PER);
+			spawnParticle(EntityWorld::GetMask<StarParticleTag>(), &monster, PARTICLE_PER);
 
 			if (monster.hp <= 0)
 			{
@@ -1690,7 +1972,7 @@ bool MainScene::Update(const float deltaTime)
 				continue;
 			}
 
-			spawnParticle(mStarParticles.data(), mStarParticles.size(), &monster, PARTICLE_PER);
+			spawnParticle(EntityWorld::GetMask<StarParticleTag>(), &monster, PARTICLE_PER);
 			++mKillMonsterCount;
 			monster.isBulletColliding = false;
 		}
@@ -1704,7 +1986,7 @@ bool MainScene::Update(const float deltaTime)
 				continue;
 			}
 
-			spawnParticle(mStarParticles.data(), mStarParticles.size(), &monster, PARTICLE_PER);
+			spawnParticle(EntityWorld::GetMask<StarParticleTag>(), &monster, PARTICLE_PER);
 			++mKillMonsterCount;
 			monster.isBulletColliding = false;
 		}
@@ -1811,7 +2093,7 @@ bool MainScene::Update(const float deltaTime)
 				and monster.state == eMonster_State::Life)
 			{
 				monster.state = eMonster_State::Dead;
-				mBigMonsterDeadSound.Replay();
+				mAudioEvents.Trigger(mBigMonsterDeadSoundEvent, monster.sprite.GetPosition());
 			}
 
 			deadMonsterEffect(
@@ -1838,7 +2120,7 @@ bool MainScene::Update(const float deltaTime)
 				and monster.state == eMonster_State::Life)
 			{
 				monster.state = eMonster_State::Dead;
-				mRunMonsterDeadSound.Replay();
+				mAudioEvents.Trigger(mRunMonsterDeadSoundEvent, monster.sprite.GetPosition());
 
 				run.startBar.SetActive(false);
 			}
@@ -1867,7 +2149,7 @@ bool MainScene::Update(const float deltaTime)
 				and monster.state == eMonster_State::Life)
 			{
 				monster.state = eMonster_State::Dead;
-				mSlowMonsterDeadSound.Replay();
+				mAudioEvents.Trigger(mSlowMonsterDeadSoundEvent, monster.sprite.GetPosition());
 
 				for (Sprite& shadow : slow.shadow)
 				{
@@ -1888,8 +2170,7 @@ bool MainScene::Update(const float deltaTime)
 	}
 
 	// ƼŬ ƮѴ.
-	updateParticle(mStarParticles.data(), STAR_PARTICLE_COUNT, deltaTime);
-	updateParticle(mRectParticles.data(), RECT_PARTICLE_COUNT, deltaTime);
+	updateParticle(deltaTime);
 
 	// Ʈ ƮѴ.
 	{
@@ -1898,8 +2179,8 @@ bool MainScene::Update(const float deltaTime)
 		(
 			{
 				.sprite = mLongEffect.data(),
-				.size = LONG_EFFECT_COUNT,
-				.timer = mLongEffectTimer,
+				.size = uint32_t(mLongEffect.size()),
+				.timer = mLongEffectTimer.data(),
 				.time = 0.5f,
 				.scale = { LONG_EFFECT_SCALE.width, LONG_EFFECT_SCALE.height},
 				.deltaTime = deltaTime
@@ -1911,7 +2192,7 @@ bool MainScene::Update(const float deltaTime)
 		(
 			{
 				.effect = mCyanEffect.data(),
-				.size = CYAN_EFFECT_COUNT,
+				.size = uint32_t(mCyanEffect.size()),
 				.scale = { .width = 80.0f, .height = 80.0f },
 				.speed = 3.0f,
 				.time = 0.4f,
@@ -1925,7 +2206,7 @@ bool MainScene::Update(const float deltaTime)
 		(
 			{
 				.effect = mGreenEffect.data(),
-				.size = GREEN_EFFECT_COUNT,
+				.size = uint32_t(mGreenEffect.size()),
 				.scale = {.width = 70.0f, .height = 70.0f },
 				.speed = 3.0f,
 				.time = 0.7f,
@@ -1935,21 +2216,14 @@ bool MainScene::Update(const float deltaTime)
 		);
 	}
 
+	endPhase(eMainScene_Phase::Effect);
+
 	// ÷̾ ü¿ õ κ ƮѴ.
 	{
 		// ÷̾ ׾  ȴ.
+		//    Update ùķ̼ ڿ .
 		if (mHero.hp <= 0)
 		{
-			mBackgroundSound.Pause();
-			mDashSound.Pause();
-			mBulletSound.Pause();
-			mReloadSound.Pause();
-			mBigMonsterDeadSound.Pause();
-			mRunMonsterDeadSound.Pause();
-			mSlowMonsterDeadSound.Pause();
-			mShieldSound.Pause();
-			mOrbitSound.Pause();
-
 			mHero.hp = 0;
 			mHero.velocity = {};
 			mHero.sprite.SetPosition({});
@@ -1965,7 +2239,11 @@ bool MainScene::Update(const float deltaTime)
 			mShield.state = eShield_State::End;
 			mOrbit.state = eOrbit_State::End;
 
-			mGameOverSound.Play();
+			// ̺Ʈ 带 ó ٽ ƲǷ  ƽ . prevHp Ʒ ̹ ƽ ü ٲ.
+			if (mHero.prevHp > 0)
+			{
+				mAudioEvents.Trigger(mGameOverSoundEvent);
+			}
 		}
 
 		// UI ư 
@@ -1983,7 +2261,6 @@ bool MainScene::Update(const float deltaTime)
 					mIsGameOver = true;
 					mGameOver.SetActive(false);
 
-					Input::Get().SetCursorVisible(true);
 					mZoom.SetActive(false);
 
 					mGameOverBackground.SetActive(true);
@@ -1993,55 +2270,12 @@ bool MainScene::Update(const float deltaTime)
 					mGameOverTimer = 0.0f;
 				}
 			}
-
-			// UI ư ƮѴ.
-			if (mIsGameOver)
-			{
-				updateButtonState
-				(
-					{
-						.sprite = &mResumeButton,
-						.isColliding = mIsResumeButtonColliding,
-						.originalTexture = &mResumeIdleButtonTexture,
-						.effectTexture = &mResumeContactButtonTexture,
-						.isSoundPlay = &mIsResumeButtonSoundPlay
-					}
-				);
-
-				updateButtonState
-				(
-					{
-						.sprite = &mExitButton,
-						.isColliding = mIsExitButtonColliding,
-						.originalTexture = &mExitIdleButtonTexture,
-						.effectTexture = &mExitContactButtonTexture,
-						.isSoundPlay = &mIsExitButtonSoundPlay
-					}
-				);
-
-				if (mIsResumeButtonColliding)
-				{
-					if (Input::Get().GetMouseButtonDown(Input::eMouseButton::Left))
-					{
-						mIsUpdate = false;
-					}
-				}
-
-				if (mIsExitButtonColliding)
-				{
-					if (Input::Get().GetMouseButtonDown(Input::eMouseButton::Left))
-					{
-						PostQuitMessage(0);
-					}
-				}
-			}
 		}
 
-		// ÷̾ ü  Ʈ Ѵ.
+		// ü ٲ   Hit Effect Ҵ. ü  Update .
 		if (mHero.prevHp != mHero.hp)
 		{
-			mHeroHitSound.Replay();
-			mHpValueLabel.SetText(L"Hp: " + std::to_wstring(mHero.hp) + L" / " + std::to_wstring(HERO_MAX_HP));
+			mAudioEvents.Trigger(mHeroHitSoundEvent);
 			mHero.isHitEffect = true;
 
 			mHero.prevHp = mHero.hp;
@@ -2103,8 +2337,6 @@ bool MainScene::Update(const float deltaTime)
 		scale = Math::LerpVector(scale, { .x = targetWidth, .y = scale.y }, 20.0f * deltaTime);
 		mUiKillCountBar.SetScale({ scale.x, scale.y });
 
-		mKillAllMonsterLabel.SetText(L"F: " + std::to_wstring(mKillMonsterCount) + L" / " + std::to_wstring(KILL_ALL_MONSTER_COUNT));
-
 		if (mKillMonsterCount >= KILL_ALL_MONSTER_COUNT)
 		{
 			mKillMonsterCount = 10;
@@ -2113,71 +2345,34 @@ bool MainScene::Update(const float deltaTime)
 
 	// ÷̾ 뽬ٸ ƮѴ.
 	{
-		static int32_t prevDashCount = mDash.count;
-
-		if (prevDashCount != mDash.count)
-		{
-			mDashValueLabel.SetText(L"Dash: " + std::to_wstring(mDash.count) + L" / " + std::to_wstring(DASH_MAX_COUNT));
-
-			prevDashCount = mDash.count;
-		}
-
 		D2D1_POINT_2F scale = { mUiDashBar.GetScale().width, mUiDashBar.GetScale().height };
 		scale = Math::LerpVector(scale, { UI_DASH_SCALE_WIDTH * (float(mDash.count) / float(DASH_MAX_COUNT)),  scale.y }, 8.0f * deltaTime);
 		mUiDashBar.SetScale({ scale.x, scale.y });
 	}
 
-	// Ѿ  ƮѴ.
+	// Ÿ̸Ӹ ƮѴ.
+	if (mHero.hp > 0)
 	{
-		static int32_t prevBulletCount = mBulletValue;
-
-		if (prevBulletCount != mBulletValue)
-		{
-			mBulletLabel.SetText(std::to_wstring(mBulletValue) + L"/" + std::to_wstring(BULLET_COUNT));
-
-			prevBulletCount = mBulletValue;
-		}
+		mGameTimer += deltaTime;
 	}
 
-	// Ÿ̸  ƮѴ.
-	{
-		if (mHero.hp > 0)
-		{
-			mGameTimer += deltaTime;
-		}
-
-		const uint32_t seconds = uint32_t(mGameTimer) % 60;
-		const uint32_t minutes = uint32_t(mGameTimer) / 60;
-
-		std::wstring name = L"Timer: " + std::to_wstring(minutes) + L":" + std::to_wstring(seconds);
-		mTimerLabel.SetText(name);
-	}
+	endPhase(eMainScene_Phase::UI);
 
 	// 浹 ó ƮѴ.
-	{		
-		// Resume Button
-		if (Collision::IsCollidedSqureWithPoint(getRectangleFromSprite(mResumeButton, mResumeIdleButtonTexture), getMouseWorldPosition()))
-		{
-			mIsResumeButtonColliding = true;
-		}
-		else
-		{
-			mIsResumeButtonColliding = false;
-		}
+	{
+		addColliders();
+		mCollisionWorld.Update();
 
-		// Exit Button
-		if (Collision::IsCollidedSqureWithPoint(getRectangleFromSprite(mExitButton, mExitIdleButtonTexture), getMouseWorldPosition()))
-		{
-			mIsExitButtonColliding = true;
-		}
-		else
-		{
-			mIsExitButtonColliding = false;
-		}
+		mIsResumeButtonColliding = false;
+		mIsExitButtonColliding = false;
 
-		// ÷̾ - ܺ 
+		//   浹 óѴ. lhs ̾ Ʈ  ̴.
+		for (const CollisionContact& contact : mCollisionWorld.GetContacts())
 		{
-			if (not Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(mHero.sprite), {}, BOUNDARY_RADIUS))
+			switch (contact.lhsLayer | contact.rhsLayer)
+			{
+			// ÷̾ - ܺ 
+			case HERO_LAYER | OUT_BOUNDARY_LAYER:
 			{
 				mHero.velocity = {};
 
@@ -2186,458 +2381,177 @@ bool MainScene::Update(const float deltaTime)
 
 				heroPosition = Math::AddVector(heroPosition, Math::ScaleVector(direction, -2.0f));
 				mHero.sprite.SetPosition(heroPosition);
+				break;
 			}
-		}
 
-		// ÷̾ -  
-		{
-			const float offset = IN_BOUNDARY_RADIUS + mHero.sprite.GetScale().height * mPinkRectangleTexture.GetHeight();
-			if (Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(mHero.sprite), {}, offset))
+			// ÷̾ -  
+			case HERO_LAYER | IN_BOUNDARY_LAYER:
 			{
 				mHero.velocity = {};
 
 				D2D1_POINT_2F heroPosition = mHero.sprite.GetPosition();
+
+				//  ӿ  ߴٸ ó  ġ ǵ.
+				if (0.0f < contact.time and contact.time < 1.0f)
+				{
+					heroPosition = Math::LerpVector(mHero.prevPosition, heroPosition, contact.time);
+				}
+
 				const D2D1_POINT_2F direction = Math::NormalizeVector(heroPosition);
 
 				heroPosition = Math::AddVector(heroPosition, Math::ScaleVector(direction, 2.0f));
 				mHero.sprite.SetPosition(heroPosition);
+				break;
 			}
-		}
-
-		// Ѿ˰  浹Ѵ.
-		for (Bullet& bullet : mBullets)
-		{
-			Sprite& sprite = bullet.sprite;
 
-			const float halfLength = sprite.GetScale().width * mRectangleTexture.GetWidth() * 0.5f;
-			const D2D1_POINT_2F endPosition =
+			//  - ÷̾
+			case HERO_LAYER | MONSTER_LAYER:
 			{
-				.x = sprite.GetPosition().x + bullet.direction.x * halfLength,
-				.y = sprite.GetPosition().y + bullet.direction.y * halfLength
-			};
-
-			Line line =
-			{
-				.Point0 = bullet.prevPosition,
-				.Point1 = endPosition
-			};
-
-			bool isBoundryToBullet = Collision::IsCollidedCircleWithLine({}, BOUNDARY_RADIUS, line);
-			if (not isBoundryToBullet)
-			{
-				sprite.SetActive(false);
-			}
-
-			const float offset = IN_BOUNDARY_RADIUS + sprite.GetScale().height * mRedRectangleTexture.GetHeight();
-			bool isInBoundryToBullet = Collision::IsCollidedCircleWithLine({}, offset, line);
-			if (isInBoundryToBullet)
-			{
-				sprite.SetActive(false);
-			}
-		}
-
-		for (Monster& monster : mBigMonsters)
-		{
-			Sprite& sprite = monster.sprite;
-			if (not sprite.IsActive())
-			{
-				continue;
-			}
-
-			if (monster.state != eMonster_State::Life)
-			{
-				continue;
-			}
-
-			//  -  ٿ
-			{
-				const float offset = IN_BOUNDARY_RADIUS + monster.sprite.GetScale().height * mRectangleTexture.GetHeight() * 0.5f;
-				const bool isCollision = Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(monster.sprite), {}, offset);
-
-				if (isCollision and monster.hp > 0)
-				{
-					monster.hp -= BIG_MONSTER_MAX_HP;
-					mHero.hp -= MONSTER_ATTACK_VALUE;
-					mHero.isHitBoundry = true;
-				}
-			}
-
-			//  - ÷̾
-			{
-				const bool isCollision = Collision::IsCollidedSqureWithSqure(getRectangleFromSprite(mHero.sprite), getRectangleFromSprite(monster.sprite));
-				if (isCollision and monster.hp > 0)
-				{
-					monster.hp -= BIG_MONSTER_MAX_HP;
-					mHero.hp -= MONSTER_ATTACK_VALUE;
-				}
-			}
-		}
-
-		for (RunMonster& run : mRunMonsters)
-		{
-			Monster& monster = run.monster;
-			Sprite& sprite = monster.sprite;
-			if (not sprite.IsActive())
-			{
-				continue;
-			}
-
-			if (monster.state != eMonster_State::Life)
-			{
-				continue;
-			}
+				Monster* monster = static_cast<Monster*>(contact.rhs);
 
-			//   -  ٿ
-			{
-				const float offset = IN_BOUNDARY_RADIUS + monster.sprite.GetScale().height * mRectangleTexture.GetHeight();
-				const bool isCollision = Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(monster.sprite), {}, offset);
-
-				if (isCollision and monster.hp > 0)
+				if (monster->hp > 0)
 				{
-					monster.hp -= RUN_MONSTER_MAX_HP;
+					monster->hp = 0;
 					mHero.hp -= MONSTER_ATTACK_VALUE;
-					mHero.isHitBoundry = true;
 				}
+				break;
 			}
 
-			//   - ܺ ٿ
+			//  - , ܺ ٿ
+			case MONSTER_LAYER | IN_BOUNDARY_LAYER:
+			case MONSTER_LAYER | OUT_BOUNDARY_LAYER:
 			{
-				const bool isCollision = not (Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(monster.sprite), {}, BOUNDARY_RADIUS));
+				Monster* monster = static_cast<Monster*>(contact.lhs);
 
-				if (isCollision and monster.hp > 0)
+				if (monster->hp > 0)
 				{
-					monster.hp -= RUN_MONSTER_MAX_HP;
+					monster->hp = 0;
 					mHero.hp -= MONSTER_ATTACK_VALUE;
 					mHero.isHitBoundry = true;
 				}
+				break;
 			}
 
-			//  - ÷̾
-			{
-				const bool isCollision = Collision::IsCollidedSqureWithSqure(getRectangleFromSprite(mHero.sprite), getRectangleFromSprite(monster.sprite));
-
-				if (isCollision and monster.hp > 0)
-				{
-					monster.hp -= RUN_MONSTER_MAX_HP;
-					mHero.hp -= MONSTER_ATTACK_VALUE;
-				}
-			}
-		}
-
-		for (SlowMonster& slow : mSlowMonsters)
-		{
-			Monster& monster = slow.monster;
-			Sprite& sprite = monster.sprite;
-
-			if (not sprite.IsActive())
-			{
-				continue;
-			}
-
-			if (monster.state != eMonster_State::Life)
-			{
-				continue;
-			}
-
-			//   -  ٿ
+			// Ѿ - 
+			case MONSTER_LAYER | BULLET_LAYER:
 			{
-				const float offset = IN_BOUNDARY_RADIUS + monster.sprite.GetScale().height * mRectangleTexture.GetHeight();
-				const bool isCollision = Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(monster.sprite), {}, offset);
+				Bullet* bullet = static_cast<Bullet*>(contact.rhs);
 
-				if (isCollision and monster.hp > 0)
+				// Ѿ     ϳ .
+				if (not bullet->sprite.IsActive())
 				{
-					monster.hp -= SLOW_MONSTER_MAX_HP;
-					mHero.hp -= MONSTER_ATTACK_VALUE;
-					mHero.isHitBoundry = true;
+					break;
 				}
-			}
 
-			//   - ÷̾
-			{
-				const bool isCollision = Collision::IsCollidedSqureWithSqure(getRectangleFromSprite(mHero.sprite), getRectangleFromSprite(monster.sprite));
+				Monster* monster = static_cast<Monster*>(contact.lhs);
+				monster->hp -= BULLET_ATTACK_VALUE;
+				monster->isBulletColliding = true;
 
-				if (isCollision and monster.hp > 0)
-				{
-					monster.hp -= SLOW_MONSTER_MAX_HP;
-					mHero.hp -= MONSTER_ATTACK_VALUE;
-				}
+				bullet->sprite.SetActive(false);
+				break;
 			}
-		}
 
-		// Ѿ˰   浹 ˻Ѵ.
-		for (Bullet& bullet : mBullets)
-		{
-			Sprite& bulletSprite = bullet.sprite;
-			if (not bulletSprite.IsActive())
+			// Ѿ - , ܺ 
+			case BULLET_LAYER | IN_BOUNDARY_LAYER:
+			case BULLET_LAYER | OUT_BOUNDARY_LAYER:
 			{
-				continue;
+				Bullet* bullet = static_cast<Bullet*>(contact.lhs);
+				bullet->sprite.SetActive(false);
+				break;
 			}
 
-			//  ǥ  ǥ  ׷ 浹üũ Ѵ.
-			const float halfLength = bulletSprite.GetScale().width * mRectangleTexture.GetWidth() * 0.5f;
-			const D2D1_POINT_2F endPosition =
+			// ÷̾  Ͱ 浹ϸ ʹ ȴ.
+			case MONSTER_LAYER | SHIELD_LAYER:
 			{
-				.x = bulletSprite.GetPosition().x + bullet.direction.x * halfLength,
-				.y = bulletSprite.GetPosition().y + bullet.direction.y * halfLength
-			};
-
-			const Line line =
-			{
-				.Point0 = bullet.prevPosition,
-				.Point1 = endPosition
-			};
-
-			// Ѿ˰ ⺻  浹 ˻Ѵ.
-			Sprite* targetMonster = nullptr;
-			float targetMonsterDistance = 999.9f;
-
-			for (Monster& monster : mBigMonsters)
-			{
-				if (monster.state != eMonster_State::Life)
-				{
-					continue;
-				}
+				Monster* monster = static_cast<Monster*>(contact.lhs);
 
-				Sprite& sprite = monster.sprite;
-				if (not Collision::IsCollidedSqureWithLine(getRectangleFromSprite(sprite), line))
+				if (monster->hp > 0)
 				{
-					continue;
-				}
-
-				const float distance = Math::GetVectorLength(Math::SubtractVector(bullet.prevPosition, sprite.GetPosition()));
-				if (distance < targetMonsterDistance)
-				{
-					monster.hp -= BULLET_ATTACK_VALUE;
-					monster.isBulletColliding = true;
-
-					targetMonster = &sprite;
-					targetMonsterDistance = distance;
+					monster->isShieldColliding = true;
+					monster->hp = 0;
 				}
+				break;
 			}
 
-			//  ͸ Ѵ.
-			Sprite* targetRunMonster = nullptr;
-			float targetRunMonsterDistance = 999.9f;
-
-			for (RunMonster& run : mRunMonsters)
+			// ÷̾ ֺ ϴ  Ͱ 浹ϸ ʹ ȴ.
+			case MONSTER_LAYER | ORBIT_LAYER:
 			{
-				Monster& monster = run.monster;
-				Sprite& sprite = monster.sprite;
-
-				if (not sprite.IsActive())
-				{
-					continue;
-				}
+				Monster* monster = static_cast<Monster*>(contact.lhs);
 
-				if (monster.state != eMonster_State::Life)
+				if (monster->hp > 0)
 				{
-					continue;
-				}
-
-				if (not Collision::IsCollidedSqureWithLine(getRectangleFromSprite(sprite), line))
-				{
-					continue;
-				}
-
-				const float distance = Math::GetVectorLength(Math::SubtractVector(bullet.prevPosition, sprite.GetPosition()));
-				if (distance < targetRunMonsterDistance)
-				{
-					monster.hp -= BULLET_ATTACK_VALUE;
-					monster.isBulletColliding = true;
-
-					targetRunMonster = &sprite;
-					targetRunMonsterDistance = distance;
+					monster->isOrbitColliding = true;
+					monster->hp = 0;
 				}
+				break;
 			}
 
-			//  ͸ Ѵ
-			Sprite* targetSlowMonster = nullptr;
-			float targetSlowMonsterDistance = 999.9f;
-
-			for (SlowMonster& slow : mSlowMonsters)
+			// UI ư - 콺
+			case CURSOR_LAYER | BUTTON_LAYER:
 			{
-				Monster& monster = slow.monster;
-				Sprite& sprite = monster.sprite;
-
-				if (not sprite.IsActive())
-				{
-					continue;
-				}
-
-				if (monster.state != eMonster_State::Life)
-				{
-					continue;
-				}
-
-				if (not Collision::IsCollidedSqureWithLine(getRectangleFromSprite(sprite), line))
+				if (contact.rhs == &mResumeButton)
 				{
-					continue;
+					mIsResumeButtonColliding = true;
 				}
-
-				const float distance = Math::GetVectorLength(Math::SubtractVector(bullet.prevPosition, sprite.GetPosition()));
-				if (distance < targetMonsterDistance)
+				else if (contact.rhs == &mExitButton)
 				{
-					monster.hp -= BULLET_ATTACK_VALUE;
-					monster.isBulletColliding = true;
-
-					targetSlowMonster = &sprite;
-					targetSlowMonsterDistance = distance;
+					mIsExitButtonColliding = true;
 				}
+				break;
 			}
 
-			if (targetMonster != nullptr
-				or targetRunMonster != nullptr
-				or targetSlowMonster != nullptr)
-			{
-				bullet.sprite.SetActive(false);
-			}
-		}
-
-		// ÷̾  Ͱ 浹ϸ ʹ ȴ.
-		for (Monster& monster : mBigMonsters)
-		{
-			if (monster.state != eMonster_State::Life)
-			{
-				continue;
-			}
-
-			if (mShield.state != eShield_State::Growing
-				and mShield.state != eShield_State::Waiting)
-			{
-				continue;
-			}
-
-			const float offset = mShield.scale.width * 0.5f + monster.sprite.GetScale().height * mRectangleTexture.GetHeight();
-			const bool isCollision = Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(monster.sprite), mHero.sprite.GetPosition(), offset);
-			
-			if (isCollision and monster.hp > 0)
-			{
-				monster.isShieldColliding = true;
-				monster.hp -= BIG_MONSTER_MAX_HP;
-			}
-		}
-
-		for (RunMonster& run : mRunMonsters)
-		{
-			Monster& monster = run.monster;
-			if (monster.state != eMonster_State::Life)
-			{
-				continue;
-			}
-
-			if (mShield.state != eShield_State::Growing
-				and mShield.state != eShield_State::Waiting)
-			{
-				continue;
-			}
-
-			const float offset = mShield.scale.width * 0.5f + monster.sprite.GetScale().height * mRectangleTexture.GetHeight();
-			const bool isCollision = Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(monster.sprite), mHero.sprite.GetPosition(), offset);
-			
-			if (isCollision and monster.hp > 0)
-			{
-				monster.isShieldColliding = true;
-				monster.hp -= RUN_MONSTER_MAX_HP;
-			}
-		}
-
-		for (SlowMonster& slow : mSlowMonsters)
-		{
-			Monster& monster = slow.monster;
-			if (monster.state != eMonster_State::Life)
-			{
-				continue;
-			}
-
-			if (mShield.state != eShield_State::Growing
-				and mShield.state != eShield_State::Waiting)
-			{
-				continue;
-			}
-
-			const float offset = mShield.scale.width * 0.5f + monster.sprite.GetScale().height * mRectangleTexture.GetHeight();
-			const bool isCollision = Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(monster.sprite), mHero.sprite.GetPosition(), offset);
-			
-			if (isCollision and monster.hp > 0)
-			{
-				monster.isShieldColliding = true;
-				monster.hp -= SLOW_MONSTER_MAX_HP;
+			default:
+				break;
 			}
 		}
+	}
 
-		// ÷̾ ֺ ϴ  Ͱ 浹ϸ ʹ ȴ.
-		for (Monster& monster : mBigMonsters)
-		{
-			if (monster.state != eMonster_State::Life)
-			{
-				continue;
-			}
+	endPhase(eMainScene_Phase::Collision);
 
-			if (mOrbit.state != eOrbit_State::Rotating)
+	// UI ư ƮѴ. ̹ ƽ Ŀ ư 浹 .
+	if (mIsGameOver)
+	{
+		updateButtonState
+		(
 			{
-				continue;
+				.sprite = &mResumeButton,
+				.isColliding = mIsResumeButtonColliding,
+				.originalTexture = &mResumeIdleButtonTexture,
+				.effectTexture = &mResumeContactButtonTexture,
+				.isSoundPlay = &mIsResumeButtonSoundPlay
 			}
+		);
 
-			const D2D1_POINT_2F center = Math::SubtractVector(mHero.sprite.GetPosition(), mOrbit.ellipse.point);
-			const float radius = mOrbit.ellipse.radiusX + monster.sprite.GetScale().height * mRectangleTexture.GetHeight();
-			const bool isCollision = Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(monster.sprite), center, radius);
-
-			if (isCollision and monster.hp > 0)
+		updateButtonState
+		(
 			{
-				monster.isOrbitColliding = true;
-				monster.hp -= BIG_MONSTER_MAX_HP;
+				.sprite = &mExitButton,
+				.isColliding = mIsExitButtonColliding,
+				.originalTexture = &mExitIdleButtonTexture,
+				.effectTexture = &mExitContactButtonTexture,
+				.isSoundPlay = &mIsExitButtonSoundPlay
 			}
-		}
+		);
 
-		for (RunMonster& run : mRunMonsters)
+		if (mIsResumeButtonColliding)
 		{
-			Monster& monster = run.monster;
-			if (monster.state != eMonster_State::Life)
-			{
-				continue;
-			}
-
-			if (mOrbit.state != eOrbit_State::Rotating)
+			if (input.bLeftButtonDown)
 			{
-				continue;
-			}
-
-			const D2D1_POINT_2F center = Math::SubtractVector(mHero.sprite.GetPosition(), mOrbit.ellipse.point);
-			const float radius = mOrbit.ellipse.radiusX + monster.sprite.GetScale().height * mRectangleTexture.GetHeight();
-			const bool isCollision = Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(monster.sprite), center, radius);
-			
-			if (isCollision and monster.hp > 0)
-			{
-				monster.isOrbitColliding = true;
-				monster.hp -= RUN_MONSTER_MAX_HP;
+				mIsUpdate = false;
 			}
 		}
 
-		for (SlowMonster& slow : mSlowMonsters)
+		if (mIsExitButtonColliding)
 		{
-			Monster& monster = slow.monster;
-			if (monster.state != eMonster_State::Life)
-			{
-				continue;
-			}
-
-			if (mOrbit.state != eOrbit_State::Rotating)
-			{
-				continue;
-			}
-
-			const D2D1_POINT_2F center = Math::SubtractVector(mHero.sprite.GetPosition(), mOrbit.ellipse.point);
-			const float radius = mOrbit.ellipse.radiusX + monster.sprite.GetScale().height * mRectangleTexture.GetHeight();
-			const bool isCollision = Collision::IsCollidedSqureWithCircle(getRectangleFromSprite(monster.sprite), center, radius);
-
-			if (isCollision and monster.hp > 0)
+			if (input.bLeftButtonDown)
 			{
-				monster.isOrbitColliding = true;
-				monster.hp -= SLOW_MONSTER_MAX_HP;
+				mIsExitRequested = true;
 			}
 		}
 	}
 
+	endPhase(eMainScene_Phase::UI);
+
 	// ī޶ ƮѴ.
 	{
 		D2D1_POINT_2F position = mMainCamera.GetPosition();
@@ -2653,7 +2567,75 @@ bool MainScene::Update(const float deltaTime)
 		mMainCamera.SetPosition(position);
 	}
 
-	return mIsUpdate;
+	endPhase(eMainScene_Phase::Camera);
+}
+
+void MainScene::updateLabels()
+{
+	// ڰ  Label ̾ƿ ٽ  Ƿ ƽ .
+	mHpValueLabel.Format(L"Hp: ", mHero.hp, L" / ", HERO_MAX_HP);
+	mDashValueLabel.Format(L"Dash: ", mDash.count, L" / ", DASH_MAX_COUNT);
+	mBulletLabel.Format(mBulletValue, L"/", mBulletMaxValue);
+	mKillAllMonsterLabel.Format(L"F: ", mKillMonsterCount, L" / ", KILL_ALL_MONSTER_COUNT);
+
+	const uint32_t seconds = uint32_t(mGameTimer) % 60;
+	const uint32_t minutes = uint32_t(mGameTimer) / 60;
+	mTimerLabel.Format(L"Timer: ", minutes, L":", seconds);
+
+	// ų  Ȱ Ÿ ȿ Ű   ð ǥѴ.
+	const bool bShieldActive = mShield.state != eShield_State::End;
+	mShieldKeyLabel.SetActive(not bShieldActive);
+	mShieldLabel.SetActive(bShieldActive);
+
+	if (bShieldActive)
+	{
+		const uint32_t shieldSeconds = uint32_t(mShield.labelCoolTimer) % 60;
+		mShieldLabel.Format(uint32_t(2.0f + SHIELD_SKILL_DURATION + SHIELD_COOL_TIME) - shieldSeconds);
+	}
+
+	const bool bOrbitActive = mOrbit.state != eOrbit_State::End;
+	mOrbitKeyLabel.SetActive(not bOrbitActive);
+	mOrbitLabel.SetActive(bOrbitActive);
+
+	if (bOrbitActive)
+	{
+		const uint32_t orbitSeconds = uint32_t(mOrbit.labelCoolTimer) % 60;
+		mOrbitLabel.Format(uint32_t(ORBIT_ROTATE_TIME + ORBIT_COOL_TIME) - orbitSeconds);
+	}
+}
+
+void MainScene::updateSounds()
+{
+	if (mIsHeadless)
+	{
+		return;
+	}
+
+	// ̺Ʈ   带 Ÿӿ ų   .
+	if (mHero.hp <= 0)
+	{
+		mBackgroundSound.Pause();
+		mDashSound.Pause();
+		mBulletSound.Pause();
+		mReloadSound.Pause();
+		mBigMonsterDeadSound.Pause();
+		mRunMonsterDeadSound.Pause();
+		mSlowMonsterDeadSound.Pause();
+		mShieldSound.Pause();
+		mOrbitSound.Pause();
+
+		return;
+	}
+
+	if (mShield.state == eShield_State::CoolTime)
+	{
+		mShieldSound.Pause();
+	}
+
+	if (mOrbit.state == eOrbit_State::CoolTime)
+	{
+		mOrbitSound.Pause();
+	}
 }
 
 void MainScene::PostDraw(const D2D1::Matrix3x2F& view, const D2D1::Matrix3x2F& viewForUI)
@@ -2852,78 +2834,512 @@ void MainScene::PostDraw(const D2D1::Matrix3x2F& view, const D2D1::Matrix3x2F& v
 		);
 		renderTarget->SetTransform(worldView);
 
-		const D2D1_ELLIPSE ellipse{ .radiusX = 25.0f, .radiusY = 25.0f };
-		renderTarget->DrawEllipse(ellipse, mYellowBrush, 5.0f);
+		const D2D1_ELLIPSE ellipse{ .radiusX = 25.0f, .radiusY = 25.0f };
+		renderTarget->DrawEllipse(ellipse, mYellowBrush, 5.0f);
+	}
+
+	//  ų UI ׸.
+	{
+		const Matrix3x2F worldView = Transformation::getWorldMatrix
+		(
+			{
+				.x = float(Constant::Get().GetWidth()) * 0.5f + 590.0f,
+				.y = 62.0f
+			}
+		);
+		renderTarget->SetTransform(worldView);
+
+		const D2D1_ELLIPSE ellipse{ .radiusX = 25.0f, .radiusY = 25.0f };
+		renderTarget->DrawEllipse(ellipse, mOrange, 5.0f);
+	}
+}
+
+void MainScene::Finalize()
+{
+	RELEASE_D2D1(mCyanBrush);
+	RELEASE_D2D1(mYellowBrush);
+	RELEASE_D2D1(mCyanBrush);
+	RELEASE_D2D1(mDarkGreen);
+	RELEASE_D2D1(mDefaultBrush);
+
+	mHotReload.Finalize();
+
+	mRectangleTexture.Finalize();
+	mRedRectangleTexture.Finalize();
+	mYellowRectangleTexture.Finalize();
+	mSkyBlueRectangleTexture.Finalize();
+	mBlueRectangleTexture.Finalize();
+	mPinkRectangleTexture.Finalize();
+	mPurpleRectangleTexture.Finalize();
+	mBlackRectangleTexture.Finalize();
+
+	mCircleTexture.Finalize();
+	mRedCircleTexture.Finalize();
+
+	mWhiteBarTexture.Finalize();
+	mRedBarTexture.Finalize();
+	mYellowBarTexture.Finalize();
+
+	mRedStarTexture.Finalize();
+	mOrangeStarTexture.Finalize();
+	mYellowStarTexture.Finalize();
+	mGreenStarTexture.Finalize();
+	mBlueStarTexture.Finalize();
+	mPurpleStarTexture.Finalize();
+
+	mExitIdleButtonTexture.Finalize();
+	mExitContactButtonTexture.Finalize();
+
+	mNetServer.Finalize();
+
+	// Sound
+	mAudioEvents.Clear();
+	mBackgroundSound.Finalize();
+
+	mHeroHitSound.Finalize();
+	mDashSound.Finalize();
+
+	mBulletSound.Finalize();
+	mReloadSound.Finalize();
+
+	mShieldSound.Finalize();
+	mOrbitSound.Finalize();
+
+	mBigMonsterDeadSound.Finalize();
+	mRunMonsterDeadSound.Finalize();
+	mSlowMonsterDeadSound.Finalize();
+
+	mButtonSound.Finalize();
+	mGameOverSound.Finalize();
+}
+
+void MainScene::SaveSnapshot(SnapshotWriter* writer) const
+{
+	writer->Begin(SNAPSHOT_VERSION, this);
+
+	writer->Write(mRandom);
+	writer->Write(mIsUpdate);
+
+	// 
+	writer->Write(mHeroAcc);
+	writer->Write(mBoundaryRadius);
+	writer->Write(mBigMonsterSpawnTime);
+	writer->Write(mRunMonsterSpawnTime);
+	writer->Write(mSlowMonsterSpawnTime);
+	writer->Write(mBulletMaxValue);
+
+	writer->Write(mShotCount);
+	writer->Write(mIsExitRequested);
+
+	// ī޶
+	writer->Write(mMainCamera);
+	writer->Write(mCameraShakeTime);
+	writer->Write(mCameraShakeTimer);
+	writer->Write(mCameraShakeAmplitude);
+	writer->Write(mCameraShakeDuration);
+	writer->Write(mCameraShakeFrequency);
+
+	// ÷̾
+	writer->Write(mHero);
+	writer->Write(mPreviousMoveX);
+	writer->Write(mPreviousMoveY);
+	writer->Write(mZoom);
+	writer->Write(mDash);
+	writer->Write(mDashDirection);
+	writer->WriteArray(mBullets.data(), uint32_t(mBullets.size()));
+	writer->Write(mBulletShootingCoolTimer);
+	writer->Write(mBulletValue);
+	writer->Write(misKeyDownReload);
+	writer->Write(mreloadKeyDownCoolTimer);
+	writer->Write(mreloadCoolTimer);
+	writer->WriteArray(mCasings.data(), uint32_t(mCasings.size()));
+	writer->Write(mShield);
+	writer->Write(mOrbit);
+	writer->Write(mIsKillAllMonster);
+	writer->Write(mKillMonsterCount);
+
+	// UI
+	writer->Write(mUiKillBackgroundBar);
+	writer->Write(mUiKillCountBar);
+	writer->Write(mUiDashBar);
+	writer->Write(mUiBackgroundDashBar);
+	writer->Write(mUiHpBar);
+	writer->Write(mUiBackgroundHpBar);
+	writer->Write(mGameTimer);
+	writer->Write(mGameOverBackground);
+	writer->Write(mGameOver);
+	writer->Write(mGameOverTimer);
+	writer->Write(mIsGameOver);
+	writer->Write(mResumeButton);
+	writer->Write(mIsResumeButtonColliding);
+	writer->Write(mIsResumeButtonSoundPlay);
+	writer->Write(mExitButton);
+	writer->Write(mIsExitButtonColliding);
+	writer->Write(mIsExitButtonSoundPlay);
+
+	// 
+	writer->WriteArray(mBigMonsters.data(), uint32_t(mBigMonsters.size()));
+	writer->Write(mBigMonsterSpawnTimer);
+	writer->WriteArray(mRunMonsters.data(), uint32_t(mRunMonsters.size()));
+	writer->Write(mRunMonsterSpawnTimer);
+	writer->WriteArray(mSlowMonsters.data(), uint32_t(mSlowMonsters.size()));
+	writer->Write(mSlowMonsterSpawnTimer);
+	writer->Write(mTargetMonster);
+	writer->Write(mTargetBullet);
+
+	//  ͸ ̴ ų  ƽ   ε Ƿ ε  ġ ´.
+	const uint32_t gridMonsterCount = uint32_t(mGridMonsters.size());
+	writer->Write(gridMonsterCount);
+	writer->WriteArray(mGridMonsters.data(), gridMonsterCount);
+	writer->WriteArray(mGridPositions.data(), gridMonsterCount);
+	writer->WriteArray(mGridRadii.data(), gridMonsterCount);
+	writer->Write(mGridSlowBegin);
+	writer->Write(mMaxGridRadius);
+
+	// Ʈ
+	writer->WriteArray(mLongEffect.data(), uint32_t(mLongEffect.size()));
+	writer->WriteArray(mLongEffectTimer.data(), uint32_t(mLongEffectTimer.size()));
+	writer->WriteArray(mCyanEffect.data(), uint32_t(mCyanEffect.size()));
+	writer->WriteArray(mGreenEffect.data(), uint32_t(mGreenEffect.size()));
+	mEntityWorld.Save(writer);
+
+	writer->End();
+}
+
+bool MainScene::LoadSnapshot(const uint8_t* data, const size_t size)
+{
+	SnapshotReader reader;
+
+	if (not reader.Begin(data, size, SNAPSHOT_VERSION, this))
+	{
+		return false;
+	}
+
+	reader.Read(&mRandom);
+	reader.Read(&mIsUpdate);
+
+	// 
+	const float prevBoundaryRadius = mBoundaryRadius;
+	reader.Read(&mHeroAcc);
+	reader.Read(&mBoundaryRadius);
+	reader.Read(&mBigMonsterSpawnTime);
+	reader.Read(&mRunMonsterSpawnTime);
+	reader.Read(&mSlowMonsterSpawnTime);
+	reader.Read(&mBulletMaxValue);
+
+	reader.Read(&mShotCount);
+	reader.Read(&mIsExitRequested);
+
+	// ī޶
+	reader.Read(&mMainCamera);
+	reader.Read(&mCameraShakeTime);
+	reader.Read(&mCameraShakeTimer);
+	reader.Read(&mCameraShakeAmplitude);
+	reader.Read(&mCameraShakeDuration);
+	reader.Read(&mCameraShakeFrequency);
+
+	// ÷̾
+	reader.Read(&mHero);
+	reader.Read(&mPreviousMoveX);
+	reader.Read(&mPreviousMoveY);
+	reader.Read(&mZoom);
+	reader.Read(&mDash);
+	reader.Read(&mDashDirection);
+	reader.ReadArray(mBullets.data(), uint32_t(mBullets.size()));
+	reader.Read(&mBulletShootingCoolTimer);
+	reader.Read(&mBulletValue);
+	reader.Read(&misKeyDownReload);
+	reader.Read(&mreloadKeyDownCoolTimer);
+	reader.Read(&mreloadCoolTimer);
+	reader.ReadArray(mCasings.data(), uint32_t(mCasings.size()));
+	reader.Read(&mShield);
+	reader.Read(&mOrbit);
+	reader.Read(&mIsKillAllMonster);
+	reader.Read(&mKillMonsterCount);
+
+	// UI
+	reader.Read(&mUiKillBackgroundBar);
+	reader.Read(&mUiKillCountBar);
+	reader.Read(&mUiDashBar);
+	reader.Read(&mUiBackgroundDashBar);
+	reader.Read(&mUiHpBar);
+	reader.Read(&mUiBackgroundHpBar);
+	reader.Read(&mGameTimer);
+	reader.Read(&mGameOverBackground);
+	reader.Read(&mGameOver);
+	reader.Read(&mGameOverTimer);
+	reader.Read(&mIsGameOver);
+	reader.Read(&mResumeButton);
+	reader.Read(&mIsResumeButtonColliding);
+	reader.Read(&mIsResumeButtonSoundPlay);
+	reader.Read(&mExitButton);
+	reader.Read(&mIsExitButtonColliding);
+	reader.Read(&mIsExitButtonSoundPlay);
+
+	// 
+	reader.ReadArray(mBigMonsters.data(), uint32_t(mBigMonsters.size()));
+	reader.Read(&mBigMonsterSpawnTimer);
+	reader.ReadArray(mRunMonsters.data(), uint32_t(mRunMonsters.size()));
+	reader.Read(&mRunMonsterSpawnTimer);
+	reader.ReadArray(mSlowMonsters.data(), uint32_t(mSlowMonsters.size()));
+	reader.Read(&mSlowMonsterSpawnTimer);
+	reader.Read(&mTargetMonster);
+	reader.Read(&mTargetBullet);
+
+	uint32_t gridMonsterCount = 0;
+	reader.Read(&gridMonsterCount);
+	mGridMonsters.resize(gridMonsterCount);
+	mGridPositions.resize(gridMonsterCount);
+	mGridRadii.resize(gridMonsterCount);
+	reader.ReadArray(mGridMonsters.data(), gridMonsterCount);
+	reader.ReadArray(mGridPositions.data(), gridMonsterCount);
+	reader.ReadArray(mGridRadii.data(), gridMonsterCount);
+	reader.Read(&mGridSlowBegin);
+	reader.Read(&mMaxGridRadius);
+
+	// Ʈ
+	reader.ReadArray(mLongEffect.data(), uint32_t(mLongEffect.size()));
+	reader.ReadArray(mLongEffectTimer.data(), uint32_t(mLongEffectTimer.size()));
+	reader.ReadArray(mCyanEffect.data(), uint32_t(mCyanEffect.size()));
+	reader.ReadArray(mGreenEffect.data(), uint32_t(mGreenEffect.size()));
+	mEntityWorld.Load(&reader);
+
+	reader.End();
+
+	if (mBoundaryRadius != prevBoundaryRadius)
+	{
+		initializeBoundary();
+	}
+
+	//   Update ¸  ٽ . ڽ Ʈ ġ  ε .
+	mSpriteHierarchy.SyncWorldPositions();
+	mMonsterGrid.Build(mGridPositions.data(), gridMonsterCount);
+
+	return true;
+}
+
+bool MainScene::Rollback(const uint32_t tickCount)
+{
+	ASSERT(mIsRollbackEnabled);
+
+	const uint32_t count = min(tickCount, mRollbackBuffer.GetCount());
+
+	if (count == 0)
+	{
+		return true;
+	}
+
+	SaveSnapshot(&mRollbackBeforeSnapshot);
+
+	const SnapshotWriter* snapshot = mRollbackBuffer.GetSnapshot(count - 1);
+	const bool bLoaded = LoadSnapshot(snapshot->GetData(), snapshot->GetSize());
+	ASSERT(bLoaded);
+
+	// Core  Ʈ ڿ ϴ ϱ ƽ Ȱ Ѵ.
+	for (uint32_t framesAgo = count - 1; ; --framesAgo)
+	{
+		simulate(mRollbackBuffer.GetInput(framesAgo), mRollbackBuffer.GetDeltaTime(framesAgo));
+		mEntityWorld.FlushCommands();
+		mSpriteHierarchy.Update();
+
+		if (framesAgo == 0)
+		{
+			break;
+		}
+
+		SaveSnapshot(mRollbackBuffer.GetSnapshot(framesAgo - 1));
+	}
+
+	// ǰ ƽ  ̹ ߴ.
+	mAudioEvents.DropPending();
+
+	SaveSnapshot(&mRollbackAfterSnapshot);
+
+	const bool bSame = mRollbackBeforeSnapshot.GetSize() == mRollbackAfterSnapshot.GetSize()
+		and memcmp(mRollbackBeforeSnapshot.GetData(), mRollbackAfterSnapshot.GetData(), mRollbackAfterSnapshot.GetSize()) == 0;
+
+	return bSame;
+}
+
+void MainScene::updateNetServer()
+{
+	mNetServer.ReceivePackets();
+
+	if (mNetServer.GetClientCount() > 0)
+	{
+		++mNetTick;
+		CaptureNetState(&mNetState);
+		mNetServer.EncodeSnapshot(mNetState);
+	}
+
+	mNetServer.SendPackets(std::chrono::steady_clock::now());
+}
+
+uint32_t MainScene::GetNetSlotCount() const
+{
+	return uint32_t(1 + mBullets.size() + mBigMonsters.size() + mRunMonsters.size() + mSlowMonsters.size());
+}
+
+void MainScene::CaptureNetState(NetWorldState* outState) const
+{
+	outState->tick = mNetTick;
+
+	NetEntityState* slot = outState->entities.data();
+
+	*slot++ = MakeNetEntityState(mHero.sprite.IsActive(), mHero.sprite.GetPosition(), mHero.hp, uint8_t(mDash.count));
+
+	for (const Bullet& bullet : mBullets)
+	{
+		*slot++ = MakeNetEntityState(bullet.sprite.IsActive(), bullet.sprite.GetPosition(), 0, 0);
+	}
+
+	for (const Monster& monster : mBigMonsters)
+	{
+		*slot++ = MakeNetEntityState(monster.sprite.IsActive(), monster.sprite.GetPosition(), monster.hp, uint8_t(monster.state));
+	}
+
+	for (const RunMonster& runMonster : mRunMonsters)
+	{
+		*slot++ = MakeNetEntityState(runMonster.monster.sprite.IsActive(), runMonster.monster.sprite.GetPosition(), runMonster.monster.hp, uint8_t(runMonster.monster.state));
+	}
+
+	for (const SlowMonster& slowMonster : mSlowMonsters)
+	{
+		*slot++ = MakeNetEntityState(slowMonster.monster.sprite.IsActive(), slowMonster.monster.sprite.GetPosition(), slowMonster.monster.hp, uint8_t(slowMonster.monster.state));
+	}
+
+	ASSERT(slot == outState->entities.data() + outState->entities.size());
+}
+
+uint32_t MainScene::GetActiveMonsterCount() const
+{
+	uint32_t count = 0;
+
+	for (const Monster& monster : mBigMonsters)
+	{
+		count += monster.sprite.IsActive() ? 1 : 0;
+	}
+
+	for (const RunMonster& runMonster : mRunMonsters)
+	{
+		count += runMonster.monster.sprite.IsActive() ? 1 : 0;
+	}
+
+	for (const SlowMonster& slowMonster : mSlowMonsters)
+	{
+		count += slowMonster.monster.sprite.IsActive() ? 1 : 0;
+	}
+
+	return count;
+}
+
+uint32_t MainScene::GetActiveBulletCount() const
+{
+	uint32_t count = 0;
+
+	for (const Bullet& bullet : mBullets)
+	{
+		count += bullet.sprite.IsActive() ? 1 : 0;
 	}
 
-	//  ų UI ׸.
-	{
-		const Matrix3x2F worldView = Transformation::getWorldMatrix
-		(
-			{
-				.x = float(Constant::Get().GetWidth()) * 0.5f + 590.0f,
-				.y = 62.0f
-			}
-		);
-		renderTarget->SetTransform(worldView);
+	return count;
+}
 
-		const D2D1_ELLIPSE ellipse{ .radiusX = 25.0f, .radiusY = 25.0f };
-		renderTarget->DrawEllipse(ellipse, mOrange, 5.0f);
-	}
+void MainScene::SetPhaseSeconds(double* phaseSeconds)
+{
+	mPhaseSeconds = phaseSeconds;
 }
 
-void MainScene::Finalize()
+void MainScene::readTunables()
 {
-	RELEASE_D2D1(mCyanBrush);
-	RELEASE_D2D1(mYellowBrush);
-	RELEASE_D2D1(mCyanBrush);
-	RELEASE_D2D1(mDarkGreen);
-	RELEASE_D2D1(mDefaultBrush);
+	const Tunables& tunables = mHotReload.GetTunables();
+	mTunablesVersion = tunables.GetVersion();
 
-	mRectangleTexture.Finalize();
-	mRedRectangleTexture.Finalize();
-	mYellowRectangleTexture.Finalize();
-	mSkyBlueRectangleTexture.Finalize();
-	mBlueRectangleTexture.Finalize();
-	mPinkRectangleTexture.Finalize();
-	mPurpleRectangleTexture.Finalize();
-	mBlackRectangleTexture.Finalize();
+	// Ͱ  ٿ   ƴ .
+	const float minBoundaryRadius = IN_BOUNDARY_RADIUS + 2.0f * BIG_MONSTER_SCALE * mRectangleTexture.GetHeight();
 
-	mCircleTexture.Finalize();
-	mRedCircleTexture.Finalize();
+	// Ѿ Ǯ ״ ΰ   ä  ٲ۴.
+	const int32_t bulletPoolSize = int32_t(mBullets.size());
+	const int32_t bulletMaxValue = std::clamp(int32_t(tunables.GetFloat("BULLET_COUNT", float(bulletPoolSize))), 1, bulletPoolSize);
 
-	mWhiteBarTexture.Finalize();
-	mRedBarTexture.Finalize();
-	mYellowBarTexture.Finalize();
+	mTunables =
+	{
+		.heroAcc = tunables.GetFloat("ACC", ACC),
+		.boundaryRadius = max(tunables.GetFloat("BOUNDARY_RADIUS", BOUNDARY_RADIUS), minBoundaryRadius),
+		.bigMonsterSpawnTime = tunables.GetFloat("BIG_MONSTER_SPAWN_TIME", BIG_MONSTER_SPAWN_TIME),
+		.runMonsterSpawnTime = tunables.GetFloat("RUN_MONSTER_SPAWN_TIME", RUN_MONSTER_SPAWN_TIME),
+		.slowMonsterSpawnTime = tunables.GetFloat("SLOW_MONSTER_SPAWN_TIME", SLOW_MONSTER_SPAWN_TIME),
+		.bulletMaxValue = bulletMaxValue
+	};
+}
 
-	mRedStarTexture.Finalize();
-	mOrangeStarTexture.Finalize();
-	mYellowStarTexture.Finalize();
-	mGreenStarTexture.Finalize();
-	mBlueStarTexture.Finalize();
-	mPurpleStarTexture.Finalize();
+void MainScene::applyTunables(const SimulationTunables& tunables)
+{
+	mHeroAcc = tunables.heroAcc;
 
-	mExitIdleButtonTexture.Finalize();
-	mExitContactButtonTexture.Finalize();
+	mBigMonsterSpawnTime = tunables.bigMonsterSpawnTime;
+	mRunMonsterSpawnTime = tunables.runMonsterSpawnTime;
+	mSlowMonsterSpawnTime = tunables.slowMonsterSpawnTime;
 
-	// Sound
-	mBackgroundSound.Finalize();
+	if (tunables.bulletMaxValue != mBulletMaxValue)
+	{
+		mBulletMaxValue = tunables.bulletMaxValue;
+		mBulletValue = min(mBulletValue, mBulletMaxValue);
+	}
 
-	mHeroHitSound.Finalize();
-	mDashSound.Finalize();
+	// ٿ  ڴ ƽ ٽ äų ǥ ٲ ٽ Ƿ ũ⸸ ٲ㵵 ȴ.
+	if (tunables.boundaryRadius != mBoundaryRadius)
+	{
+		mBoundaryRadius = tunables.boundaryRadius;
+		initializeBoundary();
+	}
+}
 
-	mBulletSound.Finalize();
-	mReloadSound.Finalize();
+void MainScene::initializeBoundary()
+{
+	// Ͱ  ٿ   ư  ũ⸸ŭ  д.
+	const float margin = BIG_MONSTER_SCALE * mRectangleTexture.GetHeight();
 
-	mShieldSound.Finalize();
-	mOrbitSound.Finalize();
+	mFlowField.Initialize
+	(
+		{
+			.center = {},
+			.innerRadius = IN_BOUNDARY_RADIUS + margin,
+			.outerRadius = mBoundaryRadius,
+			.cellSize = FLOW_FIELD_CELL_SIZE
+		}
+	);
 
-	mBigMonsterDeadSound.Finalize();
-	mRunMonsterDeadSound.Finalize();
-	mSlowMonsterDeadSound.Finalize();
+	mMonsterGrid.Initialize
+	(
+		{
+			.center = {},
+			.halfExtent = mBoundaryRadius,
+			.cellSize = MONSTER_GRID_CELL_SIZE
+		}
+	);
 
-	mButtonSound.Finalize();
-	mGameOverSound.Finalize();
+	mCollisionWorld.Initialize
+	(
+		{
+			.center = {},
+			.halfExtent = mBoundaryRadius,
+			.cellSize = COLLISION_CELL_SIZE
+		}
+	);
+}
+
+void MainScene::endPhase(const eMainScene_Phase phase)
+{
+	if (mPhaseSeconds == nullptr)
+	{
+		return;
+	}
+
+	//  ܰ谡      Ѵ.
+	const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	mPhaseSeconds[uint32_t(phase)] += std::chrono::duration<double>(now - mPhaseStartTime).count();
+	mPhaseStartTime = now;
 }
 
 D2D1_RECT_F MainScene::getRectangleFromSprite(const Sprite& sprite)
@@ -2988,16 +3404,27 @@ D2D1_ELLIPSE MainScene::getCircleFromSprite(const Sprite& sprite)
 	return circle;
 }
 
-float MainScene::getRandom(const float min, const float max)
+D2D1_SIZE_F MainScene::getHalfSizeFromRectangle(const D2D1_RECT_F& rect)
 {
-	const float result = float(rand()) / RAND_MAX * (max - min) + min;
+	const D2D1_SIZE_F result =
+	{
+		.width = (rect.right - rect.left) * 0.5f,
+		.height = (rect.top - rect.bottom) * 0.5f
+	};
+
 	return result;
 }
 
+float MainScene::getRandom(const float min, const float max)
+{
+	std::uniform_real_distribution<float> distribution(min, max);
+	return distribution(mRandom);
+}
+
 uint32_t MainScene::getRandom(const uint32_t min, const uint32_t max)
 {
-	const uint32_t result = rand() % (max - min + 1) + min;
-	return result;
+	std::uniform_int_distribution<uint32_t> distribution(min, max);
+	return distribution(mRandom);
 }
 
 D2D1_POINT_2F MainScene::getMouseWorldPosition() const
@@ -3077,16 +3504,17 @@ void MainScene::spawnMonster(const MonsterSpawnDesc& desc)
 			.y = sin(angle)
 		};
 
-		const float SPAWN_DISTANCE = BOUNDARY_RADIUS - 30.0f;
+		const float SPAWN_DISTANCE = mBoundaryRadius - 30.0f;
 		const D2D1_POINT_2F spawnPosition = Math::ScaleVector(spawnDirection, SPAWN_DISTANCE);
 
 		Sprite& sprite = monster->sprite;
 		sprite.SetPosition(spawnPosition);
+		monster->prevPosition = spawnPosition;
 		sprite.SetScale(scale);
 		sprite.SetActive(true);
 	}
 
-	// ʱ HpBar Ѵ.
+	// ʱ HpBar Ѵ. ü¹ٴ  ڽ̹Ƿ Ϳ  ġ Ѵ.
 	{
 		const D2D1_POINT_2F offset = getHpBarOffset(monster->sprite, hpBarOffset);
 		monster->backgroundHpBar.SetPosition(offset);
@@ -3171,8 +3599,8 @@ D2D1_POINT_2F MainScene::getHpBarOffset(const Sprite& sprite, const D2D1_POINT_2
 
 	const D2D1_POINT_2F result =
 	{
-		.x = sprite.GetPosition().x - scaleOffset.width + offset.x,
-		.y = sprite.GetPosition().y - scaleOffset.height + offset.y
+		.x = -scaleOffset.width + offset.x,
+		.y = -scaleOffset.height + offset.y
 	};
 
 	return result;
@@ -3215,67 +3643,88 @@ void MainScene::deadMonsterEffect(const MonsterDeadSoundDesc& desc)
 	}
 }
 
-void MainScene::spawnParticle(Particle* particles, uint32_t size, Monster* monster, uint32_t spawnCount)
+void MainScene::spawnParticle(const ComponentMask kindMask, Monster* monster, uint32_t spawnCount)
 {
 	ASSERT(monster != nullptr);
+	ASSERT(spawnCount <= PARTICLE_PER);
 
-	for (uint32_t i = 0; i < size; ++i)
-	{
-		Particle& particle = particles[i];
+	// ƼŬ Ǯ Ű ŭ     Ҵ.
+	spawnCount *= mPoolScale.particle;
 
-		if (particle.sprite.IsActive())
-		{
-			continue;
-		}
+	// ûũ  ̹ ӿ Ƿ  ũġ ´.
+	FrameVector<EntityChunkView> chunks(FrameAllocator::Get().GetMemoryResource());
+	chunks.reserve(4);
+
+	mEntityWorld.Query({ .include = kindMask | EntityWorld::GetMask<DisabledTag>(), .exclude = 0 }, &chunks);
+
+	// ûũ ȴ ȿ  ٲ  Ƿ  ƼŬ  ξٰ Ѳ Ҵ.
+	mSpawnedParticles.clear();
 
-		// ǥ Ѵ.
+	for (const EntityChunkView& chunk : chunks)
+	{
+		const Entity* entities = chunk.GetEntities();
+		TransformComponent* transforms = chunk.GetComponents<TransformComponent>();
+		SpriteComponent* sprites = chunk.GetComponents<SpriteComponent>();
+		ParticleComponent* particles = chunk.GetComponents<ParticleComponent>();
+
+		for (uint32_t i = 0; i < chunk.GetCount() and mSpawnedParticles.size() < spawnCount; ++i)
 		{
-			D2D1_POINT_2F& direction = particle.direction;
+			// ǥ Ѵ.
+			D2D1_POINT_2F& direction = particles[i].direction;
 			D2D1_POINT_2F spawnPosition = monster->sprite.GetPosition();
 
 			direction = Math::SubtractVector(spawnPosition, mHero.sprite.GetPosition());
 			direction = Math::NormalizeVector(direction);
 			direction = Math::RotateVector(direction, getRandom(-60.0f, 60.0));
 
-			Sprite& sprite = particle.sprite;
-			sprite.SetPosition(spawnPosition);
-			sprite.SetActive(true);
-			sprite.SetOpacity(1.0f);
-		}
-
-		--spawnCount;
+			transforms[i].position = spawnPosition;
+			sprites[i].opacity = 1.0f;
 
-		if (spawnCount <= 0)
-		{
-			break;
+			mSpawnedParticles.push_back(entities[i]);
 		}
 	}
+
+	for (const Entity entity : mSpawnedParticles)
+	{
+		mEntityWorld.Remove<DisabledTag>(entity);
+	}
 }
 
-void MainScene::updateParticle(Particle* particles, const uint32_t size, const float deltaTime)
+void MainScene::updateParticle(const float deltaTime)
 {
-	for (uint32_t i = 0; i < size; ++i)
+	FrameVector<EntityChunkView> chunks(FrameAllocator::Get().GetMemoryResource());
+	chunks.reserve(4);
+
+	mEntityWorld.Query
+	(
+		{
+			.include = EntityWorld::GetMask<TransformComponent, SpriteComponent, ParticleComponent>(),
+			.exclude = EntityWorld::GetMask<DisabledTag>()
+		},
+		&chunks
+	);
+
+	for (const EntityChunkView& chunk : chunks)
 	{
-		Particle& particle = particles[i];
-		Sprite& sprite = particle.sprite;
+		const Entity* entities = chunk.GetEntities();
+		TransformComponent* transforms = chunk.GetComponents<TransformComponent>();
+		SpriteComponent* sprites = chunk.GetComponents<SpriteComponent>();
+		const ParticleComponent* particles = chunk.GetComponents<ParticleComponent>();
 
-		if (not sprite.IsActive())
+		for (uint32_t i = 0; i < chunk.GetCount(); ++i)
 		{
-			continue;
-		}
+			const ParticleComponent& particle = particles[i];
 
-		D2D1_POINT_2F poisition = sprite.GetPosition();
-		poisition = Math::AddVector(poisition,
-			Math::ScaleVector(particle.direction, particle.speed * deltaTime));
-		sprite.SetPosition(poisition);
+			transforms[i].position = Math::AddVector(transforms[i].position,
+				Math::ScaleVector(particle.direction, particle.speed * deltaTime));
 
-		float opacity = sprite.GetOpacity();
-		opacity -= 1.0f * deltaTime;
-		sprite.SetOpacity(opacity);
+			sprites[i].opacity -= 1.0f * deltaTime;
 
-		if (opacity <= 0.0f)
-		{
-			sprite.SetActive(false);
+			//   ƼŬ Core  Ʈ  .
+			if (sprites[i].opacity <= 0.0f)
+			{
+				mEntityWorld.DeferAdd(entities[i], DisabledTag{});
+			}
 		}
 	}
 }
@@ -3357,6 +3806,9 @@ void MainScene::initializeMonster(const MonsterInitDesc& desc)
 	hpBar.SetActive(false);
 	hpBar.SetTexture(&mRedBarTexture);
 	mSpriteLayers[uint32_t(Layer::Monster)].push_back(&hpBar);
+
+	mSpriteHierarchy.Attach(&hpBackground, &sprite);
+	mSpriteHierarchy.Attach(&hpBar, &sprite);
 }
 
 void MainScene::spawnLongEffect(Sprite* sprites, const uint32_t size, Texture* texture, const Monster& monster)
@@ -3490,7 +3942,7 @@ void MainScene::updateButtonState(const ButtonDesc& desc)
 
 		if (not *isSoundPlay)
 		{
-			mButtonSound.Replay();
+			mAudioEvents.Trigger(mButtonSoundEvent);
 			*isSoundPlay = true;
 		}
 	}
@@ -3500,3 +3952,329 @@ void MainScene::updateButtonState(const ButtonDesc& desc)
 		sprite->SetTexture(originalTexture);
 	}
 }
+
+void MainScene::addGridMonster(Monster* monster)
+{
+	if (not monster->sprite.IsActive())
+	{
+		return;
+	}
+
+	const D2D1_ELLIPSE circle = getCircleFromSprite(monster->sprite);
+
+	mGridMonsters.push_back(monster);
+	mGridPositions.push_back(circle.point);
+	mGridRadii.push_back(circle.radiusX);
+
+	mMaxGridRadius = max(mMaxGridRadius, circle.radiusX);
+}
+
+void MainScene::buildMonsterGrid()
+{
+	mGridMonsters.clear();
+	mGridPositions.clear();
+	mGridRadii.clear();
+	mMaxGridRadius = 0.0f;
+
+	// Ȱȭ ͸ ū, ,    .
+	for (Monster& monster : mBigMonsters)
+	{
+		addGridMonster(&monster);
+	}
+
+	for (RunMonster& run : mRunMonsters)
+	{
+		addGridMonster(&run.monster);
+	}
+
+	mGridSlowBegin = uint32_t(mGridMonsters.size());
+
+	for (SlowMonster& slow : mSlowMonsters)
+	{
+		addGridMonster(&slow.monster);
+	}
+
+	mMonsterGrid.Build(mGridPositions.data(), uint32_t(mGridMonsters.size()));
+}
+
+void MainScene::separateMonsters(const float deltaTime)
+{
+	const uint32_t count = uint32_t(mGridMonsters.size());
+
+	//   о       Ѵ.
+	//   ʹ   ٸ ͸ о.
+	mSeparationOffsets.assign(count, D2D1_POINT_2F{});
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		if (mGridMonsters[i]->state != eMonster_State::Life)
+		{
+			continue;
+		}
+
+		const D2D1_POINT_2F position = mGridPositions[i];
+		const float radius = mGridRadii[i];
+
+		mMonsterGrid.QueryCircle(position, radius + mMaxGridRadius, &mNeighborIndices);
+
+		D2D1_POINT_2F push{};
+
+		for (const uint32_t j : mNeighborIndices)
+		{
+			if (j == i)
+			{
+				continue;
+			}
+
+			const float minDistance = radius + mGridRadii[j];
+			const D2D1_POINT_2F away = Math::SubtractVector(position, mGridPositions[j]);
+			const float distanceSquared = Math::DotProduct2D(away, away);
+
+			if (distanceSquared >= minDistance * minDistance)
+			{
+				continue;
+			}
+
+			//  ģ 쿡 ε   Ѵ.
+			if (distanceSquared <= FLT_EPSILON)
+			{
+				push.x += (i < j) ? -1.0f : 1.0f;
+				continue;
+			}
+
+			//  ĥ  о.
+			const float weight = 1.0f - distanceSquared / (minDistance * minDistance);
+			push = Math::AddVector(push, Math::ScaleVector(away, weight / minDistance));
+		}
+
+		if (Math::DotProduct2D(push, push) > 1.0f)
+		{
+			push = Math::NormalizeVector(push);
+		}
+
+		mSeparationOffsets[i] = Math::ScaleVector(push, SEPARATION_SPEED * deltaTime);
+	}
+
+	//   ͸ ű. ü¹ٴ  ڽ̶ Բ δ.
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		Monster* monster = mGridMonsters[i];
+		const D2D1_POINT_2F offset = mSeparationOffsets[i];
+
+		mGridPositions[i] = Math::AddVector(mGridPositions[i], offset);
+
+		monster->sprite.SetPosition(mGridPositions[i]);
+	}
+
+	//  ʹ   ε Բ ű.
+	uint32_t slowIndex = mGridSlowBegin;
+
+	for (SlowMonster& slow : mSlowMonsters)
+	{
+		if (not slow.monster.sprite.IsActive())
+		{
+			continue;
+		}
+
+		const D2D1_POINT_2F offset = mSeparationOffsets[slowIndex];
+		slow.startPosition = Math::AddVector(slow.startPosition, offset);
+		slow.endPosition = Math::AddVector(slow.endPosition, offset);
+
+		++slowIndex;
+	}
+
+	// о ġ ε ٽ .  ͸ ̴ ų Ѵ.
+	mMonsterGrid.Build(mGridPositions.data(), count);
+}
+
+void MainScene::addMonsterCollider(Monster* monster, const uint32_t mask)
+{
+	if (monster->state != eMonster_State::Life or not monster->sprite.IsActive())
+	{
+		return;
+	}
+
+	mCollisionWorld.AddCollider
+	(
+		{
+			.shape = eCollider_Shape::Rect,
+			.layer = MONSTER_LAYER,
+			.mask = mask,
+			.prevPosition = monster->prevPosition,
+			.position = monster->sprite.GetPosition(),
+			.halfSize = getHalfSizeFromRectangle(getRectangleFromSprite(monster->sprite)),
+			.userData = monster
+		}
+	);
+}
+
+void MainScene::addColliders()
+{
+	mCollisionWorld.Clear();
+
+	const D2D1_POINT_2F heroPosition = mHero.sprite.GetPosition();
+
+	// ÷̾
+	mCollisionWorld.AddCollider
+	(
+		{
+			.shape = eCollider_Shape::Rect,
+			.layer = HERO_LAYER,
+			.mask = MONSTER_LAYER | IN_BOUNDARY_LAYER | OUT_BOUNDARY_LAYER,
+			.prevPosition = mHero.prevPosition,
+			.position = heroPosition,
+			.halfSize = getHalfSizeFromRectangle(getRectangleFromSprite(mHero.sprite)),
+			.userData = &mHero
+		}
+	);
+
+	// , ܺ 
+	mCollisionWorld.AddCollider
+	(
+		{
+			.shape = eCollider_Shape::Circle,
+			.layer = IN_BOUNDARY_LAYER,
+			.mask = HERO_LAYER | MONSTER_LAYER | BULLET_LAYER,
+			.prevPosition = {},
+			.position = {},
+			.halfSize = { .width = IN_BOUNDARY_RADIUS, .height = IN_BOUNDARY_RADIUS },
+			.userData = nullptr
+		}
+	);
+
+	mCollisionWorld.AddCollider
+	(
+		{
+			.shape = eCollider_Shape::Boundary,
+			.layer = OUT_BOUNDARY_LAYER,
+			.mask = HERO_LAYER | MONSTER_LAYER | BULLET_LAYER,
+			.prevPosition = {},
+			.position = {},
+			.halfSize = { .width = mBoundaryRadius, .height = mBoundaryRadius },
+			.userData = nullptr
+		}
+	);
+
+	// Ѿ  ǥ  ǥ   ˻Ѵ.
+	for (Bullet& bullet : mBullets)
+	{
+		const Sprite& sprite = bullet.sprite;
+		if (not sprite.IsActive())
+		{
+			continue;
+		}
+
+		const float halfLength = sprite.GetScale().width * mRectangleTexture.GetWidth() * 0.5f;
+		const D2D1_POINT_2F endPosition = Math::AddVector(sprite.GetPosition(), Math::ScaleVector(bullet.direction, halfLength));
+
+		mCollisionWorld.AddCollider
+		(
+			{
+				.shape = eCollider_Shape::Line,
+				.layer = BULLET_LAYER,
+				.mask = MONSTER_LAYER | IN_BOUNDARY_LAYER | OUT_BOUNDARY_LAYER,
+				.prevPosition = bullet.prevPosition,
+				.position = endPosition,
+				.halfSize = {},
+				.userData = &bullet
+			}
+		);
+	}
+
+	// . ܺ   ͸ 浹Ѵ.
+	constexpr uint32_t MONSTER_MASK = HERO_LAYER | BULLET_LAYER | SHIELD_LAYER | ORBIT_LAYER | IN_BOUNDARY_LAYER;
+
+	for (Monster& monster : mBigMonsters)
+	{
+		addMonsterCollider(&monster, MONSTER_MASK);
+	}
+
+	for (RunMonster& run : mRunMonsters)
+	{
+		addMonsterCollider(&run.monster, MONSTER_MASK | OUT_BOUNDARY_LAYER);
+	}
+
+	for (SlowMonster& slow : mSlowMonsters)
+	{
+		addMonsterCollider(&slow.monster, MONSTER_MASK);
+	}
+
+	// 
+	if (mShield.state == eShield_State::Growing
+		or mShield.state == eShield_State::Waiting)
+	{
+		const float radius = mShield.scale.width * 0.5f;
+
+		mCollisionWorld.AddCollider
+		(
+			{
+				.shape = eCollider_Shape::Circle,
+				.layer = SHIELD_LAYER,
+				.mask = MONSTER_LAYER,
+				.prevPosition = mHero.prevPosition,
+				.position = heroPosition,
+				.halfSize = { .width = radius, .height = radius },
+				.userData = &mShield
+			}
+		);
+	}
+
+	// ϴ 
+	if (mOrbit.state == eOrbit_State::Rotating)
+	{
+		mCollisionWorld.AddCollider
+		(
+			{
+				.shape = eCollider_Shape::Circle,
+				.layer = ORBIT_LAYER,
+				.mask = MONSTER_LAYER,
+				.prevPosition = Math::SubtractVector(mHero.prevPosition, mOrbit.prevPoint),
+				.position = Math::SubtractVector(heroPosition, mOrbit.ellipse.point),
+				.halfSize = { .width = mOrbit.ellipse.radiusX, .height = mOrbit.ellipse.radiusX },
+				.userData = &mOrbit
+			}
+		);
+	}
+
+	// 콺 UI ư
+	const D2D1_POINT_2F mousePosition = getMouseWorldPosition();
+
+	mCollisionWorld.AddCollider
+	(
+		{
+			.shape = eCollider_Shape::Circle,
+			.layer = CURSOR_LAYER,
+			.mask = BUTTON_LAYER,
+			.prevPosition = mousePosition,
+			.position = mousePosition,
+			.halfSize = {},
+			.userData = nullptr
+		}
+	);
+
+	mCollisionWorld.AddCollider
+	(
+		{
+			.shape = eCollider_Shape::Rect,
+			.layer = BUTTON_LAYER,
+			.mask = CURSOR_LAYER,
+			.prevPosition = mResumeButton.GetPosition(),
+			.position = mResumeButton.GetPosition(),
+			.halfSize = getHalfSizeFromRectangle(getRectangleFromSprite(mResumeButton, mResumeIdleButtonTexture)),
+			.userData = &mResumeButton
+		}
+	);
+
+	mCollisionWorld.AddCollider
+	(
+		{
+			.shape = eCollider_Shape::Rect,
+			.layer = BUTTON_LAYER,
+			.mask = CURSOR_LAYER,
+			.prevPosition = mExitButton.GetPosition(),
+			.position = mExitButton.GetPosition(),
+			.halfSize = getHalfSizeFromRectangle(getRectangleFromSprite(mExitButton, mExitIdleButtonTexture)),
+			.userData = &mExitButton
+		}
+	);
+}
@@ -1,10 +1,20 @@
 #pragma once
+#include "Core/AudioEventBus.h"
 #include "Core/Camera.h"
+#include "Core/CollisionWorld.h"
+#include "Core/EntityComponents.h"
+#include "Core/EntityWorld.h"
+#include "Core/FlowField.h"
 #include "Core/Font.h"
+#include "Core/HotReload.h"
 #include "Core/Label.h"
+#include "Core/NetReplication.h"
+#include "Core/RollbackBuffer.h"
 #include "Core/Scene.h"
 #include "Core/Sound.h"
+#include "Core/SpatialGrid.h"
 #include "Core/Sprite.h"
+#include "Core/SpriteHierarchy.h"
 #include "Core/Texture.h"
 
 enum class eShield_State
@@ -53,6 +63,7 @@ struct GizmoLine
 struct Player
 {
 	Sprite sprite;
+	D2D1_POINT_2F prevPosition;
 	D2D1_POINT_2F velocity;
 	bool isHitEffect;
 	bool isHitBoundry;
@@ -89,6 +100,7 @@ struct Shield
 struct Orbit
 {
 	D2D1_ELLIPSE ellipse;
+	D2D1_POINT_2F prevPoint;
 	eOrbit_State state;
 	float angle;
 
@@ -103,6 +115,7 @@ struct Orbit
 struct Monster
 {
 	Sprite sprite;
+	D2D1_POINT_2F prevPosition;
 	eMonster_State state;
 
 	// 浹 
@@ -171,13 +184,59 @@ struct DiamondEffect
 	float thickTimer;
 };
 
-struct Particle
+// ƼŬ ƼƼ TransformComponent, SpriteComponent, ParticleComponent  ±׸ ,  ִ  DisabledTag ´.
+struct ParticleComponent
 {
-	Sprite sprite;
 	D2D1_POINT_2F direction;
 	float speed;
 };
 
+struct StarParticleTag
+{
+};
+
+struct RectParticleTag
+{
+};
+
+//  Ͽ  . ƽ Է¿ Ƽ ѹ   ƽ   ٽ ùķ̼Ѵ.
+struct SimulationTunables
+{
+	float heroAcc;
+	float boundaryRadius;
+	float bigMonsterSpawnTime;
+	float runMonsterSpawnTime;
+	float slowMonsterSpawnTime;
+	int32_t bulletMaxValue;
+};
+
+// ùķ̼  ƽ  д Է. ѹ      ٽ ùķ̼Ѵ.
+struct SimulationInput
+{
+	// â ǥ
+	D2D1_POINT_2F mousePosition;
+
+	//  ư ̹ ƽ ٸ   ƽ    ð
+	float leftButtonDownElapsedTime;
+
+	int32_t moveX;
+	int32_t moveY;
+
+	//  ְų ̹ ƽ .
+	bool bLeftButton;
+	bool bLeftButtonDown;
+
+	// ̹ ƽ .
+	bool bDash;
+	bool bReload;
+	bool bShield;
+	bool bOrbit;
+	bool bKillAll;
+
+	// Է ġ ƴ϶  ä.
+	SimulationTunables tunables;
+};
+
 struct MonsterSpawnDesc
 {
 	Monster* monster;
@@ -254,10 +313,55 @@ struct DiamondEffectDesc
 	const float deltaTime;
 };
 
+// Ǯ MainScene ⺻  Ѵ. Ǯ ũ   ų ϴ  Բ þ.   1 .
+//  Ʈ Ǯ    .
+struct MainScenePoolScale
+{
+	uint32_t bullet;
+	uint32_t casing;
+	uint32_t bigMonster;
+	uint32_t runMonster;
+	uint32_t slowMonster;
+	uint32_t particle;
+};
+
+struct MainSceneDesc
+{
+	//  ǻ Ŭ̾Ʈ NET_SERVER_PORT ϸ ƽ ¸ .
+	const bool bNetServer;
+
+	//   Ű  κи ϸ   ִ.
+	const MainScenePoolScale poolScale;
+
+	// 0̸ ð Ѵ.
+	const uint32_t randomSeed;
+
+	//  Ÿ â  ùķ̼Ǹ Ѵ. ؽó ũ⸸ а     ʴ´.  ġũ .
+	const bool bHeadless;
+
+	// ƽ   ¿ Է  Rollback ǰ  ְ Ѵ.   F6  ġũ .
+	const bool bRollback;
+};
+
+// simulate   .
+enum class eMainScene_Phase
+{
+	Hero,
+	Bullet,
+	Spawn,
+	Monster,
+	Separation,
+	Effect,
+	UI,
+	Collision,
+	Camera,
+	Count
+};
+
 class MainScene final : public Scene
 {
 public:
-	MainScene() = default;
+	explicit MainScene(const MainSceneDesc& desc);
 	MainScene(const MainScene&) = delete;
 	MainScene& operator=(const MainScene&) = delete;
 
@@ -267,10 +371,56 @@ public:
 	void PostDraw(const D2D1::Matrix3x2F& view, const D2D1::Matrix3x2F& viewForUI) override;
 	void Finalize() override;
 
+	// ùķ̼ ¸ ´. ؽó, , ó ʱȭ  ų ¸  ٽ ׸   ʴ´.
+	void SaveSnapshot(SnapshotWriter* writer) const;
+
+	//   νϽ     ǵ.
+	[[nodiscard]] bool LoadSnapshot(const uint8_t* data, const size_t size);
+
+	[[nodiscard]] static SimulationInput ReadSimulationInput();
+
+	// MainSceneDesc::bRollback   θ.  tickCount ƽ ǰ   Է ٽ ùķ̼Ѵ. ǰ   ¿  true ȯѴ.
+	[[nodiscard]] bool Rollback(const uint32_t tickCount);
+
+	//  ÷̾, Ѿ, ū ,  ,   ̴.
+	[[nodiscard]] uint32_t GetNetSlotCount() const;
+	void CaptureNetState(NetWorldState* outState) const;
+
+	[[nodiscard]] uint32_t GetActiveMonsterCount() const;
+	[[nodiscard]] uint32_t GetActiveBulletCount() const;
+
+	// nullptr ƴϸ simulate ܰ踶 ɸ ʸ eMainScene_Phase  Ѵ.
+	void SetPhaseSeconds(double* phaseSeconds);
+
+public:
+	static constexpr uint32_t ROLLBACK_TICK_COUNT = 8;
+
 private:
+	// , Է, deltaTime   ƽ Ѵ.  ̺Ʈ θ , â Է ġ,  ǵ帮 ʴ´.
+	void simulate(const SimulationInput& input, const float deltaTime);
+
+	// ùķ̼ ¸    带 . ѹ ٽ ùķ̼ϴ ƽ  ʴ´.
+	void updateLabels();
+	void updateSounds();
+
+	//  Ŭ̾Ʈ  ̹ ƽ ¸ .
+	void updateNetServer();
+
+	//    о  ƽ Է¿ ´. ̸ ٲ  ִ  ̸ .
+	void readTunables();
+
+	// Է¿      ٸ ٲ۴. ùķ̼ ù ̴ܰ.
+	void applyTunables(const SimulationTunables& tunables);
+
+	// ٿ  ٲ ٿ  ڸ ٽ .
+	void initializeBoundary();
+
+	void endPhase(const eMainScene_Phase phase);
+
 	D2D1_RECT_F getRectangleFromSprite(const Sprite& sprite);
 	D2D1_RECT_F getRectangleFromSprite( const Sprite& sprite, Texture& texture);
 	D2D1_ELLIPSE getCircleFromSprite(const Sprite& sprite);
+	D2D1_SIZE_F getHalfSizeFromRectangle(const D2D1_RECT_F& rect);
 
 	float getRandom(const float min, const float max);
 	uint32_t getRandom(const uint32_t min, const uint32_t max);
@@ -288,8 +438,8 @@ private:
 	void spawnMonsterEffect(const MonsterSpawnEffectDesc& desc);
 	void deadMonsterEffect(const MonsterDeadSoundDesc& desc);
 	
-	void spawnParticle(Particle* particle, uint32_t size, Monster* monster, uint32_t spawnCount);
-	void updateParticle(Particle* particlee, const uint32_t particleCount, const float deltaTime);
+	void spawnParticle(const ComponentMask kindMask, Monster* monster, uint32_t spawnCount);
+	void updateParticle(const float deltaTime);
 
 	void spawnLongEffect(Sprite* sprites, const uint32_t size, Texture* texture, const Monster& monster);
 	void updateLongEffect(const LongEffectDesc& desc);
@@ -300,6 +450,13 @@ private:
 
 	void updateButtonState(const ButtonDesc& desc);
 
+	void addGridMonster(Monster* monster);
+	void buildMonsterGrid();
+	void separateMonsters(const float deltaTime);
+
+	void addMonsterCollider(Monster* monster, const uint32_t mask);
+	void addColliders();
+
 private:
 	Texture mRectangleTexture{};
 	Texture mRedRectangleTexture{};
@@ -325,12 +482,13 @@ private:
 	float mCameraShakeDuration = 0.0f;
 	float mCameraShakeFrequency = 0.0f;
 
-	std::array<std::vector<Sprite*>, uint32_t(Scene::Layer::End)> mSpriteLayers{};
-	std::vector<Label*> mLabels{};
+	std::array<std::pmr::vector<Sprite*>, uint32_t(Scene::Layer::End)> mSpriteLayers{};
+	std::pmr::vector<Label*> mLabels{};
 
 	// 
 	static constexpr float IN_BOUNDARY_RADIUS = 60.0f;
 	static constexpr float BOUNDARY_RADIUS = 700.0f;
+	float mBoundaryRadius = BOUNDARY_RADIUS;
 
 	static constexpr float UI_CENTER_POSITION_Y = 300.0f;
 
@@ -352,6 +510,49 @@ private:
 
 	bool mIsUpdate = true;
 
+	const MainScenePoolScale mPoolScale;
+	const uint32_t mRandomSeed;
+	const bool mIsHeadless;
+
+	double* mPhaseSeconds = nullptr;
+	std::chrono::steady_clock::time_point mPhaseStartTime{};
+
+	//  ´ rand    ⸦ Ἥ  Բ ´.
+	std::mt19937 mRandom{};
+
+	//   ٲ ø.
+	static constexpr uint32_t SNAPSHOT_VERSION = 4;
+	static constexpr size_t SNAPSHOT_CAPACITY = 128 * 1024;
+
+	//  忡 F5 ϰ F9 ǵ.
+	SnapshotWriter mSnapshot{};
+
+	// MainSceneDesc::bRollback Ѹ ƽ   ¿ Է .  忡 F6 ǰ ٽ ùķ̼ϰ  ¿  ȮѴ.
+	const bool mIsRollbackEnabled;
+	RollbackBuffer<SimulationInput, ROLLBACK_TICK_COUNT> mRollbackBuffer{};
+	SnapshotWriter mRollbackBeforeSnapshot{};
+	SnapshotWriter mRollbackAfterSnapshot{};
+
+	// MainSceneDesc::bNetServer Ѹ  ǻ Ŭ̾Ʈ NET_SERVER_PORT   ƽ ¸ .
+	//  ÷̾, Ѿ, ū ,  ,   ̴.
+	static constexpr uint16_t NET_SERVER_PORT = 27015;
+
+	bool mIsNetServerEnabled = false;
+	NetServer mNetServer{};
+	bool mIsNetServerOpen = false;
+	NetWorldState mNetState{};
+	uint32_t mNetTick = 0;
+
+	// Resource  ؽó   ٲ  ٽ  ʰ д´.
+	//   ٽ   ó ùķ̼ϴ ƽ .
+	HotReload mHotReload{};
+	uint32_t mTunablesVersion = 0;
+	SimulationTunables mTunables{};
+
+	// ùķ̼ ۿ ó . Update ùķ̼ ڿ  óѴ.
+	uint32_t mShotCount = 0;
+	bool mIsExitRequested = false;
+
 	// Ű 
 	bool mIsCursorConfined = false;
 	bool mIsColliderKeyDown = false;
@@ -360,22 +561,35 @@ private:
 	static constexpr uint32_t HERO_MAX_HP = 500;
 	static constexpr float UI_HP_SCALE_WIDTH = 1.5f;
 
+	static constexpr float ACC = 50.0f; // ӵ
+	float mHeroAcc = ACC;
+
 	Player mHero{};
 	Sound mHeroHitSound{};
 
+	// Ű    
+	int32_t mPreviousMoveX = 0;
+	int32_t mPreviousMoveY = 0;
+
 	// ÷̾ 
 	Sprite mZoom{};
 
 	// ÷̾ 뽬
 	static constexpr uint32_t DASH_MAX_COUNT = 10;
 	Dash mDash{};
+	D2D1_POINT_2F mDashDirection{};
 	Sound mDashSound{};
 
 	// ÷̾ Ѿ
+	// Ǯ ڿ  MainSceneDesc::poolScale   ũ  ũ⸦ ٲ ʴ´. ̾  Ʈ ּҸ  ִ.
 	static constexpr uint32_t BULLET_COUNT = 100;
-	std::array<Bullet, BULLET_COUNT> mBullets{};
+	std::pmr::vector<Bullet> mBullets;
 	float mBulletShootingCoolTimer{};
-	int32_t mBulletValue = BULLET_COUNT;
+	int32_t mBulletValue;
+
+	//   ä Ѿ . Ѿ Ǯ   .
+	int32_t mBulletMaxValue;
+
 	Sound mBulletSound{};
 
 	bool misKeyDownReload = false;
@@ -385,16 +599,22 @@ private:
 
 	// ÷̾ ź
 	static constexpr uint32_t CASING_COUNT = BULLET_COUNT;
-	std::array<Casing, CASING_COUNT> mCasings{};
+	std::pmr::vector<Casing> mCasings;
 
 	// ÷̾  ų
 	static constexpr float SHELD_MIN_RADIUS = 50.0f;
 	static constexpr float SHELD_MAX_RADIUS = 170.0f;
+	static constexpr float SHIELD_SKILL_DURATION = 3.0f;
+	static constexpr float SHIELD_COOL_TIME = 8.0f;
 
 	Shield mShield{};
 	Sound mShieldSound{};
 
 	// ÷̾  ų
+	static constexpr float ORBIT_ROTATE_TIME = 4.0f;
+	static constexpr float ORBIT_COOL_TIME = 6.0f;
+	static constexpr float ORBIT_OFFSET = 160.0f;
+
 	Orbit mOrbit{};
 	Sound mOrbitSound{};
 
@@ -445,8 +665,11 @@ private:
 	static constexpr float BIG_MONSTER_SCALE = 1.2f;
 	static constexpr float BIG_MONSTER_HP_BAR_WIDTH = 0.1f;
 
-	std::array<Monster, BIG_MONSTER_COUNT> mBigMonsters{};
+	static constexpr float BIG_MONSTER_SPAWN_TIME = 0.5f;
+
+	std::pmr::vector<Monster> mBigMonsters;
 	float mBigMonsterSpawnTimer{};
+	float mBigMonsterSpawnTime = BIG_MONSTER_SPAWN_TIME;
 	Sound mBigMonsterDeadSound{};
 
 	//  
@@ -458,8 +681,11 @@ private:
 	static constexpr uint32_t RUN_MONSTER_MAX_HP = 1;
 	static constexpr float RUN_MONSTER_HP_BAR_WIDTH = 0.05f;
 
-	std::array<RunMonster, RUN_MONSTER_COUNT> mRunMonsters{};
+	static constexpr float RUN_MONSTER_SPAWN_TIME = 2.0f;
+
+	std::pmr::vector<RunMonster> mRunMonsters;
 	float mRunMonsterSpawnTimer{};
+	float mRunMonsterSpawnTime = RUN_MONSTER_SPAWN_TIME;
 	Sound mRunMonsterDeadSound{};
 
 	//  
@@ -469,34 +695,88 @@ private:
 	static constexpr float SLOW_MONSTER_HP_BAR_WIDTH = 0.06f;
 	static constexpr uint32_t SLOW_MONSTER_MAX_HP = 10;
 
-	std::array<SlowMonster, SLOW_MONSTER_COUNT> mSlowMonsters{};
+	static constexpr float SLOW_MONSTER_SPAWN_TIME = 1.0f;
+
+	std::pmr::vector<SlowMonster> mSlowMonsters;
 	float mSlowMonsterSpawnTimer{};
+	float mSlowMonsterSpawnTime = SLOW_MONSTER_SPAWN_TIME;
 	Sound mSlowMonsterDeadSound{};
 
+	// ü¹ٿ ߹ٴ  ڽ ٿ ٴϰ Ѵ.
+	SpriteHierarchy mSpriteHierarchy{};
+
+	//  ̵ 
+	static constexpr float FLOW_FIELD_CELL_SIZE = 20.0f;
+	FlowField mFlowField{};
+
+	//   ε
+	static constexpr float MONSTER_GRID_CELL_SIZE = 40.0f;
+	SpatialGrid mMonsterGrid{};
+	std::pmr::vector<Monster*> mGridMonsters{};
+	std::pmr::vector<D2D1_POINT_2F> mGridPositions{};
+	std::pmr::vector<float> mGridRadii{};
+	uint32_t mGridSlowBegin = 0;
+	float mMaxGridRadius = 0.0f;
+	std::pmr::vector<uint32_t> mNeighborIndices{};
+
+	//  о
+	static constexpr float SEPARATION_SPEED = 150.0f;
+	std::pmr::vector<D2D1_POINT_2F> mSeparationOffsets{};
+
 	// 浹 
+	static constexpr uint32_t HERO_LAYER = 1 << 0;
+	static constexpr uint32_t MONSTER_LAYER = 1 << 1;
+	static constexpr uint32_t BULLET_LAYER = 1 << 2;
+	static constexpr uint32_t SHIELD_LAYER = 1 << 3;
+	static constexpr uint32_t ORBIT_LAYER = 1 << 4;
+	static constexpr uint32_t IN_BOUNDARY_LAYER = 1 << 5;
+	static constexpr uint32_t OUT_BOUNDARY_LAYER = 1 << 6;
+	static constexpr uint32_t CURSOR_LAYER = 1 << 7;
+	static constexpr uint32_t BUTTON_LAYER = 1 << 8;
+
+	static constexpr float COLLISION_CELL_SIZE = 40.0f;
+	CollisionWorld mCollisionWorld{};
+
 	Sprite* mTargetMonster = nullptr;
 	Sprite* mTargetBullet = nullptr;
 
 	// Ʈ 
 	static constexpr uint32_t LONG_EFFECT_COUNT = BIG_MONSTER_COUNT;
 	static constexpr D2D1_SIZE_F LONG_EFFECT_SCALE = { 1.2f, 50.0f };
-	std::array<Sprite, LONG_EFFECT_COUNT> mLongEffect{};
-
-	float mLongEffectTimer[LONG_EFFECT_COUNT]{};
+	std::pmr::vector<Sprite> mLongEffect;
+	std::pmr::vector<float> mLongEffectTimer;
 
 	static constexpr uint32_t CYAN_EFFECT_COUNT = RUN_MONSTER_COUNT;
-	std::array<DiamondEffect, CYAN_EFFECT_COUNT> mCyanEffect{};
+	std::pmr::vector<DiamondEffect> mCyanEffect;
 
 	static constexpr uint32_t GREEN_EFFECT_COUNT = SLOW_MONSTER_COUNT;
-	std::array<DiamondEffect, SLOW_MONSTER_COUNT> mGreenEffect{};
+	std::pmr::vector<DiamondEffect> mGreenEffect;
 
 	// ƼŬ 
 	static constexpr uint32_t STAR_PARTICLE_COUNT = 102;
 	static constexpr uint32_t PARTICLE_PER = 6;
-	std::array<Particle, STAR_PARTICLE_COUNT> mStarParticles{};
-
 	static constexpr uint32_t RECT_PARTICLE_COUNT = 13 * 6;
-	std::array<Particle, RECT_PARTICLE_COUNT> mRectParticles{};
+
+	EntityWorld mEntityWorld{};
+
+	//   Ѵ ƼŬ. ƼŬ Ǯ Ű ŭ þǷ Initialize  д.
+	std::pmr::vector<Entity> mSpawnedParticles{};
+
+	// ùķ̼ǿ   ̺Ʈ  Ƽ Ӹ   Ѵ.  ߿ Ѳ  嵵   ȴ.
+	static constexpr uint32_t MAX_SOUND_PLAY_COUNT_PER_FRAME = 4;
+
+	AudioEventBus mAudioEvents{};
+	uint32_t mHeroHitSoundEvent = 0;
+	uint32_t mBulletSoundEvent = 0;
+	uint32_t mBigMonsterDeadSoundEvent = 0;
+	uint32_t mRunMonsterDeadSoundEvent = 0;
+	uint32_t mSlowMonsterDeadSoundEvent = 0;
+	uint32_t mDashSoundEvent = 0;
+	uint32_t mReloadSoundEvent = 0;
+	uint32_t mShieldSoundEvent = 0;
+	uint32_t mOrbitSoundEvent = 0;
+	uint32_t mGameOverSoundEvent = 0;
+	uint32_t mButtonSoundEvent = 0;
 
 	Texture mRedStarTexture{};
 	Texture mOrangeStarTexture{};
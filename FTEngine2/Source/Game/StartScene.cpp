@@ -18,11 +18,11 @@ void StartScene::Initialize()
 
 	srand(unsigned int(time(nullptr)));
 
-	mBackgroundSound.Initialize(GetHelper(), "Resource/Sound/DST-RailJet-LongSeamlessLoop.mp3", true);
+	mBackgroundSound.Initialize("Resource/Sound/DST-RailJet-LongSeamlessLoop.mp3", true, true);
 	mBackgroundSound.SetVolume(0.3f);
 	mBackgroundSound.Play();
 
-	mButtonSound.Initialize(GetHelper(), "Resource/Sound/button_sound.wav", false);
+	mButtonSound.Initialize("Resource/Sound/button_sound.wav", false, false);
 	mButtonSound.SetVolume(0.2f);
 
 	// Star ʱȭѴ.
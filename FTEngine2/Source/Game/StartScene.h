@@ -55,7 +55,7 @@ private:
 private:
 	bool mIsUpdate = true;
 
-	std::array<std::vector<Sprite*>, uint32_t(Layer::End)> mSpriteLayers{};
+	std::array<std::pmr::vector<Sprite*>, uint32_t(Layer::End)> mSpriteLayers{};
 	Camera mMainCamera{};
 
 	static constexpr uint32_t STAR_COUNT = 18;
@@ -1,8 +1,16 @@
 #include "pch.h"
 
+#include <shellapi.h>
+
+#include "Core/AllocationTracker.h"
 #include "Core/Constant.h"
 #include "Core/Core.h"
 #include "Core/Input.h"
+#include "Core/InputLatency.h"
+#include "Core/Telemetry.h"
+
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/SceneBenchmark.h"
 
 #include "Game/MainScene.h"
 #include "Game/StartScene.h"
@@ -17,6 +25,10 @@ enum class eGameScene
 };
 
 static LRESULT HandleWindowMessage(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
+static const _TCHAR* FindOption(const int argumentCount, const LPWSTR* arguments, const _TCHAR* name);
+static int RunBenchmark(const _TCHAR* filterText);
+static int RunSceneBenchmark(const _TCHAR* tickText);
+static void AttachParentConsole();
 
 static Core gCore;
 static eGameScene gGameScene;
@@ -25,6 +37,38 @@ int WINAPI _tWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
 {
 	_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 
+	// ɼ  ϳ ̸ Ȯ ƾ .
+	int argumentCount = 0;
+	LPWSTR* arguments = CommandLineToArgvW(GetCommandLineW(), &argumentCount);
+	ASSERT(arguments != nullptr);
+
+	// -benchmark-scene[=ticks]: â  ʰ MainScene 帮  Ǯ ũ⺰ Ѵ.  Ǯ Բ Ű    Ű.
+	if (const _TCHAR* value = FindOption(argumentCount, arguments, TEXT("-benchmark-scene")); value != nullptr)
+	{
+		const int exitCode = RunSceneBenchmark(value);
+		LocalFree(arguments);
+		return exitCode;
+	}
+
+	// -benchmark[=filter]: â  ʰ ġũ Ѵ.
+	if (const _TCHAR* value = FindOption(argumentCount, arguments, TEXT("-benchmark")); value != nullptr)
+	{
+		const int exitCode = RunBenchmark(value);
+		LocalFree(arguments);
+		return exitCode;
+	}
+
+	// -allocation-assert:   ӿ  Ҵ  .
+	const bool bAllocationAssert = FindOption(argumentCount, arguments, TEXT("-allocation-assert")) != nullptr;
+
+	// -net: MainScene  ǻ Ŭ̾Ʈ ƽ ¸ .    Ҵ.
+	const bool bNetServer = FindOption(argumentCount, arguments, TEXT("-net")) != nullptr;
+
+	// -telemetry:    ð Ҵ 踦 ϰ ֱ  ð CSV .
+	const bool bTelemetry = FindOption(argumentCount, arguments, TEXT("-telemetry")) != nullptr;
+
+	LocalFree(arguments);
+
 	constexpr const _TCHAR* MENU_NAME = TEXT("FTEngine");
 	WNDCLASSEX windowClass
 	{
@@ -82,8 +126,27 @@ int WINAPI _tWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
 
 	Input::Get()._Initialize(hWnd);
 
+	AllocationTracker::Get().SetAssertEnabled(bAllocationAssert);
+
+	// ǰ   F6 Ƿ   ƽ   ʴ´.
+#if defined(_DEBUG)
+	constexpr bool bRollback = true;
+#else
+	constexpr bool bRollback = false;
+#endif
+
+	const MainSceneDesc mainSceneDesc =
+	{
+		.bNetServer = bNetServer,
+		.poolScale = { .bullet = 1, .casing = 1, .bigMonster = 1, .runMonster = 1, .slowMonster = 1, .particle = 1 },
+		.randomSeed = 0,
+		.bHeadless = false,
+		.bRollback = bRollback
+	};
+
 	gCore.SetSceneType(Scene::Type::Start);
-	gCore.Initialize(hWnd, new StartScene);
+	gCore.Initialize(hWnd);
+	gCore.ChangeScene<StartScene>();
 	gGameScene = eGameScene::Start;
 
 	MSG msg{};
@@ -110,13 +173,13 @@ int WINAPI _tWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
 			{
 			case eGameScene::Start:
 				gCore.SetSceneType(Scene::Type::Main);
-				gCore.ChangeScene(new MainScene);
+				gCore.ChangeScene<MainScene>(mainSceneDesc);
 				gGameScene = eGameScene::Main;
 				break;
 
 			case eGameScene::Main:
 				gCore.SetSceneType(Scene::Type::Main);
-				gCore.ChangeScene(new MainScene);
+				gCore.ChangeScene<MainScene>(mainSceneDesc);
 				gGameScene = eGameScene::Main;
 				break;
 
@@ -128,13 +191,50 @@ int WINAPI _tWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
 
 		Input::Get()._Clear();
 
-		deltaTime = duration_cast<milliseconds>(high_resolution_clock::now() - startTime).count() * 0.001f;
+		deltaTime = duration<float>(high_resolution_clock::now() - startTime).count();
 	}
 
 EXIT_WINDOW:
 
+	if (bTelemetry)
+	{
+		const TelemetryStatistics statistics = Telemetry::Get().GetStatistics();
+		const TelemetryPhaseStatistics& frame = statistics.phases[uint32_t(eTelemetry_Phase::Frame)];
+
+		LOG("frame p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, p99.9 %.2f ms, max %.2f ms, stutter %llu / %llu",
+			frame.p50Milliseconds, frame.p95Milliseconds, frame.p99Milliseconds, frame.p999Milliseconds, frame.maxMilliseconds,
+			statistics.totalStutterCount, statistics.totalFrameCount);
+
+		Telemetry::Get().WriteCsv("telemetry.csv");
+
+		const InputLatencyStatistics latency = InputLatency::Get().GetStatistics();
+
+		LOG("input latency mean %.2f ms, p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, max %.2f ms (%llu clicks)",
+			latency.meanMilliseconds, latency.p50Milliseconds, latency.p95Milliseconds, latency.p99Milliseconds, latency.maxMilliseconds,
+			latency.sampleCount);
+
+		const AllocationTracker& allocationTracker = AllocationTracker::Get();
+		const AllocationStatistics allocationStatistics = allocationTracker.GetTotalStatistics();
+
+		LOG("steady-state frame allocations %llu (peak %llu / frame)",
+			allocationTracker.GetSteadyFrameAllocationCount(), allocationTracker.GetPeakSteadyFrameAllocationCount());
+
+		for (uint32_t zone = 0; zone < uint32_t(eAllocation_Zone::Count); ++zone)
+		{
+			LOG("    %-8s %10llu allocations, %12llu bytes", AllocationTracker::GetZoneName(eAllocation_Zone(zone)),
+				allocationStatistics.allocationCounts[zone], allocationStatistics.allocationBytes[zone]);
+		}
+	}
+
 	gCore.Finalize();
 
+	// ˻ 忡    Ҵߴٸ з .
+	if (AllocationTracker::Get().IsAssertEnabled() and AllocationTracker::Get().GetViolationCount() != 0)
+	{
+		LOG("%llu allocations in steady-state frames", AllocationTracker::Get().GetViolationCount());
+		return 1;
+	}
+
 	return 0;
 }
 
@@ -146,37 +246,37 @@ LRESULT HandleWindowMessage(HWND hWnd, UINT message, WPARAM wParam, LPARAM lPara
 	case WM_SYSKEYUP:
 		if (wParam == VK_MENU)
 		{
-			Input::Get()._SetKeyState(uint32_t(wParam), bool(WM_SYSKEYUP - message));
+			Input::Get()._PushEvent({ .timestamp = steady_clock::now(), .type = eInput_Event::Key, .code = uint32_t(wParam), .bPressed = bool(WM_SYSKEYUP - message) });
 			return 0;
 		}
 		return 0;
 
 	case WM_KEYDOWN:
 	case WM_KEYUP:
-		Input::Get()._SetKeyState(uint32_t(wParam), bool(WM_KEYUP - message));
+		Input::Get()._PushEvent({ .timestamp = steady_clock::now(), .type = eInput_Event::Key, .code = uint32_t(wParam), .bPressed = bool(WM_KEYUP - message) });
 		return 0;
 
 	case WM_LBUTTONDOWN:
 	case WM_LBUTTONUP:
-		Input::Get()._SetMouseButtonState(Input::eMouseButton::Left, bool(WM_LBUTTONUP - message));
+		Input::Get()._PushEvent({ .timestamp = steady_clock::now(), .type = eInput_Event::MouseButton, .code = uint32_t(Input::eMouseButton::Left), .bPressed = bool(WM_LBUTTONUP - message) });
 		return 0;
 
 	case WM_RBUTTONDOWN:
 	case WM_RBUTTONUP:
-		Input::Get()._SetMouseButtonState(Input::eMouseButton::Right, bool(WM_RBUTTONUP - message));
+		Input::Get()._PushEvent({ .timestamp = steady_clock::now(), .type = eInput_Event::MouseButton, .code = uint32_t(Input::eMouseButton::Right), .bPressed = bool(WM_RBUTTONUP - message) });
 		return 0;
 
 	case WM_MBUTTONDOWN:
 	case WM_MBUTTONUP:
-		Input::Get()._SetMouseButtonState(Input::eMouseButton::Middle, bool(WM_MBUTTONUP - message));
+		Input::Get()._PushEvent({ .timestamp = steady_clock::now(), .type = eInput_Event::MouseButton, .code = uint32_t(Input::eMouseButton::Middle), .bPressed = bool(WM_MBUTTONUP - message) });
 		return 0;
 
 	case WM_MOUSEMOVE:
-		Input::Get()._SetMousePosition(D2D1_POINT_2F{ .x = float(LOWORD(lParam)), .y = float(HIWORD(lParam)) });
+		Input::Get()._PushEvent({ .timestamp = steady_clock::now(), .type = eInput_Event::MouseMove, .mousePosition = { .x = float(LOWORD(lParam)), .y = float(HIWORD(lParam)) } });
 		return 0;
 
 	case WM_MOUSEWHEEL:
-		Input::Get()._SetMouseScrollWheel(int16_t(HIWORD(wParam)));
+		Input::Get()._PushEvent({ .timestamp = steady_clock::now(), .type = eInput_Event::MouseWheel, .scrollWheel = int16_t(HIWORD(wParam)) });
 		return 0;
 
 	case WM_SETFOCUS:
@@ -206,4 +306,148 @@ LRESULT HandleWindowMessage(HWND hWnd, UINT message, WPARAM wParam, LPARAM lPara
 	}
 
 	return DefWindowProc(hWnd, message, wParam, lParam);
-}
\ No newline at end of file
+}
+
+// name Ǵ name= ڸ ã´.    ڿ, ڰ  nullptr ȯѴ.
+const _TCHAR* FindOption(const int argumentCount, const LPWSTR* arguments, const _TCHAR* name)
+{
+	const size_t nameLength = _tcslen(name);
+
+	// ù ڴ   ̴.
+	for (int i = 1; i < argumentCount; ++i)
+	{
+		const _TCHAR* argument = arguments[i];
+
+		if (_tcsncmp(argument, name, nameLength) != 0)
+		{
+			continue;
+		}
+
+		if (argument[nameLength] == TEXT('\0'))
+		{
+			return argument + nameLength;
+		}
+
+		if (argument[nameLength] == TEXT('='))
+		{
+			return argument + nameLength + 1;
+		}
+	}
+
+	return nullptr;
+}
+
+int RunBenchmark(const _TCHAR* filterText)
+{
+	AttachParentConsole();
+
+	std::string filter;
+
+	for (const _TCHAR* c = filterText; *c != TEXT('\0'); ++c)
+	{
+		filter.push_back(char(*c));
+	}
+
+	Benchmark benchmark;
+	RegisterMathBenchmarks(&benchmark);
+	RegisterCollisionBenchmarks(&benchmark);
+	RegisterSpatialBenchmarks(&benchmark);
+	RegisterLabelBenchmarks(&benchmark);
+	RegisterEntityBenchmarks(&benchmark);
+	RegisterRenderBenchmarks(&benchmark);
+
+	benchmark.Run(filter.empty() ? nullptr : filter.c_str());
+	benchmark.WriteJson("benchmark.json");
+
+	return 0;
+}
+
+int RunSceneBenchmark(const _TCHAR* tickText)
+{
+	AttachParentConsole();
+
+	constexpr uint32_t UNIFORM_SCALES[] = { 1, 10, 100, 1000 };
+	constexpr MainScenePoolScale ISOLATED_SCALES[] =
+	{
+		{ .bullet = 100, .casing = 1, .bigMonster = 1, .runMonster = 1, .slowMonster = 1, .particle = 1 },
+		{ .bullet = 1, .casing = 100, .bigMonster = 1, .runMonster = 1, .slowMonster = 1, .particle = 1 },
+		{ .bullet = 1, .casing = 1, .bigMonster = 100, .runMonster = 1, .slowMonster = 1, .particle = 1 },
+		{ .bullet = 1, .casing = 1, .bigMonster = 1, .runMonster = 100, .slowMonster = 1, .particle = 1 },
+		{ .bullet = 1, .casing = 1, .bigMonster = 1, .runMonster = 1, .slowMonster = 100, .particle = 1 },
+		{ .bullet = 1, .casing = 1, .bigMonster = 1, .runMonster = 1, .slowMonster = 1, .particle = 100 }
+	};
+	constexpr uint32_t WARMUP_TICK_COUNT = 120;
+	constexpr float DELTA_TIME = 1.0f / 60.0f;
+
+	uint32_t tickCount = 600;
+
+	if (*tickText != TEXT('\0'))
+	{
+		tickCount = max(uint32_t(_tcstoul(tickText, nullptr, 10)), 1u);
+	}
+
+	//  Ǯ Բ Ű ,  κи ϸ ֵ   Ű.
+	std::vector<MainScenePoolScale> poolScales;
+
+	for (const uint32_t scale : UNIFORM_SCALES)
+	{
+		poolScales.push_back({ .bullet = scale, .casing = scale, .bigMonster = scale, .runMonster = scale, .slowMonster = scale, .particle = scale });
+	}
+
+	poolScales.insert(poolScales.end(), std::begin(ISOLATED_SCALES), std::end(ISOLATED_SCALES));
+
+	std::vector<SceneBenchmarkResult> results;
+
+	for (const MainScenePoolScale& poolScale : poolScales)
+	{
+		SceneBenchmark sceneBenchmark;
+		sceneBenchmark.Initialize
+		(
+			{
+				.poolScale = poolScale,
+				.warmupTickCount = WARMUP_TICK_COUNT,
+				.tickCount = tickCount,
+				.deltaTime = DELTA_TIME
+			}
+		);
+		sceneBenchmark.Run();
+		sceneBenchmark.Finalize();
+
+		const SceneBenchmarkResult& result = sceneBenchmark.GetResult();
+		LOG("MainScene bullet x%u  casing x%u  big x%u  run x%u  slow x%u  particle x%u",
+			result.poolScale.bullet, result.poolScale.casing, result.poolScale.bigMonster, result.poolScale.runMonster, result.poolScale.slowMonster, result.poolScale.particle);
+		LOG("    %-12s mean %10.2f us  p50 %10.2f us  p99 %10.2f us  max %10.2f us  alloc %.1f / tick  (monster %u, bullet %u, particle %u)", "tick",
+			result.meanMicroseconds, result.p50Microseconds, result.p99Microseconds, result.maxMicroseconds,
+			result.meanAllocationCount, result.maxMonsterCount, result.maxBulletCount, result.maxParticleCount);
+		LOG("    %-12s p50 %10.2f us  p99 %10.2f us  max %10.2f us  (%llu clicks)", "input latency",
+			result.inputLatencyP50Microseconds, result.inputLatencyP99Microseconds, result.inputLatencyMaxMicroseconds, result.inputLatencySampleCount);
+		LOG("    %-12s p50 %10.2f us  p99 %10.2f us  restore p50 %10.2f us  p99 %10.2f us  (%llu bytes)", "snapshot",
+			result.snapshotP50Microseconds, result.snapshotP99Microseconds, result.restoreP50Microseconds, result.restoreP99Microseconds, result.snapshotBytes);
+		LOG("    %-12s p50 %10.2f us  p99 %10.2f us  (%u ticks x %u, %u mismatches)", "rollback",
+			result.rollbackP50Microseconds, result.rollbackP99Microseconds, SceneBenchmark::ROLLBACK_TICK_COUNT, result.rollbackCount, result.rollbackMismatchCount);
+		LOG("    %-12s encode p50 %10.2f us  p99 %10.2f us  decode p50 %10.2f us  p99 %10.2f us  (%.0f / %.0f bytes per tick, delta %.0f%%, %u mismatches)", "net",
+			result.netEncodeP50Microseconds, result.netEncodeP99Microseconds, result.netDecodeP50Microseconds, result.netDecodeP99Microseconds,
+			result.netServerBytesPerTick, result.netClientBytesPerTick, result.netDeltaChunkRatio * 100.0, result.netMismatchCount);
+
+		for (uint32_t phase = 0; phase < uint32_t(eScene_Phase::Count); ++phase)
+		{
+			LOG("    %-12s %10.2f us", SceneBenchmark::GetPhaseName(eScene_Phase(phase)), result.phaseMeanMicroseconds[phase]);
+		}
+
+		results.push_back(result);
+	}
+
+	SceneBenchmark::WriteJson("scene_benchmark.json", results);
+
+	return 0;
+}
+
+void AttachParentConsole()
+{
+	// ֿܼ ߴٸ  ֿܼ Ѵ.
+	if (AttachConsole(ATTACH_PARENT_PROCESS))
+	{
+		FILE* stream = nullptr;
+		freopen_s(&stream, "CONOUT$", "w", stdout);
+	}
+}
@@ -2,14 +2,20 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <bitset>
+#include <charconv>
 #include <chrono>
 #include <d2d1.h>
 #include <dwrite.h>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <memory_resource>
+#include <random>
 #include <tchar.h>
+#include <thread>
 #include <unordered_map>
 #include <wincodec.h>
 